@@ -0,0 +1,74 @@
+# Compare the average ISR cost of DEMO_MODE=2 between the debug and the
+# release profile.
+#
+# On the board: capture the UART output of a DEMO_MODE=2 run of each
+# profile and compare the PMU cycle counts they report (cycles.h):
+#
+#   cmake -DDEBUG_LOG=<file> -DRELEASE_LOG=<file> -P bench_profiles.cmake
+#
+# On the host, as the "bench" target of CMakeLists.txt runs it: the host
+# builds of both profiles, timed in host nanoseconds (CYCLES_HOST_CLOCK).
+# That is x86 code against a register model, a smoke check that the
+# profiles build and the comparison works, not a measure of A53 cycles.
+#
+#   cmake -DDEBUG_EXE=<exe> -DRELEASE_EXE=<exe> -P bench_profiles.cmake
+
+function(run_bench Exe OutVar)
+    execute_process(COMMAND ${Exe}
+        OUTPUT_VARIABLE _out
+        ERROR_QUIET
+        RESULT_VARIABLE _rc
+    )
+    if(NOT _rc EQUAL 0)
+        message(FATAL_ERROR "${Exe} failed (${_rc})")
+    endif()
+    set(${OutVar} "${_out}" PARENT_SCOPE)
+endfunction()
+
+function(report_avg Output Path OutVar)
+    string(REGEX MATCH "--- ${Path} latency[^\n]*\n[^\n]*\n  avg +([0-9]+)"
+           _match "${Output}")
+    if(NOT _match)
+        message(FATAL_ERROR "no \"${Path}\" report")
+    endif()
+    set(${OutVar} ${CMAKE_MATCH_1} PARENT_SCOPE)
+endfunction()
+
+if(DEFINED DEBUG_LOG AND DEFINED RELEASE_LOG)
+    file(READ ${DEBUG_LOG} _debug_out)
+    file(READ ${RELEASE_LOG} _release_out)
+    string(REPLACE "\r" "" _debug_out "${_debug_out}")
+    string(REPLACE "\r" "" _release_out "${_release_out}")
+    set(_unit "PMU cycles")
+elseif(DEFINED DEBUG_EXE AND DEFINED RELEASE_EXE)
+    run_bench(${DEBUG_EXE} _debug_out)
+    run_bench(${RELEASE_EXE} _release_out)
+    set(_unit "host ns")
+    message("Host-only smoke check: x86 ns against the register model, "
+            "not A53 cycles; compare board logs for those")
+else()
+    message(FATAL_ERROR
+        "set DEBUG_LOG and RELEASE_LOG, or DEBUG_EXE and RELEASE_EXE")
+endif()
+
+# Left column padded to 27
+function(pad Text OutVar)
+    string(LENGTH "${Text}" _len)
+    math(EXPR _pad "27 - ${_len}")
+    string(REPEAT " " ${_pad} _spaces)
+    set(${OutVar} "${Text}${_spaces}" PARENT_SCOPE)
+endfunction()
+
+pad("ISR cost, avg ${_unit}" _head)
+message("${_head}debug  release")
+foreach(_path "Stock driver ISR" "Fast-path ISR")
+    report_avg("${_debug_out}" "${_path}" _debug)
+    report_avg("${_release_out}" "${_path}" _release)
+    pad("${_path}" _label)
+    if(_debug GREATER 0)
+        math(EXPR _pct "(100 * ${_release}) / ${_debug}")
+    else()
+        set(_pct "-")
+    endif()
+    message("${_label}${_debug}  ${_release}  (${_pct}%)")
+endforeach()
@@ -0,0 +1,209 @@
+/******************************************************************************
+ * Host check of the 64-bit clock (../src/clock64.c) across forced wraps
+ *
+ * Clock64_Now() runs against the AXI timer register model (sim_tmrctr.c)
+ * on a virtual clock. For each read the check picks one of the read's
+ * register accesses and jumps the clock so the counter rolls over a few
+ * cycles before or after it, and picks another access after which the
+ * rollover ISR runs, as an IRQ taken between two instructions would.
+ * Reads from ISR context run with the IRQ masked, so the rollover stays
+ * pending for the whole read. Every combination is swept first, then
+ * random ones follow.
+ *
+ * Each value read is compared with the time the model's counter
+ * actually reached at the TCR read it is built from. It must match to
+ * the reload cycle, and reads must never go backwards - a torn read is
+ * off by 2^32.
+ *
+ *   clock64_wrap [reads] [seed]
+ ******************************************************************************/
+
+#include "clock64.h"
+#include "sim.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define WRAP_BASE           0x80000000U
+#define WRAP_POINTS         8U      /* Register accesses a read may take */
+#define WRAP_NEAR           3U      /* Rollover up to 3/4 of an access off */
+#define WRAP_NONE           0xFFFFFFFFU
+
+#define TMR_TCSR            0x0U
+#define TMR_TCR             0x8U
+#define TCSR_LOAD           0x020U
+#define TCSR_ENT            0x080U
+
+static Clock64 Clock;
+static u64 Now;             /* Virtual time */
+static u64 Rng;
+
+/* Truth: counting from Start at StartTime */
+static u64 Start;
+static u64 StartTime;
+static u64 TcrTime;
+
+/* The read under test */
+static int Reading;
+static int Masked;
+static u32 Access;
+static u32 WrapAt;
+static s32 WrapOffset;
+static u32 IsrAt;
+static u32 Wraps;
+
+static void Service(void)
+{
+    Reading = 0;
+    if (SimTmr_IrqLine(Now)) {
+        Now += SIM_IRQ_ENTRY_CYCLES;
+        Clock64_InterruptHandler(&Clock);
+        Now += SIM_IRQ_EXIT_CYCLES;
+    }
+}
+
+u32 Sim_Read32(UINTPTR Addr)
+{
+    u32 Offset = (u32)(Addr - WRAP_BASE);
+    u32 Step = Reading ? Access++ : WRAP_NONE;
+    u64 Rollover;
+    u32 Value;
+
+    if (Step == WrapAt) {
+        Rollover = SimTmr_NextEvent(Now);
+        if ((Rollover != Now) && ((s64)(Rollover + WrapOffset) > (s64)Now)) {
+            Now = Rollover + WrapOffset;
+            Wraps++;
+        }
+    }
+
+    Now += SIM_MMIO_CYCLES;
+    Value = SimTmr_Read(Offset, Now);
+    if (Offset == TMR_TCR) {
+        TcrTime = Now;
+    }
+
+    if (!Masked && (Step != WRAP_NONE) && (Step == IsrAt)) {
+        Service();
+        Reading = 1;
+    }
+    return Value;
+}
+
+void Sim_Write32(UINTPTR Addr, u32 Value)
+{
+    u32 Offset = (u32)(Addr - WRAP_BASE);
+
+    Now += SIM_MMIO_CYCLES;
+    if ((Offset == TMR_TCSR) && (StartTime == 0) &&
+        ((Value & (TCSR_ENT | TCSR_LOAD)) == TCSR_ENT)) {
+        StartTime = Now;
+    }
+    SimTmr_Write(Offset, Value, Now);
+}
+
+static u32 Random(void)
+{
+    Rng ^= Rng << 13;
+    Rng ^= Rng >> 7;
+    Rng ^= Rng << 17;
+    return (u32)(Rng >> 16);
+}
+
+/* Returns 1 if the read is off the model or went backwards */
+static int Read(u64 *Last)
+{
+    u64 Value;
+    u64 Truth;
+    int Bad;
+
+    Access = 0;
+    Reading = 1;
+    Value = Clock64_Now(&Clock);
+    Reading = 0;
+
+    /* One cycle ahead on the reload cycle, see clock64.h */
+    Truth = Start + (TcrTime - StartTime);
+    Bad = (Value < Truth) || (Value > Truth + 1U) || (Value < *Last);
+    if (Bad) {
+        fprintf(stderr, "read %llu (0x%016llX), counter at 0x%016llX, last "
+                "0x%016llX; rollover before access %d%+d, ISR after %d%s\n",
+                (unsigned long long)Value, (unsigned long long)Value,
+                (unsigned long long)Truth, (unsigned long long)*Last,
+                (int)WrapAt, (int)WrapOffset, (int)IsrAt,
+                Masked ? ", masked" : "");
+    }
+    *Last = Value;
+    return Bad;
+}
+
+int main(int argc, char **argv)
+{
+    u64 Reads = (argc > 1) ? strtoull(argv[1], NULL, 0) : 2000000U;
+    u64 Last = 0;
+    u64 Done = 0;
+    u64 Errors = 0;
+    s32 Offset;
+    u32 Wrap;
+    u32 Isr;
+    u32 Mask;
+
+    Rng = (argc > 2) ? strtoull(argv[2], NULL, 0) : 0x94D049BB133111EBULL;
+    if (Rng == 0) {
+        Rng = 1;
+    }
+
+    /* A few cycles before the epoch rolls over, high epoch bits set */
+    Start = 0x7FFFFFFFFFFFFF00ULL;
+    SimTmr_Reset();
+    Clock64_Initialize(&Clock, WRAP_BASE, SIM_CLOCK_HZ, NULL, NULL);
+    Clock64_Start(&Clock, Start);
+
+    /* Every rollover point against every ISR point */
+    for (Mask = 0; Mask < 2U; Mask++) {
+        for (Wrap = 0; Wrap < WRAP_POINTS; Wrap++) {
+            for (Offset = -(s32)WRAP_NEAR; Offset <= (s32)WRAP_NEAR; Offset++) {
+                for (Isr = 0; Isr <= WRAP_POINTS; Isr++) {
+                    Masked = (int)Mask;
+                    WrapAt = Wrap;
+                    WrapOffset = Offset * (s32)SIM_MMIO_CYCLES / 4;
+                    IsrAt = (Isr < WRAP_POINTS) ? Isr : WRAP_NONE;
+                    Errors += (u64)Read(&Last);
+                    Service();
+                    Done++;
+                }
+            }
+        }
+    }
+
+    /* Then at random, sometimes leaving a rollover pending between reads */
+    while (Done < Reads) {
+        Masked = ((Random() % 4U) == 0);
+        WrapAt = ((Random() % 2U) == 0) ? (Random() % WRAP_POINTS) : WRAP_NONE;
+        WrapOffset = (s32)(Random() % (4U * SIM_MMIO_CYCLES)) -
+                     (s32)(2U * SIM_MMIO_CYCLES);
+        IsrAt = Random() % (WRAP_POINTS + 1U);
+        if (IsrAt == WRAP_POINTS) {
+            IsrAt = WRAP_NONE;
+        }
+        Now += Random() % 1000U;
+        Errors += (u64)Read(&Last);
+        if (!Masked || ((Random() % 2U) == 0)) {
+            Service();
+        }
+        Done++;
+        if (Errors > 10U) {
+            break;
+        }
+    }
+
+    printf("%llu reads, %u forced rollovers, epoch now %u, clock at "
+           "0x%016llX\n", (unsigned long long)Done, Wraps, Clock.Epoch,
+           (unsigned long long)Last);
+    if (Errors != 0) {
+        fprintf(stderr, "FAILED: %llu read(s) off the counter\n",
+                (unsigned long long)Errors);
+        return 1;
+    }
+    printf("no torn reads, none out of order\n");
+    return 0;
+}
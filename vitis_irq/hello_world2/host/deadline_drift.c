@@ -0,0 +1,243 @@
+/******************************************************************************
+ * Host check of the deadline timer (../src/deadline.c) over a long run
+ *
+ * The ISR runs against the AXI timer register model (sim_tmrctr.c) on a
+ * virtual clock, with the PS global timer 10 ppm fast against it. Each
+ * run starts a random time after T0INT rises:
+ *   - mostly a few hundred cycles, as an ISR would
+ *   - close to the next reload, around the TLR write guard, or with the
+ *     reload falling between the T0INT ack and the TCR read
+ *   - one to a few periods late, and now and then held up for thousands
+ *     of periods
+ * and the period is changed at random in between.
+ *
+ * An independent model follows every reload from the TLR writes the ISR
+ * makes. After each run the ISR must have counted exactly the expiries
+ * up to its TCR read, the misses among them, and its deadline must be
+ * the time of the last one - so over the whole run there is no drift at
+ * all, not even one cycle.
+ *
+ *   deadline_drift [periods] [seed]
+ ******************************************************************************/
+
+#include "deadline.h"
+#include "sim.h"
+#include "xtime_l.h"
+#include "xil_printf.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DRIFT_BASE          0x80000000U
+#define DRIFT_PS_PPM        10U
+#define DRIFT_MIN_PERIOD    (4U * DL_GUARD_CYCLES)
+#define DRIFT_MAX_PERIOD    200000U
+#define DRIFT_MAX_STALL     20000U      /* Periods, well inside 1 / (2 ppm) */
+
+#define TMR_TCSR            0x0U
+#define TMR_TLR             0x4U
+#define TMR_TCR             0x8U
+#define TCSR_LOAD           0x020U
+#define TCSR_ENT            0x080U
+
+static DlTimer Timer;
+static u64 Clock;
+static u64 Rng;
+
+/* Model: every reload, from the TLR writes */
+static int ModelRunning;
+static u32 ModelTlr;
+static u64 ModelOrigin;     /* Deadline 0 */
+static u64 ModelExpiry;     /* Last expiry */
+static u64 ModelInterval;   /* Interval that started at ModelExpiry */
+static u64 ModelCount;
+
+/* Model state at the ISR's TCR read */
+static u64 SeenExpiry;
+static u64 SeenCount;
+
+static u64 Handled;
+
+/* DlTimer_Report() is not used here */
+void xil_printf(const char *Format, ...)
+{
+    va_list Args;
+
+    va_start(Args, Format);
+    vprintf(Format, Args);
+    va_end(Args);
+}
+
+void XTime_GetTime(XTime *Xtime_Global)
+{
+    *Xtime_Global = Clock + (Clock / 1000000U) * DRIFT_PS_PPM;
+}
+
+/* Expiries up to and including Now */
+static void ModelAdvance(u64 Now)
+{
+    u64 Periods;
+
+    if (!ModelRunning || ((ModelExpiry + ModelInterval) > Now)) {
+        return;
+    }
+    ModelExpiry += ModelInterval;
+    ModelCount++;
+    ModelInterval = (u64)ModelTlr + 2U;
+    Periods = (Now - ModelExpiry) / ModelInterval;
+    ModelExpiry += Periods * ModelInterval;
+    ModelCount += Periods;
+}
+
+u32 Sim_Read32(UINTPTR Addr)
+{
+    u32 Offset = (u32)(Addr - DRIFT_BASE);
+    u32 Value;
+
+    Clock += SIM_MMIO_CYCLES;
+    Value = SimTmr_Read(Offset, Clock);
+    if (Offset == TMR_TCR) {
+        ModelAdvance(Clock);
+        SeenExpiry = ModelExpiry;
+        SeenCount = ModelCount;
+    }
+    return Value;
+}
+
+void Sim_Write32(UINTPTR Addr, u32 Value)
+{
+    u32 Offset = (u32)(Addr - DRIFT_BASE);
+
+    Clock += SIM_MMIO_CYCLES;
+    ModelAdvance(Clock);
+    if (Offset == TMR_TLR) {
+        ModelTlr = Value;
+    } else if ((Offset == TMR_TCSR) && !ModelRunning &&
+               ((Value & (TCSR_ENT | TCSR_LOAD)) == TCSR_ENT)) {
+        /* Counting from TLR now, the first expiry TLR + 1 cycles on */
+        ModelRunning = 1;
+        ModelOrigin = Clock - 1U;
+        ModelExpiry = ModelOrigin;
+        ModelInterval = (u64)ModelTlr + 2U;
+    }
+    SimTmr_Write(Offset, Value, Clock);
+}
+
+static u32 Random(void)
+{
+    Rng ^= Rng << 13;
+    Rng ^= Rng >> 7;
+    Rng ^= Rng << 17;
+    return (u32)(Rng >> 16);
+}
+
+/* Cycles from T0INT rising to the ISR running, with Period running now
+ * and Next queued after it
+ */
+static u64 Lateness(u32 Period, u32 Next)
+{
+    u32 Pick = Random() % 10000U;
+
+    if (Pick < 9000U) {
+        return 40U + (Random() % 400U);
+    }
+    if (Pick < 9300U) {
+        /* Around the TLR write guard before the next reload */
+        return Period - 2U * DL_GUARD_CYCLES +
+               (Random() % (2U * DL_GUARD_CYCLES));
+    }
+    if (Pick < 9600U) {
+        /* The next reload lands inside the ISR's own accesses */
+        return Period - (Random() % (8U * SIM_MMIO_CYCLES));
+    }
+    if (Pick < 9990U) {
+        return (u64)Period + (Random() % (4U * Period));
+    }
+    /* Mostly Next intervals, the ppm error grows with their number */
+    if (Next < Period) {
+        Period = Next;
+    }
+    return (u64)Period * (1U + (Random() % DRIFT_MAX_STALL)) +
+           (Random() % Period);
+}
+
+static void Handler(void *CallBackRef, u64 Deadline)
+{
+    (void)CallBackRef;
+    (void)Deadline;
+    Handled++;
+}
+
+int main(int argc, char **argv)
+{
+    u64 Periods = (argc > 1) ? strtoull(argv[1], NULL, 0) : 1000000000U;
+    u64 Runs = 0;
+    u64 Missed = 0;
+    u64 Counted = 0;
+    u64 Errors = 0;
+    u64 Next;
+
+    Rng = (argc > 2) ? strtoull(argv[2], NULL, 0) : 0xD1B54A32D192ED03ULL;
+    if (Rng == 0) {
+        Rng = 1;
+    }
+
+    SimTmr_Reset();
+    DlTimer_Initialize(&Timer, DRIFT_BASE, SIM_CLOCK_HZ, Handler, NULL);
+    DlTimer_Start(&Timer, 100000U);
+
+    while (Timer.Expiries < Periods) {
+        Next = SimTmr_NextEvent(Clock);
+        if (Next == SIM_NO_EVENT) {
+            fprintf(stderr, "timer stopped after %u expiries\n",
+                    Timer.Expiries);
+            return 1;
+        }
+        if (Next > Clock) {
+            Clock = Next;
+        }
+        Clock += Lateness(Timer.Period, Timer.NextPeriod);
+        SeenCount = ModelCount;
+        DlTimer_InterruptHandler(&Timer);
+        Runs++;
+
+        if (SeenCount > Counted) {
+            Missed += SeenCount - Counted - 1U;
+            Counted = SeenCount;
+        }
+        if ((Timer.Expiries != SeenCount) || (Timer.Missed != Missed) ||
+            ((ModelOrigin + Timer.Deadline) != SeenExpiry)) {
+            if (Errors == 0) {
+                fprintf(stderr, "run %llu: %u expiries (%u missed), "
+                        "deadline %+lld cycles; model %llu (%llu missed)\n",
+                        (unsigned long long)Runs, Timer.Expiries,
+                        Timer.Missed,
+                        (long long)(ModelOrigin + Timer.Deadline -
+                                    SeenExpiry),
+                        (unsigned long long)SeenCount,
+                        (unsigned long long)Missed);
+            }
+            Errors++;
+            Counted = Timer.Expiries;
+            Missed = Timer.Missed;
+        }
+
+        if ((Random() % 64U) == 0) {
+            DlTimer_SetPeriod(&Timer, DRIFT_MIN_PERIOD + (Random() %
+                              (DRIFT_MAX_PERIOD - DRIFT_MIN_PERIOD)));
+        }
+    }
+
+    printf("%u periods in %llu s of timer time: %llu ISR runs, %u missed, "
+           "%llu handler calls\n", Timer.Expiries,
+           (unsigned long long)(Timer.Deadline / SIM_CLOCK_HZ),
+           (unsigned long long)Runs, Timer.Missed,
+           (unsigned long long)Handled);
+    if (Errors != 0) {
+        fprintf(stderr, "FAILED: %llu run(s) off the model\n",
+                (unsigned long long)Errors);
+        return 1;
+    }
+    printf("every expiry counted, deadline on the last reload to the cycle\n");
+    return 0;
+}
@@ -0,0 +1,178 @@
+/******************************************************************************
+ * Host stress run of the event queue (../src/evtq.c)
+ *
+ * Producer threads stand in for interrupt sources and post as fast as
+ * they can, each with its own event type and a running sequence number
+ * that only advances on an accepted post. The main thread drains in
+ * batches, as the main loop does, and checks the following:
+ *   - each producer's events arrive in order, with no gaps and no
+ *     repeats
+ *   - the events received plus the posts refused equal the posts
+ *     attempted
+ *
+ *   evtq_stress [producers] [posts per producer]
+ ******************************************************************************/
+
+#include "evtq.h"
+#include "xstatus.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define STRESS_MAX_PRODUCERS    8U
+#define STRESS_BATCH            16U
+
+typedef struct {
+    pthread_t Thread;
+    u16 Id;
+    u32 Posts;          /* Attempted */
+    u32 Accepted;
+    u32 Refused;
+    u32 Expected;       /* Next sequence number the consumer wants */
+    u32 Received;
+} Producer;
+
+static EvtQ Queue;
+static Producer Producers[STRESS_MAX_PRODUCERS];
+static volatile int Go;
+
+static void *ProducerMain(void *Arg)
+{
+    Producer *ProducerPtr = (Producer *)Arg;
+    u32 i;
+
+    while (!__atomic_load_n(&Go, __ATOMIC_ACQUIRE)) {
+        sched_yield();
+    }
+    /* The consumer polls the counts to see when the producers are done */
+    for (i = 0; i < ProducerPtr->Posts; i++) {
+        if (EvtQ_Post(&Queue, ProducerPtr->Id, 0,
+                      ProducerPtr->Accepted) == XST_SUCCESS) {
+            __atomic_store_n(&ProducerPtr->Accepted,
+                             ProducerPtr->Accepted + 1U, __ATOMIC_RELAXED);
+        } else {
+            __atomic_store_n(&ProducerPtr->Refused,
+                             ProducerPtr->Refused + 1U, __ATOMIC_RELAXED);
+            /* Let the consumer catch up, an interrupt source would
+             * not fire again at once either */
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/* Returns the number of ordering errors in the batch */
+static u32 Check(const EvtQEvent *Batch, u32 Count, u32 NumProducers)
+{
+    Producer *ProducerPtr;
+    u32 Errors = 0;
+    u32 i;
+
+    for (i = 0; i < Count; i++) {
+        if (Batch[i].Type >= NumProducers) {
+            Errors++;
+            continue;
+        }
+        ProducerPtr = &Producers[Batch[i].Type];
+        if (Batch[i].Data != ProducerPtr->Expected) {
+            if (Errors == 0) {
+                fprintf(stderr, "producer %u: got %u, expected %u\n",
+                        Batch[i].Type, Batch[i].Data, ProducerPtr->Expected);
+            }
+            Errors++;
+        }
+        ProducerPtr->Expected = Batch[i].Data + 1U;
+        ProducerPtr->Received++;
+    }
+    return Errors;
+}
+
+int main(int argc, char **argv)
+{
+    u32 NumProducers = (argc > 1) ? (u32)atoi(argv[1]) : 4U;
+    u32 Posts = (argc > 2) ? (u32)atoi(argv[2]) : 1000000U;
+    EvtQEvent Batch[STRESS_BATCH];
+    u32 Batches[STRESS_BATCH + 1U] = {0};
+    u32 Running;
+    u32 Count;
+    u32 Errors = 0;
+    u64 Attempted = 0;
+    u64 Received = 0;
+    u64 Refused = 0;
+    u32 i;
+
+    if ((NumProducers == 0) || (NumProducers > STRESS_MAX_PRODUCERS)) {
+        fprintf(stderr, "1 to %u producers\n", STRESS_MAX_PRODUCERS);
+        return 2;
+    }
+
+    EvtQ_Init(&Queue);
+    for (i = 0; i < NumProducers; i++) {
+        Producers[i].Id = (u16)i;
+        Producers[i].Posts = Posts;
+        pthread_create(&Producers[i].Thread, NULL, ProducerMain,
+                       &Producers[i]);
+    }
+    __atomic_store_n(&Go, 1, __ATOMIC_RELEASE);
+
+    /* Drain until every producer is done and the queue is empty */
+    do {
+        Running = 0;
+        for (i = 0; i < NumProducers; i++) {
+            Running += (__atomic_load_n(&Producers[i].Accepted,
+                                        __ATOMIC_RELAXED) +
+                        __atomic_load_n(&Producers[i].Refused,
+                                        __ATOMIC_RELAXED)) < Posts;
+        }
+        if (EvtQ_IsEmpty(&Queue)) {
+            sched_yield();
+        }
+        while ((Count = EvtQ_Drain(&Queue, Batch, STRESS_BATCH)) != 0) {
+            Batches[Count]++;
+            Errors += Check(Batch, Count, NumProducers);
+        }
+    } while (Running != 0);
+
+    for (i = 0; i < NumProducers; i++) {
+        pthread_join(Producers[i].Thread, NULL);
+    }
+    while ((Count = EvtQ_Drain(&Queue, Batch, STRESS_BATCH)) != 0) {
+        Batches[Count]++;
+        Errors += Check(Batch, Count, NumProducers);
+    }
+
+    for (i = 0; i < NumProducers; i++) {
+        Attempted += Producers[i].Posts;
+        Received += Producers[i].Received;
+        Refused += Producers[i].Refused;
+        printf("producer %u: %u posted, %u received, %u refused\n", i,
+               Producers[i].Accepted, Producers[i].Received,
+               Producers[i].Refused);
+        if (Producers[i].Received != Producers[i].Accepted) {
+            Errors++;
+        }
+    }
+    printf("batches:");
+    for (i = 1; i <= STRESS_BATCH; i++) {
+        printf(" %u", Batches[i]);
+    }
+    printf("\nhigh water %u of %u slots\n", Queue.HighWater, EVTQ_DEPTH);
+
+    if (EvtQ_TakeOverflows(&Queue) != Refused) {
+        fprintf(stderr, "Overflows does not match the refused posts\n");
+        Errors++;
+    }
+    if ((Received + Refused) != Attempted) {
+        fprintf(stderr, "%llu event(s) unaccounted for\n",
+                (unsigned long long)(Attempted - Received - Refused));
+        Errors++;
+    }
+    if (Errors != 0) {
+        fprintf(stderr, "FAILED: %u error(s)\n", Errors);
+        return 1;
+    }
+    printf("%llu events, %llu refused, all in order\n",
+           (unsigned long long)Received, (unsigned long long)Refused);
+    return 0;
+}
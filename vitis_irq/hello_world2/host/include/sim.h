@@ -0,0 +1,102 @@
+/******************************************************************************
+ * hello_world2 host simulation
+ *
+ * The application sources are built unchanged against the shim headers
+ * in this directory. Every register access goes through Sim_Read32() /
+ * Sim_Write32() into the device models, and all time - the AXI timer
+ * clock, the global timer behind XTime_GetTime() and the cycle counter -
+ * is one virtual 100 MHz clock (SimTime).
+ *
+ * The virtual clock advances by a fixed cost per register access, jumps
+ * to the next device event on WFI/WFE, and is nudged forward by a host
+ * interval timer so that pure spin loops still make progress. Device
+ * interrupts are delivered to the handler registered with
+ * XSetupInterruptSystem() whenever the CPU is unmasked and the
+ * interrupt is above the GIC running priority: a handler that unmasks
+ * IRQ is preempted only by a higher priority.
+ ******************************************************************************/
+
+#ifndef SIM_H_
+#define SIM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+/* Virtual clock, shared by the AXI timer and the global timer */
+#define SIM_CLOCK_HZ            100000000U
+
+/* Cost model, in virtual clock cycles */
+#ifndef SIM_MMIO_CYCLES
+#define SIM_MMIO_CYCLES         15U     /* One uncached PL register access */
+#endif
+#ifndef SIM_IRQ_ENTRY_CYCLES
+#define SIM_IRQ_ENTRY_CYCLES    40U     /* Exception entry, GIC ack, wrapper */
+#endif
+#ifndef SIM_IRQ_EXIT_CYCLES
+#define SIM_IRQ_EXIT_CYCLES     20U     /* EOI and exception return */
+#endif
+#ifndef SIM_FIQ_ENTRY_CYCLES
+#define SIM_FIQ_ENTRY_CYCLES    45U     /* Exception entry, 27 pairs saved */
+#endif
+/* Largest step taken per host interval tick while the CPU spins */
+#ifndef SIM_SPIN_QUANTUM_CYCLES
+#define SIM_SPIN_QUANTUM_CYCLES 1000000U
+#endif
+/* usleep() step while a line is up that the CPU cannot take yet */
+#ifndef SIM_SLEEP_POLL_CYCLES
+#define SIM_SLEEP_POLL_CYCLES   100U
+#endif
+
+#define SIM_NO_EVENT            (~(u64)0)
+
+/* CPU side, used by the shim headers */
+u32 Sim_Read32(UINTPTR Addr);
+void Sim_Write32(UINTPTR Addr, u32 Value);
+void Sim_AxiCounts(u64 *Reads, u64 *Writes);
+void Sim_IrqMask(void);
+void Sim_IrqUnmask(void);
+void Sim_ExceptionMask(u32 Mask);
+void Sim_ExceptionUnmask(u32 Mask);
+void Sim_WaitForInterrupt(void);
+void Sim_WaitForEvent(void);
+void Sim_SendEvent(void);
+void Sim_Sleep(u64 Cycles);
+u64 Sim_Now(void);
+u64 Sim_ReadSysReg(const char *Name);
+void Sim_WriteSysReg(const char *Name, u64 Value);
+
+/* Second core: takes the interrupts the GIC distributor targets at it */
+int Sim_StartCore1(void (*Entry)(void *), void *Arg);
+
+/* Interrupt controller */
+void Sim_ConnectIrq(u32 IntrId, void (*Handler)(void *), void *Ref,
+                    u8 Priority);
+void Sim_DisconnectIrq(u32 IntrId);
+void Sim_EnableIrq(u32 IntrId, int Enable);
+
+/* FIQ line of core 0: one Group 0 source, its vector calls Entry */
+void Sim_ConnectFiq(u32 IntrId, void (*Entry)(void));
+void Sim_DisconnectFiq(void);
+
+/* AXI timer model (sim_tmrctr.c) */
+void SimTmr_Reset(void);
+u32 SimTmr_Read(u32 Offset, u64 Now);
+void SimTmr_Write(u32 Offset, u32 Value, u64 Now);
+int SimTmr_IrqLine(u64 Now);
+u64 SimTmr_NextEvent(u64 Now);
+
+/* AXI GPIO model with a scripted, bouncing push button (sim_gpio.c) */
+void SimGpio_Reset(void);
+u32 SimGpio_Read(u32 Offset, u64 Now);
+void SimGpio_Write(u32 Offset, u32 Value, u64 Now);
+int SimGpio_IrqLine(u64 Now);
+u64 SimGpio_NextEvent(u64 Now);
+u64 SimGpio_Edges(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
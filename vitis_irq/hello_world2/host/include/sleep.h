@@ -0,0 +1,13 @@
+/******************************************************************************
+ * Host simulation shim - sleeping advances the simulated clock
+ ******************************************************************************/
+
+#ifndef SLEEP_H
+#define SLEEP_H
+
+#include "sim.h"
+
+#define usleep(Us)  Sim_Sleep((u64)(Us) * 100U)
+#define sleep(S)    Sim_Sleep((u64)(S) * 100000000U)
+
+#endif
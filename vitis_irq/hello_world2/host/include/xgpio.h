@@ -0,0 +1,65 @@
+/******************************************************************************
+ * Host simulation shim - AXI GPIO driver (subset of xgpio v4.x)
+ *
+ * Register definitions match xgpio_l.h; the functions in xgpio.c
+ * follow the register sequences of the real driver so the model sees
+ * the same accesses the hardware does.
+ ******************************************************************************/
+
+#ifndef XGPIO_H
+#define XGPIO_H
+
+#include "xil_types.h"
+#include "xil_io.h"
+
+#define XGPIO_DATA_OFFSET           0x0U
+#define XGPIO_TRI_OFFSET            0x4U
+#define XGPIO_DATA2_OFFSET          0x8U
+#define XGPIO_TRI2_OFFSET           0xCU
+#define XGPIO_GIE_OFFSET            0x11CU
+#define XGPIO_ISR_OFFSET            0x120U
+#define XGPIO_IER_OFFSET            0x128U
+
+#define XGPIO_CHAN_OFFSET           8U
+
+#define XGPIO_GIE_GINTR_ENABLE_MASK 0x80000000U
+#define XGPIO_IR_MASK               0x3U
+#define XGPIO_IR_CH1_MASK           0x1U
+#define XGPIO_IR_CH2_MASK           0x2U
+
+#define XGpio_ReadReg(BaseAddress, RegOffset) \
+    Xil_In32((BaseAddress) + (RegOffset))
+
+#define XGpio_WriteReg(BaseAddress, RegOffset, Data) \
+    Xil_Out32((BaseAddress) + (RegOffset), (Data))
+
+typedef struct {
+    char *Name;
+    UINTPTR BaseAddress;
+    int InterruptPresent;
+    int IsDual;
+    u32 IntrId;
+    UINTPTR IntrParent;
+} XGpio_Config;
+
+typedef struct {
+    UINTPTR BaseAddress;
+    u32 IsReady;
+    int InterruptPresent;
+    int IsDual;
+} XGpio;
+
+int XGpio_Initialize(XGpio *InstancePtr, UINTPTR BaseAddress);
+XGpio_Config *XGpio_LookupConfig(UINTPTR BaseAddress);
+void XGpio_SetDataDirection(XGpio *InstancePtr, unsigned Channel,
+                            u32 DirectionMask);
+u32 XGpio_DiscreteRead(XGpio *InstancePtr, unsigned Channel);
+
+void XGpio_InterruptGlobalEnable(XGpio *InstancePtr);
+void XGpio_InterruptGlobalDisable(XGpio *InstancePtr);
+void XGpio_InterruptEnable(XGpio *InstancePtr, u32 Mask);
+void XGpio_InterruptDisable(XGpio *InstancePtr, u32 Mask);
+void XGpio_InterruptClear(XGpio *InstancePtr, u32 Mask);
+u32 XGpio_InterruptGetStatus(XGpio *InstancePtr);
+
+#endif
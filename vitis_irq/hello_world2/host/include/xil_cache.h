@@ -0,0 +1,17 @@
+/******************************************************************************
+ * Host simulation shim - caches are not modelled
+ ******************************************************************************/
+
+#ifndef XIL_CACHE_H
+#define XIL_CACHE_H
+
+#define Xil_DCacheEnable()
+#define Xil_DCacheDisable()
+#define Xil_ICacheEnable()
+#define Xil_ICacheDisable()
+#define Xil_DCacheFlush()
+#define Xil_DCacheFlushRange(Addr, Len)
+#define Xil_DCacheInvalidateRange(Addr, Len)
+#define Xil_ICacheInvalidate()
+
+#endif
@@ -0,0 +1,23 @@
+/******************************************************************************
+ * Host simulation shim - CPU interrupt mask
+ ******************************************************************************/
+
+#ifndef XIL_EXCEPTION_H
+#define XIL_EXCEPTION_H
+
+#include "xil_types.h"
+#include "sim.h"
+
+typedef void (*Xil_ExceptionHandler)(void *Data);
+typedef void (*Xil_InterruptHandler)(void *Data);
+
+#define XIL_EXCEPTION_IRQ       0x80U
+#define XIL_EXCEPTION_FIQ       0x40U
+#define XIL_EXCEPTION_ALL       (XIL_EXCEPTION_IRQ | XIL_EXCEPTION_FIQ)
+
+#define Xil_ExceptionEnableMask(Mask)   Sim_ExceptionUnmask(Mask)
+#define Xil_ExceptionDisableMask(Mask)  Sim_ExceptionMask(Mask)
+#define Xil_ExceptionEnable()           Sim_IrqUnmask()
+#define Xil_ExceptionDisable()          Sim_IrqMask()
+
+#endif
@@ -0,0 +1,21 @@
+/******************************************************************************
+ * Host simulation shim - register access goes to the device models
+ ******************************************************************************/
+
+#ifndef XIL_IO_H
+#define XIL_IO_H
+
+#include "xil_types.h"
+#include "sim.h"
+
+static inline u32 Xil_In32(UINTPTR Addr)
+{
+    return Sim_Read32(Addr);
+}
+
+static inline void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+    Sim_Write32(Addr, Value);
+}
+
+#endif
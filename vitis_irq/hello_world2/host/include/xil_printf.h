@@ -0,0 +1,10 @@
+/******************************************************************************
+ * Host simulation shim - xil_printf goes to stdout
+ ******************************************************************************/
+
+#ifndef XIL_PRINTF_H
+#define XIL_PRINTF_H
+
+void xil_printf(const char *Format, ...) __attribute__((format(printf, 1, 2)));
+
+#endif
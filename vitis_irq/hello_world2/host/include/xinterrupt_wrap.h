@@ -0,0 +1,23 @@
+/******************************************************************************
+ * Host simulation shim - SDT interrupt wrapper
+ ******************************************************************************/
+
+#ifndef XINTERRUPT_WRAP_H
+#define XINTERRUPT_WRAP_H
+
+#include "xil_types.h"
+#include "xscugic.h"
+
+#define XINTERRUPT_DEFAULT_PRIORITY     0xA0U
+
+/* IntrId to GIC ID; the host configs carry plain SPI numbers */
+#define XGet_IntrId(IntrId)             ((IntrId) & 0xFFFU)
+#define XGet_IntrOffset(IntrId)         32U
+
+int XSetupInterruptSystem(void *DriverInstance, void *IntrHandler, u32 IntrId,
+                          UINTPTR IntrParent, u16 Priority);
+void XDisconnectInterruptCntrl(u32 IntrId, UINTPTR IntrParent);
+int XEnableIntrId(u32 IntrId, UINTPTR IntrParent);
+int XDisableIntrId(u32 IntrId, UINTPTR IntrParent);
+
+#endif
@@ -0,0 +1,26 @@
+/******************************************************************************
+ * Host simulation shim - the ZUBoard 1CG design as seen by hello_world2
+ ******************************************************************************/
+
+#ifndef XPARAMETERS_H
+#define XPARAMETERS_H
+
+/* axi_timer_0, IRQ 89 on the GIC */
+#define XPAR_XTMRCTR_0_BASEADDR         0x80020000U
+#define XPAR_XTMRCTR_0_CLOCK_FREQUENCY  100000000U
+#define XPAR_FABRIC_XTMRCTR_0_INTR      89U
+
+/* axi_gpio_0 (push button, IRQ 104 on pl_ps_irq1) and axi_gpio_1 (RGB LED) */
+#define XPAR_XGPIO_0_BASEADDR           0x80000000U
+#define XPAR_XGPIO_0_INTERRUPT_PRESENT  1
+#define XPAR_XGPIO_0_IS_DUAL            0
+#define XPAR_FABRIC_XGPIO_0_INTR        104U
+#define XPAR_XGPIO_1_BASEADDR           0x80010000U
+
+#define XPAR_SCUGIC_SINGLE_DEVICE_ID    0U
+#define XPAR_SCUGIC_0_DIST_BASEADDR     0xF9010000U
+#define XPAR_SCUGIC_0_CPU_BASEADDR      0xF9020000U
+
+#define XPAR_CPU_CORE_CLOCK_FREQ_HZ     1333333008U
+
+#endif
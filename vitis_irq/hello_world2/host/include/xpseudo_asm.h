@@ -0,0 +1,21 @@
+/******************************************************************************
+ * Host simulation shim - barrier, wait and system register instructions
+ ******************************************************************************/
+
+#ifndef XPSEUDO_ASM_H
+#define XPSEUDO_ASM_H
+
+#include "sim.h"
+
+#define dsb()   __sync_synchronize()
+#define dmb()   __sync_synchronize()
+#define isb()   __sync_synchronize()
+#define wfi()   Sim_WaitForInterrupt()
+#define wfe()   Sim_WaitForEvent()
+#define sev()   Sim_SendEvent()
+
+/* System registers, only MPIDR_EL1, SPSR_EL3 and ELR_EL3 are modelled */
+#define mfcp(reg)       Sim_ReadSysReg(#reg)
+#define mtcp(reg, val)  Sim_WriteSysReg(#reg, (u64)(val))
+
+#endif
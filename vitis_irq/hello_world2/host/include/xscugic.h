@@ -0,0 +1,17 @@
+/******************************************************************************
+ * Host simulation shim - GIC driver types
+ ******************************************************************************/
+
+#ifndef XSCUGIC_H
+#define XSCUGIC_H
+
+#include "xil_types.h"
+#include "xil_exception.h"
+
+typedef void (*XInterruptHandler)(void *InstancePtr);
+
+typedef struct {
+    u32 IsReady;
+} XScuGic;
+
+#endif
@@ -0,0 +1,93 @@
+/******************************************************************************
+ * Host simulation shim - AXI timer driver (subset of xtmrctr v4.x)
+ *
+ * Register definitions match xtmrctr_l.h; the functions in xtmrctr.c
+ * follow the register sequences of the real driver so the model sees
+ * the same accesses the hardware does.
+ ******************************************************************************/
+
+#ifndef XTMRCTR_H
+#define XTMRCTR_H
+
+#include "xil_types.h"
+#include "xil_io.h"
+
+#define XTC_DEVICE_TIMER_COUNT      2U
+#define XTC_TIMER_COUNTER_OFFSET    16U
+
+#define XTC_TCSR_OFFSET             0U
+#define XTC_TLR_OFFSET              4U
+#define XTC_TCR_OFFSET              8U
+
+#define XTC_CSR_CASC_MASK           0x00000800U
+#define XTC_CSR_ENABLE_ALL_MASK     0x00000400U
+#define XTC_CSR_ENABLE_PWM_MASK     0x00000200U
+#define XTC_CSR_INT_OCCURED_MASK    0x00000100U
+#define XTC_CSR_ENABLE_TMR_MASK     0x00000080U
+#define XTC_CSR_ENABLE_INT_MASK     0x00000040U
+#define XTC_CSR_LOAD_MASK           0x00000020U
+#define XTC_CSR_AUTO_RELOAD_MASK    0x00000010U
+#define XTC_CSR_EXT_CAPTURE_MASK    0x00000008U
+#define XTC_CSR_EXT_GENERATE_MASK   0x00000004U
+#define XTC_CSR_DOWN_COUNT_MASK     0x00000002U
+#define XTC_CSR_CAPTURE_MODE_ENABLE_MASK 0x00000001U
+
+#define XTC_CASCADE_MODE_OPTION     0x00000080UL
+#define XTC_ENABLE_ALL_OPTION       0x00000040UL
+#define XTC_DOWN_COUNT_OPTION       0x00000020UL
+#define XTC_CAPTURE_MODE_OPTION     0x00000010UL
+#define XTC_INT_MODE_OPTION         0x00000008UL
+#define XTC_AUTO_RELOAD_OPTION      0x00000004UL
+#define XTC_EXT_COMPARE_OPTION      0x00000002UL
+
+#define XTmrCtr_ReadReg(BaseAddress, TmrCtrNumber, RegOffset) \
+    Xil_In32((BaseAddress) + XTC_TIMER_COUNTER_OFFSET * (TmrCtrNumber) + \
+             (RegOffset))
+
+#define XTmrCtr_WriteReg(BaseAddress, TmrCtrNumber, RegOffset, ValueToWrite) \
+    Xil_Out32((BaseAddress) + XTC_TIMER_COUNTER_OFFSET * (TmrCtrNumber) + \
+              (RegOffset), (ValueToWrite))
+
+typedef void (*XTmrCtr_Handler)(void *CallBackRef, u8 TmrCtrNumber);
+
+typedef struct {
+    char *Name;
+    UINTPTR BaseAddress;
+    u32 SysClockFreqHz;
+    u16 IntrId;
+    UINTPTR IntrParent;
+} XTmrCtr_Config;
+
+typedef struct {
+    u32 Interrupts;
+} XTmrCtrStats;
+
+typedef struct {
+    XTmrCtr_Config Config;
+    XTmrCtrStats Stats;
+    UINTPTR BaseAddress;
+    u32 IsReady;
+    u32 IsStartedTmrCtr0;
+    u32 IsStartedTmrCtr1;
+    XTmrCtr_Handler Handler;
+    void *CallBackRef;
+} XTmrCtr;
+
+int XTmrCtr_Initialize(XTmrCtr *InstancePtr, UINTPTR BaseAddr);
+XTmrCtr_Config *XTmrCtr_LookupConfig(UINTPTR BaseAddress);
+int XTmrCtr_SelfTest(XTmrCtr *InstancePtr, u8 TmrCtrNumber);
+void XTmrCtr_Start(XTmrCtr *InstancePtr, u8 TmrCtrNumber);
+void XTmrCtr_Stop(XTmrCtr *InstancePtr, u8 TmrCtrNumber);
+u32 XTmrCtr_GetValue(XTmrCtr *InstancePtr, u8 TmrCtrNumber);
+void XTmrCtr_SetResetValue(XTmrCtr *InstancePtr, u8 TmrCtrNumber,
+                           u32 ResetValue);
+u32 XTmrCtr_GetCaptureValue(XTmrCtr *InstancePtr, u8 TmrCtrNumber);
+int XTmrCtr_IsExpired(XTmrCtr *InstancePtr, u8 TmrCtrNumber);
+void XTmrCtr_Reset(XTmrCtr *InstancePtr, u8 TmrCtrNumber);
+void XTmrCtr_SetOptions(XTmrCtr *InstancePtr, u8 TmrCtrNumber, u32 Options);
+u32 XTmrCtr_GetOptions(XTmrCtr *InstancePtr, u8 TmrCtrNumber);
+void XTmrCtr_SetHandler(XTmrCtr *InstancePtr, XTmrCtr_Handler FuncPtr,
+                        void *CallBackRef);
+void XTmrCtr_InterruptHandler(void *InstancePtr);
+
+#endif
@@ -0,0 +1,156 @@
+/******************************************************************************
+ * Host stress run of the ISR log ring (../src/isr_log.c)
+ *
+ * One thread stands in for the timer ISR and writes records as fast as
+ * it can, the main thread reads them back as the main loop does. The
+ * producer numbers its accepted records and stamps each one with a
+ * value derived from that number, so the consumer can check:
+ *   - the records arrive in order, with no gaps and no repeats
+ *   - no record is torn: event id, counter and timestamp belong together
+ *   - the records read plus the writes refused equal the writes tried,
+ *     and Dropped counted exactly the refused ones
+ *
+ *   isr_log_stress [writes]
+ ******************************************************************************/
+
+#include "isr_log.h"
+#include "xstatus.h"
+#include "xtime_l.h"
+#include "xil_printf.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static IsrLog Log;
+static volatile int Go;
+static volatile int Done;
+
+/* Written by the producer only; IsrLog_Write() stamps the record with it */
+static XTime NextStamp;
+
+static u32 Writes;
+static u32 Accepted;
+static u32 Refused;
+
+void XTime_GetTime(XTime *Xtime_Global)
+{
+    *Xtime_Global = NextStamp;
+}
+
+/* IsrLog_Drain() is not used here */
+void xil_printf(const char *Format, ...)
+{
+    va_list Args;
+
+    va_start(Args, Format);
+    vprintf(Format, Args);
+    va_end(Args);
+}
+
+/* Timestamp and event id the record with this counter must carry */
+static XTime StampOf(u32 Counter)
+{
+    return ((XTime)Counter << 32) ^ ((XTime)Counter * 0x9E3779B97F4A7C15ULL);
+}
+
+static u16 EventOf(u32 Counter)
+{
+    return (u16)(1U + (Counter % 5U));
+}
+
+static void *IsrMain(void *Arg)
+{
+    u32 i;
+
+    (void)Arg;
+    while (!__atomic_load_n(&Go, __ATOMIC_ACQUIRE)) {
+        sched_yield();
+    }
+    for (i = 0; i < Writes; i++) {
+        NextStamp = StampOf(Accepted);
+        if (IsrLog_Write(&Log, EventOf(Accepted), Accepted) == XST_SUCCESS) {
+            Accepted++;
+        } else {
+            Refused++;
+            /* A full ring means the main loop is behind; the timer
+             * would not expire again at once either */
+            if ((Refused % 64U) == 0) {
+                sched_yield();
+            }
+        }
+    }
+    __atomic_store_n(&Done, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+/* Returns 1 while records keep coming */
+static int ReadAll(u32 *Expected, u32 *Errors)
+{
+    IsrLogRecord Record;
+    int Got = 0;
+
+    while (IsrLog_Read(&Log, &Record) == XST_SUCCESS) {
+        Got = 1;
+        if (Record.Counter != *Expected) {
+            if (*Errors == 0) {
+                fprintf(stderr, "got record %u, expected %u\n",
+                        Record.Counter, *Expected);
+            }
+            (*Errors)++;
+        } else if ((Record.EventId != EventOf(Record.Counter)) ||
+                   (Record.Reserved != 0) ||
+                   (Record.Timestamp != StampOf(Record.Counter))) {
+            if (*Errors == 0) {
+                fprintf(stderr, "record %u torn: event %u, stamp 0x%016llX\n",
+                        Record.Counter, Record.EventId,
+                        (unsigned long long)Record.Timestamp);
+            }
+            (*Errors)++;
+        }
+        *Expected = Record.Counter + 1U;
+    }
+    return Got;
+}
+
+int main(int argc, char **argv)
+{
+    pthread_t Isr;
+    u32 Expected = 0;
+    u32 Errors = 0;
+    u32 Dropped;
+
+    Writes = (argc > 1) ? (u32)atoi(argv[1]) : 10000000U;
+
+    IsrLog_Init(&Log);
+    pthread_create(&Isr, NULL, IsrMain, NULL);
+    __atomic_store_n(&Go, 1, __ATOMIC_RELEASE);
+
+    while (!__atomic_load_n(&Done, __ATOMIC_ACQUIRE)) {
+        if (!ReadAll(&Expected, &Errors)) {
+            sched_yield();
+        }
+    }
+    pthread_join(Isr, NULL);
+    (void)ReadAll(&Expected, &Errors);
+
+    Dropped = Log.Dropped;
+    printf("%u writes: %u read, %u refused, %u counted dropped\n", Writes,
+           Expected, Refused, Dropped);
+    if (Expected != Accepted) {
+        fprintf(stderr, "%u record(s) accepted but never read\n",
+                Accepted - Expected);
+        Errors++;
+    }
+    if ((Dropped != Refused) || ((Accepted + Refused) != Writes)) {
+        fprintf(stderr, "Dropped does not match the refused writes\n");
+        Errors++;
+    }
+    if (Errors != 0) {
+        fprintf(stderr, "FAILED: %u error(s)\n", Errors);
+        return 1;
+    }
+    printf("all in order, none torn\n");
+    return 0;
+}
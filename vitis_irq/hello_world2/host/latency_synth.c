@@ -0,0 +1,212 @@
+/******************************************************************************
+ * Host check of the latency histogram (../src/latency.c) on synthetic TCR
+ *
+ * Each case makes up TCR readings as the probe would see them on ISR
+ * entry for a down-counting timer reloaded with SYNTH_RESET_VALUE,
+ * turns them into latencies the way the probe does and records them.
+ * The same latencies are kept and sorted, and the histogram is checked
+ * against them:
+ *   - every sample landed in the bucket its value selects, or in Overflow
+ *   - min, max and the average are exact
+ *   - each percentile is the upper edge of the bucket holding the sample
+ *     of that rank, clamped to max, and never below that sample
+ *
+ *   latency_synth [seed]
+ ******************************************************************************/
+
+#include "latency.h"
+#include "xil_printf.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SYNTH_RESET_VALUE   100000U
+#define SYNTH_MAX_SAMPLES   100000U
+
+typedef enum {
+    SYNTH_UNIFORM,      /* Anywhere in the bucketed range */
+    SYNTH_TAIL,         /* Tight body, rare long tail into Overflow */
+    SYNTH_EDGES,        /* Only bucket edges, first and last cycle */
+    SYNTH_CONSTANT,
+    SYNTH_OVERFLOW      /* Nothing fits in a bucket */
+} SynthShape;
+
+typedef struct {
+    const char *Name;
+    SynthShape Shape;
+    u32 BucketCycles;
+    u32 Samples;
+} SynthCase;
+
+static const SynthCase Cases[] = {
+    { "uniform",        SYNTH_UNIFORM,  4U,  100000U },
+    { "uniform, wide",  SYNTH_UNIFORM,  64U, 99999U },
+    { "long tail",      SYNTH_TAIL,     4U,  100000U },
+    { "bucket edges",   SYNTH_EDGES,    8U,  1000U },
+    { "constant",       SYNTH_CONSTANT, 4U,  777U },
+    { "one sample",     SYNTH_UNIFORM,  4U,  1U },
+    { "all overflow",   SYNTH_OVERFLOW, 1U,  1000U },
+};
+
+static const struct {
+    const char *Label;
+    u32 Num;
+    u32 Den;
+} Ranks[] = {
+    { "p0.1", 1, 1000 }, { "p50", 50, 100 }, { "p99", 99, 100 },
+    { "p99.9", 999, 1000 }, { "p100", 1, 1 },
+};
+
+static u32 Sorted[SYNTH_MAX_SAMPLES];
+static u64 Rng;
+
+/* LatencyHist_Report() is not used here */
+void xil_printf(const char *Format, ...)
+{
+    va_list Args;
+
+    va_start(Args, Format);
+    vprintf(Format, Args);
+    va_end(Args);
+}
+
+static u32 Random(void)
+{
+    Rng ^= Rng << 13;
+    Rng ^= Rng >> 7;
+    Rng ^= Rng << 17;
+    return (u32)(Rng >> 16);
+}
+
+/* TCR read on ISR entry, Latency cycles after the reload */
+static u32 Tcr(const SynthCase *CasePtr, u32 i)
+{
+    u32 Range = LATENCY_NUM_BUCKETS * CasePtr->BucketCycles;
+    u32 Latency;
+
+    switch (CasePtr->Shape) {
+    case SYNTH_TAIL:
+        Latency = 40U + (Random() % 24U);
+        if ((Random() % 1000U) == 0) {
+            Latency = Range + (Random() % 50000U);
+        }
+        break;
+    case SYNTH_EDGES:
+        Latency = (Random() % LATENCY_NUM_BUCKETS) * CasePtr->BucketCycles;
+        Latency += ((i & 1U) != 0) ? (CasePtr->BucketCycles - 1U) : 0;
+        break;
+    case SYNTH_CONSTANT:
+        Latency = 57U;
+        break;
+    case SYNTH_OVERFLOW:
+        Latency = Range + (Random() % 1000U);
+        break;
+    default:
+        Latency = Random() % Range;
+        break;
+    }
+    return SYNTH_RESET_VALUE - Latency;
+}
+
+static int CompareU32(const void *A, const void *B)
+{
+    u32 X = *(const u32 *)A;
+    u32 Y = *(const u32 *)B;
+
+    return (X > Y) - (X < Y);
+}
+
+/* Returns the number of mismatches */
+static u32 Run(const SynthCase *CasePtr)
+{
+    static LatencyHist Hist;
+    u32 Range = LATENCY_NUM_BUCKETS * CasePtr->BucketCycles;
+    u32 Bucket[LATENCY_NUM_BUCKETS] = {0};
+    u32 Overflow = 0;
+    u64 Sum = 0;
+    u64 Rank;
+    u32 Errors = 0;
+    u32 Latency;
+    u32 Sample;
+    u32 Expect;
+    u32 Got;
+    u32 i;
+
+    LatencyHist_Init(&Hist, CasePtr->BucketCycles);
+    for (i = 0; i < CasePtr->Samples; i++) {
+        /* As the probe: reset value minus the TCR read */
+        Latency = SYNTH_RESET_VALUE - Tcr(CasePtr, i);
+        LatencyHist_Record(&Hist, Latency);
+        Sorted[i] = Latency;
+        Sum += Latency;
+        if (Latency < Range) {
+            Bucket[Latency / CasePtr->BucketCycles]++;
+        } else {
+            Overflow++;
+        }
+    }
+    qsort(Sorted, CasePtr->Samples, sizeof(Sorted[0]), CompareU32);
+
+    for (i = 0; i < LATENCY_NUM_BUCKETS; i++) {
+        if (Hist.Bucket[i] != Bucket[i]) {
+            fprintf(stderr, "  bucket %u: %u, expected %u\n", i,
+                    Hist.Bucket[i], Bucket[i]);
+            Errors++;
+        }
+    }
+    if ((Hist.Overflow != Overflow) || (Hist.Count != CasePtr->Samples) ||
+        (Hist.Min != Sorted[0]) ||
+        (Hist.Max != Sorted[CasePtr->Samples - 1U]) || (Hist.Sum != Sum)) {
+        fprintf(stderr, "  totals: overflow %u/%u count %u min %u/%u "
+                "max %u/%u\n", Hist.Overflow, Overflow, Hist.Count,
+                Hist.Min, Sorted[0], Hist.Max, Sorted[CasePtr->Samples - 1U]);
+        Errors++;
+    }
+
+    printf("%-14s %6u samples, %3u-cycle buckets:", CasePtr->Name,
+           CasePtr->Samples, CasePtr->BucketCycles);
+    for (i = 0; i < sizeof(Ranks) / sizeof(Ranks[0]); i++) {
+        Rank = ((u64)CasePtr->Samples * Ranks[i].Num + Ranks[i].Den - 1U) /
+               Ranks[i].Den;
+        Sample = Sorted[(Rank != 0) ? (Rank - 1U) : 0];
+        if (Sample < Range) {
+            Expect = (Sample / CasePtr->BucketCycles + 1U) *
+                     CasePtr->BucketCycles - 1U;
+            if (Expect > Hist.Max) {
+                Expect = Hist.Max;
+            }
+        } else {
+            Expect = Hist.Max;
+        }
+        Got = LatencyHist_Percentile(&Hist, Ranks[i].Num, Ranks[i].Den);
+        printf(" %s %u", Ranks[i].Label, Got);
+        if ((Got != Expect) || (Got < Sample)) {
+            fprintf(stderr, "\n  %s: %u, expected %u (sample %u)\n",
+                    Ranks[i].Label, Got, Expect, Sample);
+            Errors++;
+        }
+    }
+    printf("\n");
+    return Errors;
+}
+
+int main(int argc, char **argv)
+{
+    u32 Errors = 0;
+    u32 i;
+
+    Rng = (argc > 1) ? strtoull(argv[1], NULL, 0) : 0x2545F4914F6CDD1DULL;
+    if (Rng == 0) {
+        Rng = 1;
+    }
+
+    for (i = 0; i < sizeof(Cases) / sizeof(Cases[0]); i++) {
+        Errors += Run(&Cases[i]);
+    }
+    if (Errors != 0) {
+        fprintf(stderr, "FAILED: %u error(s)\n", Errors);
+        return 1;
+    }
+    printf("all buckets and percentiles match\n");
+    return 0;
+}
@@ -0,0 +1,803 @@
+/******************************************************************************
+ * hello_world2 host simulation - virtual clock, CPU and GIC - see sim.h
+ ******************************************************************************/
+
+#include "sim.h"
+#include "xparameters.h"
+#include "xtime_l.h"
+#include "xstatus.h"
+#include "xil_exception.h"
+#include "platform.h"
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+#define SIM_TMR_BASE        XPAR_XTMRCTR_0_BASEADDR
+#define SIM_TMR_SIZE        0x10000U
+#define SIM_GPIO_BASE       XPAR_XGPIO_0_BASEADDR
+#define SIM_GPIO_SIZE       0x10000U
+#define SIM_GICD_BASE       XPAR_SCUGIC_0_DIST_BASEADDR
+#define SIM_GICD_SIZE       0x1000U
+#define SIM_GICC_BASE       XPAR_SCUGIC_0_CPU_BASEADDR
+#define SIM_GICC_SIZE       0x1000U
+
+/*
+ * GIC distributor: TYPER, IGROUPR, I[SC]ENABLER and ITARGETSR. The
+ * group and enable bits only decide whether the FIQ source signals
+ * FIQ; IRQ sources follow Sim_EnableIrq() from the interrupt wrapper.
+ */
+#define GICD_TYPER          0x004U
+#define GICD_IGROUPR        0x080U
+#define GICD_ISENABLER      0x100U
+#define GICD_ICENABLER      0x180U
+#define GICD_ITARGETSR      0x800U
+#define GIC_NUM_IDS         192U
+#define GIC_FIRST_SPI       32U
+#define GIC_SPI(IntrId)     ((IntrId) + GIC_FIRST_SPI)
+#define GIC_WORDS           (GIC_NUM_IDS / 32U)
+
+/* GIC CPU interface: CTLR.FIQEn, IAR and EOIR for the FIQ on core 0,
+ * PMR on both cores */
+#define GICC_CTLR           0x000U
+#define GICC_PMR            0x004U
+#define GICC_IAR            0x00CU
+#define GICC_EOIR           0x010U
+#define GICC_CTLR_FIQEN     (1U << 3)
+#define GICC_PMR_BSP        0xF0U       /* As XScuGic_CfgInitialize sets it */
+#define GIC_SPURIOUS_ID     1023U
+
+/* GIC-400 implements five priority bits; the secure binary point
+ * leaves all five for preemption */
+#define GIC_PRIORITY_MASK   0xF8U
+#define GIC_IDLE_PRIORITY   0x100U
+
+/* PSTATE.I in SPSR_EL3 */
+#define SPSR_I              0x80U
+
+#define SIM_MAX_IRQS        4U
+
+/* Host interval timer driving spin loops, in microseconds */
+#define SIM_SPIN_TICK_US    100
+
+typedef struct {
+    u32 IntrId;
+    void (*Handler)(void *);
+    void *Ref;
+    u8 Priority;
+    u8 Enabled;
+} SimIrq;
+
+static volatile u64 SimTime;
+static volatile sig_atomic_t SimBusy;       /* Inside a model */
+static volatile sig_atomic_t SimInIrq;      /* Handlers nested on core 0 */
+static volatile sig_atomic_t SimMasked = 1; /* PSTATE.I, set out of reset */
+static volatile sig_atomic_t SimEvent;      /* Event register for WFE */
+static volatile sig_atomic_t SimCpu;        /* Core running the code now */
+static volatile sig_atomic_t SimCpu1Up;     /* Core 1 started */
+static volatile sig_atomic_t SimCpu1InIrq;
+static volatile sig_atomic_t SimCpu1Masked;
+static volatile sig_atomic_t SimFiqMasked = 1; /* PSTATE.F, core 0 */
+static volatile sig_atomic_t SimInFiq;
+static volatile sig_atomic_t SimSleeping;   /* Sim_Sleep() keeps the clock */
+static volatile u32 SimRunningPriority = GIC_IDLE_PRIORITY;
+static volatile sig_atomic_t SimSpsrMasked; /* PSTATE.I to return to, core 0 */
+static volatile sig_atomic_t SimCpu1SpsrMasked;
+static volatile u64 SimElr[2];              /* Return address, as a token */
+static u64 SimElrNext;
+static int SimStarted;
+static struct timespec SimHostStart;
+
+static SimIrq Irq[SIM_MAX_IRQS];
+static u64 AxiReads;        /* PL register accesses, timer and GPIO */
+static u64 AxiWrites;
+static u64 IrqTaken;
+static u64 IrqTakenCpu1;
+static u8 GicTarget[GIC_NUM_IDS];
+static u32 GicGroup[GIC_WORDS];
+static u32 GicEnable[GIC_WORDS];
+static u32 GiccCtlr;
+static u32 GiccPmr[2] = { GICC_PMR_BSP, GICC_PMR_BSP };   /* Banked */
+static u32 GiccActive = GIC_SPURIOUS_ID;
+
+static void (*FiqEntry)(void);
+static u32 FiqIntrId;
+static u64 FiqTaken;
+
+/* ------------------------------------------------------------
+ * Interrupt sources
+ * ------------------------------------------------------------ */
+static int IrqLine(u32 IntrId, u64 Now)
+{
+    if (IntrId == XPAR_FABRIC_XTMRCTR_0_INTR) {
+        return SimTmr_IrqLine(Now);
+    }
+    if (IntrId == XPAR_FABRIC_XGPIO_0_INTR) {
+        return SimGpio_IrqLine(Now);
+    }
+    return 0;
+}
+
+static u64 NextEvent(u64 Now)
+{
+    u64 Tmr = SimTmr_NextEvent(Now);
+    u64 Gpio = SimGpio_NextEvent(Now);
+
+    return (Gpio < Tmr) ? Gpio : Tmr;
+}
+
+/* Cores an interrupt can be taken on right now, as a CPU mask. It
+ * must be above the core's GICC_PMR, and on core 0 above the running
+ * priority to preempt a handler that unmasked IRQ; core 1 does not
+ * nest. */
+static u32 ReadyCpus(const SimIrq *IrqPtr)
+{
+    u32 Targets = (IrqPtr->IntrId < GIC_NUM_IDS - GIC_FIRST_SPI) ?
+                  GicTarget[GIC_SPI(IrqPtr->IntrId)] : 0x1U;
+    u32 Priority = IrqPtr->Priority & GIC_PRIORITY_MASK;
+    u32 Ready = 0;
+
+    if (!SimMasked && !SimInFiq && (Priority < SimRunningPriority) &&
+        (Priority < GiccPmr[0])) {
+        Ready |= 0x1U;
+    }
+    if (SimCpu1Up && !SimCpu1Masked && !SimCpu1InIrq &&
+        (Priority < GiccPmr[1])) {
+        Ready |= 0x2U;
+    }
+    return Targets & Ready;
+}
+
+/* Group 0 source on core 0 with FIQ unmasked. Taking an IRQ masks
+ * FIQ as well, so there is no FIQ inside an IRQ handler either. */
+static int FiqReady(void)
+{
+    u32 Id = GIC_SPI(FiqIntrId);
+
+    return (FiqEntry != NULL) && ((GiccCtlr & GICC_CTLR_FIQEN) != 0) &&
+           ((GicGroup[Id / 32U] & (1U << (Id % 32U))) == 0) &&
+           ((GicEnable[Id / 32U] & (1U << (Id % 32U))) != 0) &&
+           !SimFiqMasked && !SimInFiq && !SimInIrq;
+}
+
+/* ------------------------------------------------------------
+ * Take the FIQ whenever its line is up and it is ready, ahead
+ * of IRQs. Then take every pending, enabled interrupt in priority
+ * order (lower value first), on the lowest numbered core it targets
+ * that is ready for it. Entry masks IRQ and saves the mask as
+ * SPSR_EL3.I, the return restores it. On core 0 a handler that
+ * unmasks can be preempted by a higher priority, and the handler
+ * returns through SEV like an eret.
+ *
+ * Like the BSP's IRQInterruptHandler, the core 0 vector does not keep
+ * ELR_EL3 or SPSR_EL3: the return uses whatever they hold, and a
+ * nested entry overwrites both. Each entry writes a fresh token to
+ * ELR_EL3, and a return that finds another one stops the model, as
+ * the eret would go astray on the board.
+ *
+ * Core 1 has no clock of its own: it runs at the moment the line
+ * rises even if core 0 is masked, but its handler time still passes
+ * on the one virtual clock.
+ * ------------------------------------------------------------ */
+static void CheckIrq(void)
+{
+    SimIrq *Taken;
+    u32 TakenCpus = 0;
+    u32 Cpus;
+    sig_atomic_t Running;
+    u32 Priority;
+    u64 Elr;
+    u32 i;
+
+    while (!SimBusy) {
+        /* The line levels come from the models, keep SpinTick out */
+        SimBusy = 1;
+        if (FiqReady() && IrqLine(FiqIntrId, SimTime)) {
+            SimBusy = 0;
+            Running = SimCpu;
+            SimCpu = 0;
+            SimInFiq = 1;
+            GiccActive = GIC_SPI(FiqIntrId);
+            SimTime += SIM_FIQ_ENTRY_CYCLES;
+            FiqEntry();
+            SimTime += SIM_IRQ_EXIT_CYCLES;
+            GiccActive = GIC_SPURIOUS_ID;
+            SimInFiq = 0;
+            SimEvent = 1;
+            SimCpu = Running;
+            FiqTaken++;
+            continue;
+        }
+        Taken = NULL;
+        for (i = 0; i < SIM_MAX_IRQS; i++) {
+            if ((Irq[i].Handler == NULL) || !Irq[i].Enabled) {
+                continue;
+            }
+            Cpus = ReadyCpus(&Irq[i]);
+            if ((Cpus != 0) && IrqLine(Irq[i].IntrId, SimTime) &&
+                ((Taken == NULL) || (Irq[i].Priority < Taken->Priority))) {
+                Taken = &Irq[i];
+                TakenCpus = Cpus;
+            }
+        }
+        SimBusy = 0;
+        if (Taken == NULL) {
+            return;
+        }
+
+        Running = SimCpu;
+        if ((TakenCpus & 0x1U) != 0) {
+            SimCpu = 0;
+            SimInIrq++;
+            Priority = SimRunningPriority;
+            SimRunningPriority = Taken->Priority & GIC_PRIORITY_MASK;
+            SimSpsrMasked = SimMasked;
+            Elr = ++SimElrNext;
+            SimElr[0] = Elr;
+            SimMasked = 1;
+            SimTime += SIM_IRQ_ENTRY_CYCLES;
+            Taken->Handler(Taken->Ref);
+            SimTime += SIM_IRQ_EXIT_CYCLES;
+            if (SimElr[0] != Elr) {
+                fprintf(stderr, "[sim] IRQ %u returns with ELR_EL3 "
+                        "overwritten by a nested exception\n",
+                        (unsigned)Taken->IntrId);
+                exit(2);
+            }
+            SimMasked = SimSpsrMasked;
+            SimRunningPriority = Priority;
+            SimInIrq--;
+            SimEvent = 1;
+        } else {
+            SimCpu = 1;
+            SimCpu1InIrq = 1;
+            SimCpu1SpsrMasked = SimCpu1Masked;
+            SimElr[1] = ++SimElrNext;
+            SimCpu1Masked = 1;
+            SimTime += SIM_IRQ_ENTRY_CYCLES;
+            Taken->Handler(Taken->Ref);
+            SimTime += SIM_IRQ_EXIT_CYCLES;
+            SimCpu1Masked = SimCpu1SpsrMasked;
+            SimCpu1InIrq = 0;
+            IrqTakenCpu1++;
+        }
+        SimCpu = Running;
+        IrqTaken++;
+    }
+}
+
+/* ------------------------------------------------------------
+ * Host interval timer: while the application spins on memory
+ * without touching a register the virtual clock would stand
+ * still, so move it towards the next device event.
+ * ------------------------------------------------------------ */
+static void SpinTick(int Signal)
+{
+    u64 Next;
+    u64 Step = SIM_SPIN_QUANTUM_CYCLES;
+
+    (void)Signal;
+    if (SimBusy || SimInIrq || SimInFiq || SimSleeping) {
+        return;
+    }
+
+    SimBusy = 1;
+    Next = NextEvent(SimTime);
+    if ((Next != SIM_NO_EVENT) && (Next - SimTime < Step)) {
+        Step = Next - SimTime;
+    }
+    SimTime += Step;
+    SimBusy = 0;
+
+    CheckIrq();
+}
+
+static void Report(void)
+{
+    struct timespec End;
+    u64 HostUs;
+
+    clock_gettime(CLOCK_MONOTONIC, &End);
+    HostUs = (u64)(End.tv_sec - SimHostStart.tv_sec) * 1000000U +
+             (u64)((End.tv_nsec - SimHostStart.tv_nsec) / 1000);
+
+    fprintf(stderr, "[sim] %llu us virtual in %llu us host, %llu IRQ(s)\n",
+            (unsigned long long)(SimTime / (SIM_CLOCK_HZ / 1000000U)),
+            (unsigned long long)HostUs, (unsigned long long)IrqTaken);
+    if (SimCpu1Up) {
+        fprintf(stderr, "[sim] core 1: %llu IRQ(s)\n",
+                (unsigned long long)IrqTakenCpu1);
+    }
+    if (FiqTaken != 0) {
+        fprintf(stderr, "[sim] %llu FIQ(s)\n", (unsigned long long)FiqTaken);
+    }
+    if (SimGpio_Edges() != 0) {
+        fprintf(stderr, "[sim] gpio: %llu button edges\n",
+                (unsigned long long)SimGpio_Edges());
+    }
+}
+
+static void Start(void)
+{
+    struct sigaction Action;
+    struct itimerval Interval;
+
+    SimStarted = 1;
+    SimTmr_Reset();
+    SimGpio_Reset();
+
+    /* As XScuGic_CfgInitialize leaves it: every SPI on core 0 */
+    memset(GicTarget, 0x1, sizeof(GicTarget));
+    clock_gettime(CLOCK_MONOTONIC, &SimHostStart);
+    atexit(Report);
+
+    Action.sa_handler = SpinTick;
+    sigemptyset(&Action.sa_mask);
+    Action.sa_flags = SA_RESTART;
+    sigaction(SIGALRM, &Action, NULL);
+
+    Interval.it_interval.tv_sec = 0;
+    Interval.it_interval.tv_usec = SIM_SPIN_TICK_US;
+    Interval.it_value = Interval.it_interval;
+    setitimer(ITIMER_REAL, &Interval, NULL);
+}
+
+/* ------------------------------------------------------------
+ * GIC distributor. ITARGETSR bytes of SGIs/PPIs read as the
+ * calling core and ignore writes; unmodelled registers read 0.
+ * ------------------------------------------------------------ */
+static int GicdTargetReg(u32 Offset)
+{
+    return (Offset >= GICD_ITARGETSR) &&
+           (Offset < GICD_ITARGETSR + GIC_NUM_IDS);
+}
+
+/* Index of a one-bit-per-ID register word at Base, or -1 */
+static int GicdBitReg(u32 Offset, u32 Base)
+{
+    return ((Offset >= Base) && (Offset < Base + GIC_WORDS * 4U)) ?
+           (int)((Offset - Base) / 4U) : -1;
+}
+
+static u32 GicdRead(u32 Offset)
+{
+    u32 Value = 0;
+    u32 Id;
+    u32 i;
+    int Word;
+
+    if (Offset == GICD_TYPER) {
+        return GIC_WORDS - 1U;
+    }
+    if ((Word = GicdBitReg(Offset, GICD_IGROUPR)) >= 0) {
+        return GicGroup[Word];
+    }
+    if (((Word = GicdBitReg(Offset, GICD_ISENABLER)) >= 0) ||
+        ((Word = GicdBitReg(Offset, GICD_ICENABLER)) >= 0)) {
+        return GicEnable[Word];
+    }
+    if (!GicdTargetReg(Offset)) {
+        return 0;
+    }
+    Id = (Offset - GICD_ITARGETSR) & ~3U;
+    for (i = 0; i < 4U; i++) {
+        Value |= (u32)((Id + i < GIC_FIRST_SPI) ? (1U << SimCpu) :
+                       GicTarget[Id + i]) << (i * 8U);
+    }
+    return Value;
+}
+
+static void GicdWrite(u32 Offset, u32 Value)
+{
+    u32 Id;
+    u32 i;
+    int Word;
+
+    if ((Word = GicdBitReg(Offset, GICD_IGROUPR)) >= 0) {
+        GicGroup[Word] = Value;
+        return;
+    }
+    if ((Word = GicdBitReg(Offset, GICD_ISENABLER)) >= 0) {
+        GicEnable[Word] |= Value;
+        return;
+    }
+    if ((Word = GicdBitReg(Offset, GICD_ICENABLER)) >= 0) {
+        GicEnable[Word] &= ~Value;
+        return;
+    }
+    if (!GicdTargetReg(Offset)) {
+        return;
+    }
+    Id = (Offset - GICD_ITARGETSR) & ~3U;
+    for (i = 0; i < 4U; i++) {
+        if (Id + i >= GIC_FIRST_SPI) {
+            GicTarget[Id + i] = (u8)(Value >> (i * 8U));
+        }
+    }
+}
+
+/* GIC CPU interface: the acknowledge returns the FIQ being taken */
+static u32 GiccRead(u32 Offset)
+{
+    switch (Offset) {
+    case GICC_CTLR:
+        return GiccCtlr;
+    case GICC_PMR:
+        return GiccPmr[SimCpu];
+    case GICC_IAR:
+        return GiccActive;
+    default:
+        return 0;
+    }
+}
+
+static void GiccWrite(u32 Offset, u32 Value)
+{
+    if (Offset == GICC_CTLR) {
+        GiccCtlr = Value;
+    } else if (Offset == GICC_PMR) {
+        GiccPmr[SimCpu] = Value & GIC_PRIORITY_MASK;
+    }
+}
+
+/* ------------------------------------------------------------
+ * Register access
+ * ------------------------------------------------------------ */
+static void Unmapped(const char *Op, UINTPTR Addr)
+{
+    fprintf(stderr, "[sim] %s of unmapped address 0x%08lX\n", Op,
+            (unsigned long)Addr);
+    exit(2);
+}
+
+u32 Sim_Read32(UINTPTR Addr)
+{
+    u32 Value = 0;
+
+    if (!SimStarted) {
+        Start();
+    }
+
+    SimBusy = 1;
+    SimTime += SIM_MMIO_CYCLES;
+    if ((Addr - SIM_TMR_BASE) < SIM_TMR_SIZE) {
+        Value = SimTmr_Read((u32)(Addr - SIM_TMR_BASE), SimTime);
+        AxiReads++;
+    } else if ((Addr - SIM_GPIO_BASE) < SIM_GPIO_SIZE) {
+        Value = SimGpio_Read((u32)(Addr - SIM_GPIO_BASE), SimTime);
+        AxiReads++;
+    } else if ((Addr - SIM_GICD_BASE) < SIM_GICD_SIZE) {
+        Value = GicdRead((u32)(Addr - SIM_GICD_BASE));
+    } else if ((Addr - SIM_GICC_BASE) < SIM_GICC_SIZE) {
+        Value = GiccRead((u32)(Addr - SIM_GICC_BASE));
+    } else {
+        Unmapped("read", Addr);
+    }
+    SimBusy = 0;
+
+    CheckIrq();
+    return Value;
+}
+
+void Sim_Write32(UINTPTR Addr, u32 Value)
+{
+    if (!SimStarted) {
+        Start();
+    }
+
+    SimBusy = 1;
+    SimTime += SIM_MMIO_CYCLES;
+    if ((Addr - SIM_TMR_BASE) < SIM_TMR_SIZE) {
+        SimTmr_Write((u32)(Addr - SIM_TMR_BASE), Value, SimTime);
+        AxiWrites++;
+    } else if ((Addr - SIM_GPIO_BASE) < SIM_GPIO_SIZE) {
+        SimGpio_Write((u32)(Addr - SIM_GPIO_BASE), Value, SimTime);
+        AxiWrites++;
+    } else if ((Addr - SIM_GICD_BASE) < SIM_GICD_SIZE) {
+        GicdWrite((u32)(Addr - SIM_GICD_BASE), Value);
+    } else if ((Addr - SIM_GICC_BASE) < SIM_GICC_SIZE) {
+        GiccWrite((u32)(Addr - SIM_GICC_BASE), Value);
+    } else {
+        Unmapped("write", Addr);
+    }
+    SimBusy = 0;
+
+    CheckIrq();
+}
+
+/* Accesses to the PL peripherals so far, GIC excluded */
+void Sim_AxiCounts(u64 *Reads, u64 *Writes)
+{
+    *Reads = AxiReads;
+    *Writes = AxiWrites;
+}
+
+/* ------------------------------------------------------------
+ * CPU
+ * ------------------------------------------------------------ */
+void Sim_IrqMask(void)
+{
+    if (SimCpu == 0) {
+        SimMasked = 1;
+    } else {
+        SimCpu1Masked = 1;
+    }
+}
+
+void Sim_IrqUnmask(void)
+{
+    if (SimCpu == 0) {
+        SimMasked = 0;
+    } else {
+        SimCpu1Masked = 0;
+    }
+    CheckIrq();
+}
+
+/* PSTATE.I and PSTATE.F by XIL_EXCEPTION_IRQ / _FIQ; FIQ is core 0 only */
+void Sim_ExceptionMask(u32 Mask)
+{
+    if ((Mask & XIL_EXCEPTION_FIQ) != 0) {
+        SimFiqMasked = 1;
+    }
+    if ((Mask & XIL_EXCEPTION_IRQ) != 0) {
+        Sim_IrqMask();
+    }
+}
+
+void Sim_ExceptionUnmask(u32 Mask)
+{
+    if ((Mask & XIL_EXCEPTION_FIQ) != 0) {
+        SimFiqMasked = 0;
+    }
+    if ((Mask & XIL_EXCEPTION_IRQ) != 0) {
+        Sim_IrqUnmask();
+    } else {
+        CheckIrq();
+    }
+}
+
+/* ------------------------------------------------------------
+ * System registers: MPIDR_EL1, and SPSR_EL3.I / ELR_EL3 as a
+ * handler sees them. Writes last until the next exception (CheckIrq).
+ * The return address is the C caller, so ELR_EL3 holds only the token
+ * its return checks.
+ * ------------------------------------------------------------ */
+u64 Sim_ReadSysReg(const char *Name)
+{
+    if (strcmp(Name, "MPIDR_EL1") == 0) {
+        return 0x80000000U | (u64)SimCpu;
+    }
+    if (strcmp(Name, "SPSR_EL3") == 0) {
+        return ((SimCpu == 0) ? SimSpsrMasked : SimCpu1SpsrMasked) ?
+               SPSR_I : 0;
+    }
+    if (strcmp(Name, "ELR_EL3") == 0) {
+        return SimElr[SimCpu];
+    }
+    fprintf(stderr, "[sim] read of unmodelled system register %s\n", Name);
+    exit(2);
+}
+
+void Sim_WriteSysReg(const char *Name, u64 Value)
+{
+    if (strcmp(Name, "SPSR_EL3") == 0) {
+        if (SimCpu == 0) {
+            SimSpsrMasked = ((Value & SPSR_I) != 0);
+        } else {
+            SimCpu1SpsrMasked = ((Value & SPSR_I) != 0);
+        }
+        return;
+    }
+    if (strcmp(Name, "ELR_EL3") == 0) {
+        SimElr[SimCpu] = Value;
+        return;
+    }
+    fprintf(stderr, "[sim] write of unmodelled system register %s\n", Name);
+    exit(2);
+}
+
+/* ------------------------------------------------------------
+ * Core 1 runs its setup at once, then waits in WFI for the
+ * interrupts targeted at it
+ * ------------------------------------------------------------ */
+int Sim_StartCore1(void (*Entry)(void *), void *Arg)
+{
+    if (!SimStarted) {
+        Start();
+    }
+    if (SimCpu1Up) {
+        return XST_DEVICE_IS_STARTED;
+    }
+
+    SimCpu = 1;
+    SimCpu1Masked = 1;
+    Entry(Arg);
+    SimCpu = 0;
+
+    SimCpu1Masked = 0;
+    SimCpu1Up = 1;
+    CheckIrq();
+    return XST_SUCCESS;
+}
+
+/* Sleep until the next device event. Returns without waiting when
+ * one is already pending; a masked interrupt still wakes the core. */
+static void WaitForEvent(const char *Op)
+{
+    u64 Next;
+
+    SimBusy = 1;
+    Next = NextEvent(SimTime);
+    if (Next == SIM_NO_EVENT) {
+        fprintf(stderr, "[sim] %s with no wake-up source pending\n", Op);
+        exit(3);
+    }
+    if (Next > SimTime) {
+        SimTime = Next;
+    }
+    SimBusy = 0;
+
+    CheckIrq();
+}
+
+void Sim_WaitForInterrupt(void)
+{
+    WaitForEvent("wfi");
+}
+
+void Sim_WaitForEvent(void)
+{
+    if (SimEvent) {
+        SimEvent = 0;
+        return;
+    }
+    WaitForEvent("wfe");
+    SimEvent = 0;
+}
+
+void Sim_SendEvent(void)
+{
+    SimEvent = 1;
+}
+
+/* Busy-wait as usleep() does. The interval timer must not move the
+ * clock past End between steps, handlers still run on the way. A line
+ * already up that this core cannot take yet hides the next event, so
+ * poll in small steps until it drops. */
+void Sim_Sleep(u64 Cycles)
+{
+    u64 End = SimTime + Cycles;
+    u64 Next;
+    sig_atomic_t Nested = SimSleeping;
+
+    SimSleeping = 1;
+    while (SimTime < End) {
+        SimBusy = 1;
+        Next = NextEvent(SimTime);
+        if (Next <= SimTime) {
+            Next = SimTime + SIM_SLEEP_POLL_CYCLES;
+        }
+        SimTime = ((Next != SIM_NO_EVENT) && (Next < End)) ? Next : End;
+        SimBusy = 0;
+        CheckIrq();
+    }
+    SimSleeping = Nested;
+}
+
+u64 Sim_Now(void)
+{
+    return SimTime;
+}
+
+/* ------------------------------------------------------------
+ * Interrupt controller
+ * ------------------------------------------------------------ */
+static SimIrq *FindIrq(u32 IntrId)
+{
+    u32 i;
+
+    for (i = 0; i < SIM_MAX_IRQS; i++) {
+        if ((Irq[i].Handler != NULL) && (Irq[i].IntrId == IntrId)) {
+            return &Irq[i];
+        }
+    }
+    return NULL;
+}
+
+void Sim_ConnectIrq(u32 IntrId, void (*Handler)(void *), void *Ref,
+                    u8 Priority)
+{
+    SimIrq *Entry = FindIrq(IntrId);
+    u32 i;
+
+    if (!SimStarted) {
+        Start();
+    }
+
+    for (i = 0; (Entry == NULL) && (i < SIM_MAX_IRQS); i++) {
+        if (Irq[i].Handler == NULL) {
+            Entry = &Irq[i];
+        }
+    }
+    if (Entry == NULL) {
+        fprintf(stderr, "[sim] no room for IRQ %u\n", (unsigned)IntrId);
+        exit(2);
+    }
+
+    SimBusy = 1;
+    Entry->IntrId = IntrId;
+    Entry->Ref = Ref;
+    Entry->Priority = Priority;
+    Entry->Enabled = 0;
+    Entry->Handler = Handler;
+    SimBusy = 0;
+}
+
+void Sim_ConnectFiq(u32 IntrId, void (*Entry)(void))
+{
+    if (!SimStarted) {
+        Start();
+    }
+    SimBusy = 1;
+    FiqIntrId = IntrId;
+    FiqEntry = Entry;
+    SimBusy = 0;
+}
+
+void Sim_DisconnectFiq(void)
+{
+    FiqEntry = NULL;
+}
+
+void Sim_DisconnectIrq(u32 IntrId)
+{
+    SimIrq *Entry = FindIrq(IntrId);
+
+    if (Entry != NULL) {
+        Entry->Enabled = 0;
+        Entry->Handler = NULL;
+    }
+}
+
+void Sim_EnableIrq(u32 IntrId, int Enable)
+{
+    SimIrq *Entry = FindIrq(IntrId);
+
+    if (Entry != NULL) {
+        Entry->Enabled = (Enable != 0);
+        CheckIrq();
+    }
+}
+
+/* ------------------------------------------------------------
+ * BSP services backed by the virtual clock
+ * ------------------------------------------------------------ */
+void XTime_GetTime(XTime *Xtime_Global)
+{
+    *Xtime_Global = SimTime;
+}
+
+void xil_printf(const char *Format, ...)
+{
+    va_list Args;
+
+    va_start(Args, Format);
+    vprintf(Format, Args);
+    va_end(Args);
+    fflush(stdout);
+}
+
+/* ------------------------------------------------------------
+ * platform.c - no caches or MMU to bring up
+ * ------------------------------------------------------------ */
+void init_platform(void)
+{
+}
+
+void cleanup_platform(void)
+{
+}
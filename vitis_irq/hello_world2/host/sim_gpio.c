@@ -0,0 +1,176 @@
+/******************************************************************************
+ * AXI GPIO v2.0 register model, channel 1 only - see sim.h
+ *
+ * DATA/TRI at 0x000/0x004, GIER at 0x11C, IPISR at 0x120 (toggle on
+ * write) and IPIER at 0x128, as in PG144. IPISR bit 0 is set on any
+ * change of a channel 1 input, whether or not IPIER enables it;
+ * ip2intc_irpt is GIER & (IPISR & IPIER).
+ *
+ * Bit 0 of channel 1 is a scripted push button. It is pressed every
+ * SIM_GPIO_PERIOD_US and released SIM_GPIO_HOLD_US later, and each of
+ * those transitions bounces: the contact opens and closes a few times
+ * within two milliseconds before it settles. Like the timer model, the
+ * input is not stepped; the edges since the last access are counted
+ * on the next one.
+ ******************************************************************************/
+
+#include "sim.h"
+
+#ifndef SIM_GPIO_FIRST_US
+#define SIM_GPIO_FIRST_US   500000U
+#endif
+#ifndef SIM_GPIO_PERIOD_US
+#define SIM_GPIO_PERIOD_US  400000U
+#endif
+#ifndef SIM_GPIO_HOLD_US
+#define SIM_GPIO_HOLD_US    150000U
+#endif
+
+#define GPIO_DATA           0x000U
+#define GPIO_TRI            0x004U
+#define GPIO_GIER           0x11CU
+#define GPIO_IPISR          0x120U
+#define GPIO_IPIER          0x128U
+
+#define GIER_ENABLE         0x80000000U
+#define IR_CH1              0x1U
+#define IR_MASK             0x3U
+
+#define US_TO_CYCLES(us)    ((u64)(us) * (SIM_CLOCK_HZ / 1000000U))
+
+/* Edge times within one press period, in microseconds. An odd count
+ * per transition, so each burst ends with the level toggled. */
+static const u32 EdgeUs[] = {
+    0, 150, 400, 900, 1600,
+    SIM_GPIO_HOLD_US, SIM_GPIO_HOLD_US + 200U, SIM_GPIO_HOLD_US + 500U,
+    SIM_GPIO_HOLD_US + 1100U, SIM_GPIO_HOLD_US + 1900U,
+};
+
+#define EDGES_PER_PERIOD    (sizeof(EdgeUs) / sizeof(EdgeUs[0]))
+
+static u32 Tri;
+static u32 Gier;
+static u32 Ipisr;
+static u32 Ipier;
+static u64 Edges;       /* Input edges up to the last access */
+
+/* ------------------------------------------------------------
+ * Scripted input
+ * ------------------------------------------------------------ */
+static u64 EdgeTime(u64 Index)
+{
+    return US_TO_CYCLES(SIM_GPIO_FIRST_US) +
+           (Index / EDGES_PER_PERIOD) * US_TO_CYCLES(SIM_GPIO_PERIOD_US) +
+           US_TO_CYCLES(EdgeUs[Index % EDGES_PER_PERIOD]);
+}
+
+/* Number of edges at or before Now */
+static u64 EdgesBy(u64 Now)
+{
+    u64 Elapsed;
+    u64 Count;
+    u64 Phase;
+    u32 i;
+
+    if (Now < US_TO_CYCLES(SIM_GPIO_FIRST_US)) {
+        return 0;
+    }
+    Elapsed = Now - US_TO_CYCLES(SIM_GPIO_FIRST_US);
+    Count = (Elapsed / US_TO_CYCLES(SIM_GPIO_PERIOD_US)) * EDGES_PER_PERIOD;
+    Phase = Elapsed % US_TO_CYCLES(SIM_GPIO_PERIOD_US);
+    for (i = 0; i < EDGES_PER_PERIOD; i++) {
+        if (US_TO_CYCLES(EdgeUs[i]) <= Phase) {
+            Count++;
+        }
+    }
+    return Count;
+}
+
+static void Sync(u64 Now)
+{
+    u64 Count = EdgesBy(Now);
+
+    if ((Count != Edges) && ((Tri & 1U) != 0)) {
+        Ipisr |= IR_CH1;
+    }
+    Edges = Count;
+}
+
+/* ------------------------------------------------------------
+ * Register interface
+ * ------------------------------------------------------------ */
+void SimGpio_Reset(void)
+{
+    Tri = 0xFFFFFFFFU;
+    Gier = 0;
+    Ipisr = 0;
+    Ipier = 0;
+    Edges = 0;
+}
+
+u32 SimGpio_Read(u32 Offset, u64 Now)
+{
+    Sync(Now);
+
+    switch (Offset) {
+    case GPIO_DATA:
+        return (u32)(Edges & 1U) & Tri;
+    case GPIO_TRI:
+        return Tri;
+    case GPIO_GIER:
+        return Gier;
+    case GPIO_IPISR:
+        return Ipisr;
+    case GPIO_IPIER:
+        return Ipier;
+    default:
+        return 0;
+    }
+}
+
+void SimGpio_Write(u32 Offset, u32 Value, u64 Now)
+{
+    Sync(Now);
+
+    switch (Offset) {
+    case GPIO_TRI:
+        Tri = Value;
+        break;
+    case GPIO_GIER:
+        Gier = Value & GIER_ENABLE;
+        break;
+    case GPIO_IPISR:
+        Ipisr ^= Value & IR_MASK;
+        break;
+    case GPIO_IPIER:
+        Ipier = Value & IR_MASK;
+        break;
+    default:
+        /* DATA of an all-inputs channel is read-only */
+        break;
+    }
+}
+
+int SimGpio_IrqLine(u64 Now)
+{
+    Sync(Now);
+    return (Gier != 0) && ((Ipisr & Ipier) != 0);
+}
+
+/* Earliest time the interrupt line can rise, none while masked */
+u64 SimGpio_NextEvent(u64 Now)
+{
+    if ((Gier == 0) || ((Ipier & IR_CH1) == 0)) {
+        return SIM_NO_EVENT;
+    }
+    Sync(Now);
+    if ((Ipisr & Ipier) != 0) {
+        return Now;
+    }
+    return EdgeTime(EdgesBy(Now));
+}
+
+u64 SimGpio_Edges(void)
+{
+    return Edges;
+}
@@ -0,0 +1,431 @@
+/******************************************************************************
+ * AXI Timer v2.0 register model - see sim.h
+ *
+ * Two counters of TCSR/TLR/TCR at offsets 0x00 and 0x10, generate mode.
+ * Counter values are not stepped cycle by cycle; each counter keeps its
+ * value at the time of the last access and is brought up to date on the
+ * next one, so a long WFI costs nothing.
+ *
+ * Timing follows PG079: a counter loaded with TLR passes zero (down) or
+ * all-ones (up) TLR+1 or MAX-TLR+1 cycles later, sets T0INT and spends
+ * one more cycle reloading, for a period of TLR+2 or MAX-TLR+2. Without
+ * ARHT the counter holds at the terminal count after the first expiry.
+ *
+ * PWM0 is not stepped either. With both counters generating and PWMA
+ * set, the model derives the waveform from TLR0/TLR1 as PG079 gives it
+ * (period from counter 0, high time from counter 1, each TLR + 2
+ * counting down) and, like a scope on the pin, reports the frequency
+ * and duty measured over every stretch the settings stayed unchanged.
+ *
+ * Capture mode (MDT) counts freely and only sets TINT on a capture.
+ * capturetrig0 is the capture_in pin, driven here by a signal
+ * generator that knows nothing of the timer: a square wave of
+ * SIM_CAPIN_PERIOD cycles, 50 ppm off the timer clock, whose rising
+ * edges wander by up to SIM_CAPIN_JITTER cycles. Counter 0 with CAPT
+ * set captures the cycle of each edge. Without ARHT the first capture
+ * is held until TINT is cleared, with it the latest one wins.
+ * capturetrig1 is tied low. The synchroniser delay of the real input
+ * is not modelled.
+ ******************************************************************************/
+
+#include "sim.h"
+#include <stdio.h>
+
+#define TMR_NUM_COUNTERS    2U
+#define TMR_MAX             0xFFFFFFFFULL
+
+/* capture_in: first rising edge, period and jitter, in timer cycles */
+#ifndef SIM_CAPIN_FIRST
+#define SIM_CAPIN_FIRST     123457ULL
+#endif
+#ifndef SIM_CAPIN_PERIOD
+#define SIM_CAPIN_PERIOD    100005ULL       /* 1 kHz, 50 ppm slow */
+#endif
+#ifndef SIM_CAPIN_JITTER
+#define SIM_CAPIN_JITTER    8U
+#endif
+
+/* TCSR bits */
+#define TCSR_MDT            0x001U
+#define TCSR_UDT            0x002U
+#define TCSR_GENT           0x004U
+#define TCSR_CAPT           0x008U
+#define TCSR_ARHT           0x010U
+#define TCSR_LOAD           0x020U
+#define TCSR_ENIT           0x040U
+#define TCSR_ENT            0x080U
+#define TCSR_TINT           0x100U
+#define TCSR_PWMA           0x200U
+#define TCSR_ENALL          0x400U
+
+#define TMR_TCSR            0x0U
+#define TMR_TLR             0x4U
+#define TMR_TCR             0x8U
+
+typedef struct {
+    u32 Tcsr;
+    u32 Tlr;
+    u32 Value;          /* Counter value at LastSync */
+    u64 LastSync;
+    u8 Halted;          /* Expired without ARHT */
+    u8 Reloading;       /* In the reload cycle after an expiry */
+} SimCounter;
+
+typedef struct {
+    u64 Start;          /* Settings took effect */
+    u64 Period;
+    u64 High;
+    u8 Active;
+} SimPwm;
+
+static SimCounter Counter[TMR_NUM_COUNTERS];
+static SimPwm Pwm;
+
+static int IsRunning(const SimCounter *C)
+{
+    return ((C->Tcsr & TCSR_ENT) != 0) && ((C->Tcsr & TCSR_LOAD) == 0) &&
+           !C->Halted;
+}
+
+/* Cycles from Value until the counter passes its terminal count */
+static u64 ToTerminal(const SimCounter *C, u32 Value)
+{
+    if ((C->Tcsr & TCSR_UDT) != 0) {
+        return (u64)Value + 1U;
+    }
+    return (TMR_MAX - Value) + 1U;
+}
+
+/* ------------------------------------------------------------
+ * Bring a counter forward to Now
+ * ------------------------------------------------------------ */
+static void Sync(SimCounter *C, u64 Now)
+{
+    u64 Elapsed;
+    u64 Step;
+    u64 Period;
+    int Down = ((C->Tcsr & TCSR_UDT) != 0);
+
+    if (Now <= C->LastSync) {
+        return;
+    }
+    Elapsed = Now - C->LastSync;
+    C->LastSync = Now;
+
+    if (!IsRunning(C)) {
+        return;
+    }
+
+    if ((C->Tcsr & TCSR_MDT) != 0) {
+        C->Value = Down ? (u32)(C->Value - Elapsed) : (u32)(C->Value + Elapsed);
+        return;
+    }
+
+    if (C->Reloading) {
+        C->Reloading = 0;
+        Elapsed -= 1U;
+        if (Elapsed == 0) {
+            return;
+        }
+    }
+
+    Step = ToTerminal(C, C->Value);
+    if (Elapsed < Step) {
+        C->Value = Down ? (u32)(C->Value - Elapsed) : (u32)(C->Value + Elapsed);
+        return;
+    }
+
+    C->Tcsr |= TCSR_TINT;
+    Elapsed -= Step;
+
+    if ((C->Tcsr & TCSR_ARHT) == 0) {
+        C->Value = Down ? 0U : (u32)TMR_MAX;
+        C->Halted = 1;
+        return;
+    }
+
+    /* Reload cycle, then whole periods from TLR */
+    C->Value = C->Tlr;
+    if (Elapsed == 0) {
+        C->Reloading = 1;
+        return;
+    }
+    Elapsed -= 1U;
+
+    Period = ToTerminal(C, C->Tlr) + 1U;
+    Elapsed %= Period;
+    if (Elapsed < Period - 1U) {
+        C->Value = Down ? (u32)(C->Tlr - Elapsed) : (u32)(C->Tlr + Elapsed);
+    } else {
+        C->Reloading = 1;
+    }
+}
+
+/* ------------------------------------------------------------
+ * capture_in
+ * ------------------------------------------------------------ */
+static u64 InputEdge(u64 Index)
+{
+    u64 Hash = Index * 0x9E3779B97F4A7C15ULL;
+
+    return SIM_CAPIN_FIRST + Index * SIM_CAPIN_PERIOD +
+           ((Hash >> 32) % SIM_CAPIN_JITTER);
+}
+
+/* First rising edge after Time */
+static u64 NextInputEdge(u64 Time)
+{
+    u64 Index = 0;
+
+    if (Time >= SIM_CAPIN_FIRST) {
+        Index = (Time - SIM_CAPIN_FIRST) / SIM_CAPIN_PERIOD;
+    }
+    while (InputEdge(Index) <= Time) {
+        Index++;
+    }
+    return InputEdge(Index);
+}
+
+/* Last rising edge up to Time, which must follow the first one */
+static u64 LastInputEdge(u64 Time)
+{
+    u64 Index = (Time - SIM_CAPIN_FIRST) / SIM_CAPIN_PERIOD;
+
+    while (InputEdge(Index) > Time) {
+        Index--;
+    }
+    return InputEdge(Index);
+}
+
+static int Capturing(const SimCounter *C)
+{
+    return IsRunning(C) &&
+           ((C->Tcsr & (TCSR_MDT | TCSR_CAPT)) == (TCSR_MDT | TCSR_CAPT)) &&
+           (((C->Tcsr & TCSR_ARHT) != 0) || ((C->Tcsr & TCSR_TINT) == 0));
+}
+
+/* ------------------------------------------------------------
+ * Bring both counters forward to Now, latching a capture on counter 0
+ * if capture_in rose on the way
+ * ------------------------------------------------------------ */
+static void SyncAll(u64 Now)
+{
+    SimCounter *Cap = &Counter[0];
+    u64 When;
+
+    if (Capturing(Cap) && (Now > Cap->LastSync)) {
+        When = NextInputEdge(Cap->LastSync);
+        if (When <= Now) {
+            if ((Cap->Tcsr & TCSR_ARHT) != 0) {
+                /* Overwrite: the last edge up to Now */
+                When = LastInputEdge(Now);
+            }
+            Sync(Cap, When);
+            Cap->Tlr = Cap->Value;
+            Cap->Tcsr |= TCSR_TINT;
+        }
+    }
+
+    Sync(&Counter[0], Now);
+    Sync(&Counter[1], Now);
+}
+
+/* ------------------------------------------------------------
+ * PWM0
+ * ------------------------------------------------------------ */
+static int PwmSettings(u64 *Period, u64 *High)
+{
+    const u32 Mask = TCSR_PWMA | TCSR_GENT | TCSR_ENT | TCSR_MDT | TCSR_UDT;
+    const u32 Csr = Counter[0].Tcsr & Mask;
+
+    if (((Csr & ~TCSR_UDT) != (TCSR_PWMA | TCSR_GENT | TCSR_ENT)) ||
+        ((Counter[1].Tcsr & Mask) != Csr)) {
+        return 0;
+    }
+    *Period = ToTerminal(&Counter[0], Counter[0].Tlr) + 1U;
+    *High = ToTerminal(&Counter[1], Counter[1].Tlr) + 1U;
+    if (*High > *Period) {
+        *High = *Period;
+    }
+    return 1;
+}
+
+/* Report the stretch that ends at Now, if it ran a whole period */
+static void PwmMeasure(u64 Now)
+{
+    u64 Elapsed = Now - Pwm.Start;
+    u64 Periods = Elapsed / Pwm.Period;
+    u64 HighCycles;
+    u64 Duty;
+
+    if (Periods == 0) {
+        return;
+    }
+    HighCycles = Periods * Pwm.High;
+    HighCycles += ((Elapsed % Pwm.Period) < Pwm.High) ?
+                  (Elapsed % Pwm.Period) : Pwm.High;
+    Duty = (HighCycles * 10000U + Elapsed / 2U) / Elapsed;
+
+    fprintf(stderr, "[sim] pwm0: %llu Hz, %llu.%02llu%% high over %llu "
+            "periods (period %llu, high %llu cycles)\n",
+            (unsigned long long)(SIM_CLOCK_HZ / Pwm.Period),
+            (unsigned long long)(Duty / 100U),
+            (unsigned long long)(Duty % 100U), (unsigned long long)Periods,
+            (unsigned long long)Pwm.Period, (unsigned long long)Pwm.High);
+}
+
+static void PwmTrack(u64 Now)
+{
+    u64 Period = 0;
+    u64 High = 0;
+    int Active = PwmSettings(&Period, &High);
+
+    if ((Active == Pwm.Active) && (!Active ||
+        ((Period == Pwm.Period) && (High == Pwm.High)))) {
+        return;
+    }
+    if (Pwm.Active) {
+        PwmMeasure(Now);
+    }
+    Pwm.Active = (u8)Active;
+    Pwm.Period = Period;
+    Pwm.High = High;
+    Pwm.Start = Now;
+}
+
+void SimTmr_Reset(void)
+{
+    u32 i;
+
+    Pwm.Active = 0;
+
+    for (i = 0; i < TMR_NUM_COUNTERS; i++) {
+        Counter[i].Tcsr = 0;
+        Counter[i].Tlr = 0;
+        Counter[i].Value = 0;
+        Counter[i].LastSync = 0;
+        Counter[i].Halted = 0;
+        Counter[i].Reloading = 0;
+    }
+}
+
+u32 SimTmr_Read(u32 Offset, u64 Now)
+{
+    u32 Index = (Offset >> 4) & 0xFU;
+    SimCounter *C;
+
+    if (Index >= TMR_NUM_COUNTERS) {
+        return 0;
+    }
+    C = &Counter[Index];
+    SyncAll(Now);
+
+    switch (Offset & 0xFU) {
+    case TMR_TCSR:
+        return C->Tcsr;
+    case TMR_TLR:
+        return C->Tlr;
+    case TMR_TCR:
+        return C->Value;
+    default:
+        return 0;
+    }
+}
+
+void SimTmr_Write(u32 Offset, u32 Value, u64 Now)
+{
+    u32 Index = (Offset >> 4) & 0xFU;
+    SimCounter *C;
+    u32 Started;
+    u32 i;
+
+    if (Index >= TMR_NUM_COUNTERS) {
+        return;
+    }
+    C = &Counter[Index];
+    SyncAll(Now);
+
+    switch (Offset & 0xFU) {
+    case TMR_TCSR:
+        Started = Value & ~C->Tcsr & TCSR_ENT;
+
+        /* T0INT is write-one-to-clear, every other bit is plain R/W */
+        C->Tcsr = (Value & ~(TCSR_TINT | TCSR_ENALL)) |
+                  (C->Tcsr & TCSR_TINT & ~Value);
+
+        if ((Value & TCSR_LOAD) != 0) {
+            C->Value = C->Tlr;
+            C->Halted = 0;
+            C->Reloading = 0;
+        }
+        if (Started != 0) {
+            C->Halted = 0;
+        }
+        if ((Value & TCSR_ENALL) != 0) {
+            for (i = 0; i < TMR_NUM_COUNTERS; i++) {
+                if ((Counter[i].Tcsr & TCSR_ENT) == 0) {
+                    Counter[i].Tcsr |= TCSR_ENT;
+                    Counter[i].Halted = 0;
+                }
+            }
+        }
+        break;
+    case TMR_TLR:
+        C->Tlr = Value;
+        break;
+    default:
+        /* TCR is read-only */
+        break;
+    }
+    PwmTrack(Now);
+}
+
+/* ------------------------------------------------------------
+ * Level of the interrupt output (T0INT & ENIT on either counter)
+ * ------------------------------------------------------------ */
+int SimTmr_IrqLine(u64 Now)
+{
+    u32 i;
+
+    SyncAll(Now);
+    for (i = 0; i < TMR_NUM_COUNTERS; i++) {
+        if ((Counter[i].Tcsr & (TCSR_TINT | TCSR_ENIT)) ==
+            (TCSR_TINT | TCSR_ENIT)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* ------------------------------------------------------------
+ * Earliest time the interrupt output can rise, SIM_NO_EVENT if none
+ * ------------------------------------------------------------ */
+u64 SimTmr_NextEvent(u64 Now)
+{
+    u64 Next = SIM_NO_EVENT;
+    u64 When;
+    u32 i;
+
+    SyncAll(Now);
+    for (i = 0; i < TMR_NUM_COUNTERS; i++) {
+        SimCounter *C = &Counter[i];
+
+        if ((C->Tcsr & TCSR_ENIT) == 0) {
+            continue;
+        }
+        if ((C->Tcsr & TCSR_TINT) != 0) {
+            return Now;
+        }
+        if ((i == 0) && Capturing(C)) {
+            When = NextInputEdge(Now);
+        } else if (!IsRunning(C) || ((C->Tcsr & TCSR_MDT) != 0)) {
+            continue;
+        } else {
+            When = Now + C->Reloading + ToTerminal(C, C->Value);
+        }
+        if (When < Next) {
+            Next = When;
+        }
+    }
+    return Next;
+}
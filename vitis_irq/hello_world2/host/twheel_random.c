@@ -0,0 +1,302 @@
+/******************************************************************************
+ * Host check of the timer wheel (../src/twheel.c) against a brute-force
+ * model
+ *
+ * Random one-shot and periodic timers are added, moved and cancelled
+ * against a virtual clock, and the wheel is advanced by random steps,
+ * from one tick up to far beyond the wheel range. The model keeps every
+ * timer's due tick in a flat array. The check is made at each callback
+ * and after each advance:
+ *   - a callback comes exactly at the timer's due tick, for an active
+ *     timer, and a periodic timer stays on its phase
+ *   - after advancing to a tick, no active timer is due at or before it
+ *     (nothing was skipped)
+ * Callbacks re-arm, cancel and add timers themselves, as the
+ * application's callbacks may. A final run-out with quiet callbacks
+ * checks that each advance fires exactly as many callbacks as the
+ * model predicts, periodic repeats included.
+ *
+ *   twheel_random [operations] [seed]
+ ******************************************************************************/
+
+#include "twheel.h"
+#include "sim.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define RANDOM_TIMERS       1024U
+
+typedef struct {
+    TWheelTimer Timer;
+    u64 Due;            /* Model: absolute tick, valid while Active */
+    u32 Period;
+    int Active;
+} RandomTimer;
+
+static TWheel Wheel;
+static RandomTimer Timers[RANDOM_TIMERS];
+static u64 Rng;
+static u64 Fired;
+static u64 Errors;
+static int Quiet;           /* Callbacks only fire, for exact counts */
+
+/* The core wheel needs no device, the binding is not used here */
+u32 Sim_Read32(UINTPTR Addr)
+{
+    fprintf(stderr, "unexpected read of 0x%08lX\n", (unsigned long)Addr);
+    exit(2);
+}
+
+void Sim_Write32(UINTPTR Addr, u32 Value)
+{
+    fprintf(stderr, "unexpected write 0x%08lX = 0x%08X\n",
+            (unsigned long)Addr, Value);
+    exit(2);
+}
+
+void Sim_IrqMask(void)
+{
+}
+
+void Sim_IrqUnmask(void)
+{
+}
+
+static u32 Random(void)
+{
+    Rng ^= Rng << 13;
+    Rng ^= Rng >> 7;
+    Rng ^= Rng << 17;
+    return (u32)(Rng >> 16);
+}
+
+/* Delays across every level, past the wheel range and up to 2^32 - 1 */
+static u32 RandomDelay(void)
+{
+    switch (Random() % 8U) {
+    case 0:
+        return Random() % 4U;       /* 0 means 1 */
+    case 1:
+    case 2:
+        return Random() % TWHEEL_SLOTS;
+    case 3:
+        return Random() % (TWHEEL_SLOTS * TWHEEL_SLOTS);
+    case 4:
+        return Random() % (TWHEEL_SLOTS * TWHEEL_SLOTS * TWHEEL_SLOTS);
+    case 5:
+        return Random() % (u32)TWHEEL_RANGE;
+    case 6:
+        return (u32)TWHEEL_RANGE + (Random() % (u32)TWHEEL_RANGE);
+    default:
+        return (Random() << 16) ^ Random();
+    }
+}
+
+/* Mostly one-shot; periods from one tick to a few levels up */
+static u32 RandomPeriod(void)
+{
+    if ((Random() % 4U) != 0) {
+        return 0;
+    }
+    return 1U + (Random() % ((Random() % 2U) ? 64U : 300000U));
+}
+
+static void Add(RandomTimer *TimerPtr, u32 Delay, u32 Period)
+{
+    TWheel_Add(&Wheel, &TimerPtr->Timer, Delay, Period);
+    TimerPtr->Due = Wheel.Now + ((Delay != 0) ? Delay : 1U);
+    TimerPtr->Period = Period;
+    TimerPtr->Active = 1;
+}
+
+static void Cancel(RandomTimer *TimerPtr)
+{
+    TWheel_Cancel(&Wheel, &TimerPtr->Timer);
+    TimerPtr->Active = 0;
+}
+
+static void Fail(const char *What, const RandomTimer *TimerPtr)
+{
+    if (Errors == 0) {
+        fprintf(stderr, "timer %u at tick %llu: %s (due %llu, %s)\n",
+                (unsigned)(TimerPtr - Timers), (unsigned long long)Wheel.Now,
+                What, (unsigned long long)TimerPtr->Due,
+                TimerPtr->Active ? "active" : "inactive");
+    }
+    Errors++;
+}
+
+static void Callback(TWheelTimer *Timer, void *CallBackRef)
+{
+    RandomTimer *TimerPtr = (RandomTimer *)CallBackRef;
+    RandomTimer *OtherPtr;
+
+    (void)Timer;
+    Fired++;
+    if (!TimerPtr->Active || (TimerPtr->Due != Wheel.Now)) {
+        Fail("fired off its due tick", TimerPtr);
+    }
+    if (TimerPtr->Period != 0) {
+        TimerPtr->Due += TimerPtr->Period;
+    } else {
+        TimerPtr->Active = 0;
+    }
+
+    /* What an application callback might do meanwhile */
+    switch (Quiet ? 16U : (Random() % 16U)) {
+    case 0:
+        Add(TimerPtr, RandomDelay(), RandomPeriod());
+        break;
+    case 1:
+        Cancel(TimerPtr);
+        break;
+    case 2:
+        OtherPtr = &Timers[Random() % RANDOM_TIMERS];
+        if (OtherPtr != TimerPtr) {
+            Cancel(OtherPtr);
+        }
+        break;
+    case 3:
+        OtherPtr = &Timers[Random() % RANDOM_TIMERS];
+        if (OtherPtr != TimerPtr) {
+            Add(OtherPtr, Random() % 4U, 0);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/* Steps from one tick to past the wheel range */
+static u64 RandomStep(void)
+{
+    switch (Random() % 8U) {
+    case 0:
+        return 1U;
+    case 1:
+    case 2:
+    case 3:
+        return Random() % 100U;
+    case 4:
+    case 5:
+        return Random() % 10000U;
+    case 6:
+        return Random() % 1000000U;
+    default:
+        return Random() % (2U * (u32)TWHEEL_RANGE);
+    }
+}
+
+/* Expected callbacks up to Target, from the model alone */
+static u64 Expected(u64 Target)
+{
+    u64 Count = 0;
+    u32 i;
+
+    for (i = 0; i < RANDOM_TIMERS; i++) {
+        if (!Timers[i].Active || (Timers[i].Due > Target)) {
+            continue;
+        }
+        Count += (Timers[i].Period == 0) ? 1U :
+                 1U + (Target - Timers[i].Due) / Timers[i].Period;
+    }
+    return Count;
+}
+
+int main(int argc, char **argv)
+{
+    u64 Operations = (argc > 1) ? strtoull(argv[1], NULL, 0) : 2000000U;
+    u64 Added = 0;
+    u64 Advances = 0;
+    u64 Before;
+    u64 Want;
+    u64 Target;
+    u32 Miscounted = 0;
+    u64 Op;
+    u32 i;
+    u32 j;
+
+    Rng = (argc > 2) ? strtoull(argv[2], NULL, 0) : 0x9E3779B97F4A7C15ULL;
+    if (Rng == 0) {
+        Rng = 1;
+    }
+
+    TWheel_Init(&Wheel, 0);
+    for (i = 0; i < RANDOM_TIMERS; i++) {
+        TWheel_TimerInit(&Timers[i].Timer, Callback, &Timers[i]);
+    }
+
+    for (Op = 0; Op < Operations; Op++) {
+        RandomTimer *TimerPtr = &Timers[Random() % RANDOM_TIMERS];
+
+        switch (Random() % 4U) {
+        case 0:
+        case 1:
+            Add(TimerPtr, RandomDelay(), RandomPeriod());
+            Added++;
+            break;
+        case 2:
+            Cancel(TimerPtr);
+            break;
+        default:
+            Target = Wheel.Now + RandomStep();
+            TWheel_Advance(&Wheel, Target);
+            Advances++;
+            if (Wheel.Now != Target) {
+                fprintf(stderr, "advanced to %llu, asked for %llu\n",
+                        (unsigned long long)Wheel.Now,
+                        (unsigned long long)Target);
+                Errors++;
+            }
+            for (i = 0; i < RANDOM_TIMERS; i++) {
+                if (Timers[i].Active && (Timers[i].Due <= Target)) {
+                    Fail("skipped", &Timers[i]);
+                }
+            }
+            break;
+        }
+    }
+
+    /* Run-out: fresh timers, quiet callbacks, exact counts */
+    Quiet = 1;
+    for (i = 0; i < 64U; i++) {
+        for (j = 0; j < RANDOM_TIMERS; j++) {
+            Cancel(&Timers[j]);
+        }
+        for (j = 0; j < RANDOM_TIMERS / 4U; j++) {
+            Add(&Timers[j], RandomDelay() % 100000U,
+                RandomPeriod() % 5000U);
+        }
+        Target = Wheel.Now + RandomStep();
+        Want = Expected(Target);
+        Before = Fired;
+        TWheel_Advance(&Wheel, Target);
+        if ((Fired - Before) != Want) {
+            if (Miscounted == 0) {
+                fprintf(stderr, "run-out to %llu: %llu callbacks, model "
+                        "expects %llu\n", (unsigned long long)Target,
+                        (unsigned long long)(Fired - Before),
+                        (unsigned long long)Want);
+            }
+            Miscounted++;
+        }
+    }
+
+    printf("%llu operations: %llu adds, %llu advances to tick %llu, "
+           "%llu callbacks\n", (unsigned long long)Op,
+           (unsigned long long)Added, (unsigned long long)Advances,
+           (unsigned long long)Wheel.Now, (unsigned long long)Fired);
+    if ((u64)Wheel.Fired != (Fired & 0xFFFFFFFFU)) {
+        fprintf(stderr, "wheel counted %u callbacks, %llu ran\n",
+                Wheel.Fired, (unsigned long long)Fired);
+        Errors++;
+    }
+    Errors += Miscounted;
+    if (Errors != 0) {
+        fprintf(stderr, "FAILED: %llu error(s)\n", (unsigned long long)Errors);
+        return 1;
+    }
+    printf("every timer fired on its tick, none skipped, run-out counts "
+           "match the model\n");
+    return 0;
+}
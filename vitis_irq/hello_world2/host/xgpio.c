@@ -0,0 +1,106 @@
+/******************************************************************************
+ * Host simulation shim - AXI GPIO driver, see include/xgpio.h
+ ******************************************************************************/
+
+#include "xgpio.h"
+#include "xparameters.h"
+#include "xscugic.h"
+#include "xstatus.h"
+
+static XGpio_Config ConfigTable[] = {
+    {
+        "xlnx,axi-gpio-2.0",
+        XPAR_XGPIO_0_BASEADDR,
+        XPAR_XGPIO_0_INTERRUPT_PRESENT,
+        XPAR_XGPIO_0_IS_DUAL,
+        XPAR_FABRIC_XGPIO_0_INTR,
+        XPAR_SCUGIC_0_DIST_BASEADDR,
+    },
+};
+
+XGpio_Config *XGpio_LookupConfig(UINTPTR BaseAddress)
+{
+    u32 i;
+
+    for (i = 0; i < sizeof(ConfigTable) / sizeof(ConfigTable[0]); i++) {
+        if (ConfigTable[i].BaseAddress == BaseAddress) {
+            return &ConfigTable[i];
+        }
+    }
+    return NULL;
+}
+
+int XGpio_Initialize(XGpio *InstancePtr, UINTPTR BaseAddress)
+{
+    XGpio_Config *ConfigPtr = XGpio_LookupConfig(BaseAddress);
+
+    if (ConfigPtr == NULL) {
+        InstancePtr->IsReady = 0;
+        return XST_DEVICE_NOT_FOUND;
+    }
+
+    InstancePtr->BaseAddress = ConfigPtr->BaseAddress;
+    InstancePtr->InterruptPresent = ConfigPtr->InterruptPresent;
+    InstancePtr->IsDual = ConfigPtr->IsDual;
+    InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
+    return XST_SUCCESS;
+}
+
+void XGpio_SetDataDirection(XGpio *InstancePtr, unsigned Channel,
+                            u32 DirectionMask)
+{
+    XGpio_WriteReg(InstancePtr->BaseAddress,
+                   ((Channel - 1U) * XGPIO_CHAN_OFFSET) + XGPIO_TRI_OFFSET,
+                   DirectionMask);
+}
+
+u32 XGpio_DiscreteRead(XGpio *InstancePtr, unsigned Channel)
+{
+    return XGpio_ReadReg(InstancePtr->BaseAddress,
+                         ((Channel - 1U) * XGPIO_CHAN_OFFSET) +
+                         XGPIO_DATA_OFFSET);
+}
+
+/* ------------------------------------------------------------
+ * Interrupts
+ * ------------------------------------------------------------ */
+void XGpio_InterruptGlobalEnable(XGpio *InstancePtr)
+{
+    XGpio_WriteReg(InstancePtr->BaseAddress, XGPIO_GIE_OFFSET,
+                   XGPIO_GIE_GINTR_ENABLE_MASK);
+}
+
+void XGpio_InterruptGlobalDisable(XGpio *InstancePtr)
+{
+    XGpio_WriteReg(InstancePtr->BaseAddress, XGPIO_GIE_OFFSET, 0);
+}
+
+void XGpio_InterruptEnable(XGpio *InstancePtr, u32 Mask)
+{
+    u32 Register = XGpio_ReadReg(InstancePtr->BaseAddress, XGPIO_IER_OFFSET);
+
+    XGpio_WriteReg(InstancePtr->BaseAddress, XGPIO_IER_OFFSET,
+                   Register | Mask);
+}
+
+void XGpio_InterruptDisable(XGpio *InstancePtr, u32 Mask)
+{
+    u32 Register = XGpio_ReadReg(InstancePtr->BaseAddress, XGPIO_IER_OFFSET);
+
+    XGpio_WriteReg(InstancePtr->BaseAddress, XGPIO_IER_OFFSET,
+                   Register & ~Mask);
+}
+
+/* IPISR is toggle-on-write, only the bits set in both are cleared */
+void XGpio_InterruptClear(XGpio *InstancePtr, u32 Mask)
+{
+    u32 Register = XGpio_ReadReg(InstancePtr->BaseAddress, XGPIO_ISR_OFFSET);
+
+    XGpio_WriteReg(InstancePtr->BaseAddress, XGPIO_ISR_OFFSET,
+                   Register & Mask);
+}
+
+u32 XGpio_InterruptGetStatus(XGpio *InstancePtr)
+{
+    return XGpio_ReadReg(InstancePtr->BaseAddress, XGPIO_ISR_OFFSET);
+}
@@ -0,0 +1,41 @@
+/******************************************************************************
+ * Host simulation shim - SDT interrupt wrapper on the simulated GIC
+ ******************************************************************************/
+
+#include "xinterrupt_wrap.h"
+#include "sim.h"
+
+int XSetupInterruptSystem(void *DriverInstance, void *IntrHandler, u32 IntrId,
+                          UINTPTR IntrParent, u16 Priority)
+{
+    (void)IntrParent;
+
+    Sim_ConnectIrq(IntrId, (void (*)(void *))IntrHandler, DriverInstance,
+                   (u8)Priority);
+    Sim_EnableIrq(IntrId, 1);
+    Sim_IrqUnmask();
+    return XST_SUCCESS;
+}
+
+void XDisconnectInterruptCntrl(u32 IntrId, UINTPTR IntrParent)
+{
+    (void)IntrParent;
+
+    Sim_DisconnectIrq(IntrId);
+}
+
+int XEnableIntrId(u32 IntrId, UINTPTR IntrParent)
+{
+    (void)IntrParent;
+
+    Sim_EnableIrq(IntrId, 1);
+    return XST_SUCCESS;
+}
+
+int XDisableIntrId(u32 IntrId, UINTPTR IntrParent)
+{
+    (void)IntrParent;
+
+    Sim_EnableIrq(IntrId, 0);
+    return XST_SUCCESS;
+}
@@ -0,0 +1,271 @@
+/******************************************************************************
+ * Host simulation shim - AXI timer driver, see include/xtmrctr.h
+ ******************************************************************************/
+
+#include "xtmrctr.h"
+#include "xparameters.h"
+#include "xscugic.h"
+
+#define XTC_NUM_OPTIONS     7U
+
+typedef struct {
+    u32 Option;
+    u32 Mask;
+} OptionsMap;
+
+static const OptionsMap TmrCtrOptionsTable[XTC_NUM_OPTIONS] = {
+    {XTC_CASCADE_MODE_OPTION, XTC_CSR_CASC_MASK},
+    {XTC_ENABLE_ALL_OPTION, XTC_CSR_ENABLE_ALL_MASK},
+    {XTC_DOWN_COUNT_OPTION, XTC_CSR_DOWN_COUNT_MASK},
+    {XTC_CAPTURE_MODE_OPTION, XTC_CSR_CAPTURE_MODE_ENABLE_MASK |
+                              XTC_CSR_EXT_CAPTURE_MASK},
+    {XTC_INT_MODE_OPTION, XTC_CSR_ENABLE_INT_MASK},
+    {XTC_AUTO_RELOAD_OPTION, XTC_CSR_AUTO_RELOAD_MASK},
+    {XTC_EXT_COMPARE_OPTION, XTC_CSR_EXT_GENERATE_MASK},
+};
+
+static XTmrCtr_Config ConfigTable[] = {
+    {
+        "xlnx,axi-timer-2.0",
+        XPAR_XTMRCTR_0_BASEADDR,
+        XPAR_XTMRCTR_0_CLOCK_FREQUENCY,
+        XPAR_FABRIC_XTMRCTR_0_INTR,
+        XPAR_SCUGIC_0_DIST_BASEADDR,
+    },
+};
+
+static void StubHandler(void *CallBackRef, u8 TmrCtrNumber)
+{
+    (void)CallBackRef;
+    (void)TmrCtrNumber;
+}
+
+XTmrCtr_Config *XTmrCtr_LookupConfig(UINTPTR BaseAddress)
+{
+    u32 i;
+
+    for (i = 0; i < sizeof(ConfigTable) / sizeof(ConfigTable[0]); i++) {
+        if (ConfigTable[i].BaseAddress == BaseAddress) {
+            return &ConfigTable[i];
+        }
+    }
+    return NULL;
+}
+
+int XTmrCtr_Initialize(XTmrCtr *InstancePtr, UINTPTR BaseAddr)
+{
+    XTmrCtr_Config *ConfigPtr = XTmrCtr_LookupConfig(BaseAddr);
+    u8 TmrCtrNumber;
+
+    if (ConfigPtr == NULL) {
+        return XST_FAILURE;
+    }
+
+    InstancePtr->Config = *ConfigPtr;
+    InstancePtr->BaseAddress = ConfigPtr->BaseAddress;
+    InstancePtr->Handler = StubHandler;
+    InstancePtr->CallBackRef = NULL;
+    InstancePtr->IsStartedTmrCtr0 = 0;
+    InstancePtr->IsStartedTmrCtr1 = 0;
+    InstancePtr->Stats.Interrupts = 0;
+
+    for (TmrCtrNumber = 0; TmrCtrNumber < XTC_DEVICE_TIMER_COUNT;
+         TmrCtrNumber++) {
+        XTmrCtr_WriteReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                         XTC_TCSR_OFFSET, 0);
+        XTmrCtr_WriteReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                         XTC_TLR_OFFSET, 0);
+        XTmrCtr_WriteReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                         XTC_TCSR_OFFSET,
+                         XTC_CSR_INT_OCCURED_MASK | XTC_CSR_LOAD_MASK);
+        XTmrCtr_WriteReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                         XTC_TCSR_OFFSET, 0);
+    }
+
+    InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
+    return XST_SUCCESS;
+}
+
+/* Load a known value and check the counter moves away from it */
+int XTmrCtr_SelfTest(XTmrCtr *InstancePtr, u8 TmrCtrNumber)
+{
+    u32 TimerCount1;
+    u32 TimerCount2;
+    u32 Loop;
+
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                     XTC_TLR_OFFSET, 0xA5A5A5A5U);
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                     XTC_TCSR_OFFSET, XTC_CSR_LOAD_MASK);
+    TimerCount1 = XTmrCtr_ReadReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                                  XTC_TCR_OFFSET);
+    if (TimerCount1 != 0xA5A5A5A5U) {
+        return XST_FAILURE;
+    }
+
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                     XTC_TCSR_OFFSET, XTC_CSR_ENABLE_TMR_MASK);
+    for (Loop = 0; Loop < 1000U; Loop++) {
+        TimerCount2 = XTmrCtr_ReadReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                                      XTC_TCR_OFFSET);
+        if (TimerCount2 != TimerCount1) {
+            break;
+        }
+    }
+
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                     XTC_TCSR_OFFSET, 0);
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                     XTC_TLR_OFFSET, 0);
+
+    return (Loop < 1000U) ? XST_SUCCESS : XST_FAILURE;
+}
+
+void XTmrCtr_Start(XTmrCtr *InstancePtr, u8 TmrCtrNumber)
+{
+    u32 ControlStatusReg;
+
+    ControlStatusReg = XTmrCtr_ReadReg(InstancePtr->BaseAddress,
+                                       TmrCtrNumber, XTC_TCSR_OFFSET);
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                     XTC_TCSR_OFFSET, XTC_CSR_LOAD_MASK);
+
+    if (TmrCtrNumber == 0U) {
+        InstancePtr->IsStartedTmrCtr0 = XIL_COMPONENT_IS_READY;
+    } else {
+        InstancePtr->IsStartedTmrCtr1 = XIL_COMPONENT_IS_READY;
+    }
+
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                     XTC_TCSR_OFFSET,
+                     ControlStatusReg | XTC_CSR_ENABLE_TMR_MASK);
+}
+
+void XTmrCtr_Stop(XTmrCtr *InstancePtr, u8 TmrCtrNumber)
+{
+    u32 ControlStatusReg;
+
+    ControlStatusReg = XTmrCtr_ReadReg(InstancePtr->BaseAddress,
+                                       TmrCtrNumber, XTC_TCSR_OFFSET);
+    ControlStatusReg &= ~XTC_CSR_ENABLE_TMR_MASK;
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                     XTC_TCSR_OFFSET, ControlStatusReg);
+
+    if (TmrCtrNumber == 0U) {
+        InstancePtr->IsStartedTmrCtr0 = 0;
+    } else {
+        InstancePtr->IsStartedTmrCtr1 = 0;
+    }
+}
+
+u32 XTmrCtr_GetValue(XTmrCtr *InstancePtr, u8 TmrCtrNumber)
+{
+    return XTmrCtr_ReadReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                           XTC_TCR_OFFSET);
+}
+
+void XTmrCtr_SetResetValue(XTmrCtr *InstancePtr, u8 TmrCtrNumber,
+                           u32 ResetValue)
+{
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                     XTC_TLR_OFFSET, ResetValue);
+}
+
+u32 XTmrCtr_GetCaptureValue(XTmrCtr *InstancePtr, u8 TmrCtrNumber)
+{
+    return XTmrCtr_ReadReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                           XTC_TLR_OFFSET);
+}
+
+int XTmrCtr_IsExpired(XTmrCtr *InstancePtr, u8 TmrCtrNumber)
+{
+    u32 ControlStatusReg;
+
+    ControlStatusReg = XTmrCtr_ReadReg(InstancePtr->BaseAddress,
+                                       TmrCtrNumber, XTC_TCSR_OFFSET);
+    return (ControlStatusReg & XTC_CSR_INT_OCCURED_MASK) ==
+           XTC_CSR_INT_OCCURED_MASK;
+}
+
+void XTmrCtr_Reset(XTmrCtr *InstancePtr, u8 TmrCtrNumber)
+{
+    u32 CounterControlReg;
+
+    CounterControlReg = XTmrCtr_ReadReg(InstancePtr->BaseAddress,
+                                        TmrCtrNumber, XTC_TCSR_OFFSET);
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                     XTC_TCSR_OFFSET, CounterControlReg | XTC_CSR_LOAD_MASK);
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                     XTC_TCSR_OFFSET, CounterControlReg);
+}
+
+void XTmrCtr_SetOptions(XTmrCtr *InstancePtr, u8 TmrCtrNumber, u32 Options)
+{
+    u32 CounterControlReg;
+    u32 Index;
+
+    CounterControlReg = XTmrCtr_ReadReg(InstancePtr->BaseAddress,
+                                        TmrCtrNumber, XTC_TCSR_OFFSET);
+    for (Index = 0; Index < XTC_NUM_OPTIONS; Index++) {
+        if ((Options & TmrCtrOptionsTable[Index].Option) != 0U) {
+            CounterControlReg |= TmrCtrOptionsTable[Index].Mask;
+        } else {
+            CounterControlReg &= ~TmrCtrOptionsTable[Index].Mask;
+        }
+    }
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, TmrCtrNumber,
+                     XTC_TCSR_OFFSET, CounterControlReg);
+}
+
+u32 XTmrCtr_GetOptions(XTmrCtr *InstancePtr, u8 TmrCtrNumber)
+{
+    u32 CounterControlReg;
+    u32 Options = 0;
+    u32 Index;
+
+    CounterControlReg = XTmrCtr_ReadReg(InstancePtr->BaseAddress,
+                                        TmrCtrNumber, XTC_TCSR_OFFSET);
+    for (Index = 0; Index < XTC_NUM_OPTIONS; Index++) {
+        if ((CounterControlReg & TmrCtrOptionsTable[Index].Mask) != 0U) {
+            Options |= TmrCtrOptionsTable[Index].Option;
+        }
+    }
+    return Options;
+}
+
+void XTmrCtr_SetHandler(XTmrCtr *InstancePtr, XTmrCtr_Handler FuncPtr,
+                        void *CallBackRef)
+{
+    InstancePtr->Handler = FuncPtr;
+    InstancePtr->CallBackRef = CallBackRef;
+}
+
+/* Same per-counter sequence as the driver: call back, then clear
+ * T0INT by writing back the status with the bit set. */
+void XTmrCtr_InterruptHandler(void *InstancePtr)
+{
+    XTmrCtr *TmrCtrPtr = (XTmrCtr *)InstancePtr;
+    u32 ControlStatusReg;
+    u8 TmrCtrNumber;
+
+    for (TmrCtrNumber = 0; TmrCtrNumber < XTC_DEVICE_TIMER_COUNT;
+         TmrCtrNumber++) {
+        ControlStatusReg = XTmrCtr_ReadReg(TmrCtrPtr->BaseAddress,
+                                           TmrCtrNumber, XTC_TCSR_OFFSET);
+        if ((ControlStatusReg & XTC_CSR_ENABLE_INT_MASK) == 0U) {
+            continue;
+        }
+        if ((ControlStatusReg & XTC_CSR_INT_OCCURED_MASK) == 0U) {
+            continue;
+        }
+
+        TmrCtrPtr->Stats.Interrupts++;
+        TmrCtrPtr->Handler(TmrCtrPtr->CallBackRef, TmrCtrNumber);
+
+        ControlStatusReg = XTmrCtr_ReadReg(TmrCtrPtr->BaseAddress,
+                                           TmrCtrNumber, XTC_TCSR_OFFSET);
+        XTmrCtr_WriteReg(TmrCtrPtr->BaseAddress, TmrCtrNumber,
+                         XTC_TCSR_OFFSET,
+                         ControlStatusReg | XTC_CSR_INT_OCCURED_MASK);
+    }
+}
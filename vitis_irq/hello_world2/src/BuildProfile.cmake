@@ -0,0 +1,32 @@
+# Build profiles for hello_world2
+#
+# Debug (default, CMAKE_BUILD_TYPE empty or Debug): the -O0 -g3 flags
+# of UserConfig.cmake, unchanged.
+#
+# Release (CMAKE_BUILD_TYPE=Release): -O2 with link-time optimization,
+# every function and object in its own section and unreferenced ones
+# dropped at link time. USER_COMPILE_GARBAGE only applies to MicroBlaze,
+# so the section flags are given here. The flags come after the
+# UserConfig.cmake ones, so -O2 overrides -O0; debug info is kept, it
+# is not loaded to the target. The linker prints OCM/DDR usage after
+# print_elf_size.
+#
+#   cmake -DCMAKE_BUILD_TYPE=Release ...
+#
+# host/CMakeLists.txt builds its "bench" target with the same flags.
+
+set(HELLO_RELEASE_C_FLAGS -O2 -flto -ffunction-sections -fdata-sections)
+set(HELLO_RELEASE_LINK_FLAGS -O2 -flto -Wl,--gc-sections)
+
+string(REPLACE ";" " " _release_c_flags "${HELLO_RELEASE_C_FLAGS}")
+string(REPLACE ";" " " _release_link_flags "${HELLO_RELEASE_LINK_FLAGS}")
+set(CMAKE_C_FLAGS_RELEASE "${_release_c_flags}")
+set(CMAKE_CXX_FLAGS_RELEASE "${_release_c_flags}")
+set(CMAKE_EXE_LINKER_FLAGS_RELEASE
+    "${_release_link_flags} -Wl,--print-memory-usage")
+
+if(CMAKE_BUILD_TYPE STREQUAL "Release")
+    message(STATUS "hello_world2: release profile (${_release_c_flags})")
+else()
+    message(STATUS "hello_world2: debug profile")
+endif()
@@ -31,6 +31,23 @@ set(USER_INCLUDE_DIRECTORIES
 set(USER_COMPILE_SOURCES
 "helloworld.c"
 "platform.c"
+"isr_log.c"
+"latency.c"
+"fast_tmr.c"
+"idle.c"
+"twheel.c"
+"deadline.c"
+"clock64.c"
+"mmu.c"
+"button.c"
+"pwm.c"
+"capture.c"
+"irq_affinity.c"
+"amp.c"
+"evtq.c"
+"fiq.c"
+"irq_rate.c"
+"irq_nest.c"
 )
 
 # -----------------------------------------
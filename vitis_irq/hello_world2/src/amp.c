@@ -0,0 +1,292 @@
+/******************************************************************************
+ * Second A53 core for interrupt handling, with an OCM mailbox - see amp.h
+ ******************************************************************************/
+
+#include "amp.h"
+#include "irq_affinity.h"
+#include "xpseudo_asm.h"
+#include "xil_exception.h"
+#include "xstatus.h"
+#include "fast_mem.h"
+
+#define AMP_MAILBOX_MASK    (AMP_MAILBOX_DEPTH - 1U)
+
+#if defined(__aarch64__) && !defined(HOST_SIM)
+
+#include <stddef.h>
+#include "xparameters.h"
+#include "xil_io.h"
+#include "xil_cache.h"
+#include "xtime_l.h"
+#include "exc_frame.h"
+
+/* CRF_APB and APU registers */
+#define CRF_APB_RST_FPD_APU     0xFD1A0104U
+#define RST_ACPU1               (1U << 1)
+#define RST_ACPU1_PWRON         (1U << 11)
+#define APU_RVBARADDR1L         0xFD5C0048U
+#define APU_RVBARADDR1H         0xFD5C004CU
+
+/* GIC CPU interface, banked per core; same setup as XScuGic_CfgInitialize */
+#define GICC_CTLR               0x00U
+#define GICC_PMR                0x04U
+#define GICC_CTLR_ENABLE        0x07U
+#define GICC_PMR_ALL            0xF0U
+
+#define AMP_START_TIMEOUT_US    100000U
+
+/*
+ * Core 0's EL3 state for core 1, read by AmpCore1Boot with the MMU off,
+ * so cleaned to memory before the reset is released. The offsets are
+ * hard-coded in the assembly below.
+ */
+typedef struct {
+    u64 StackTop;
+    u64 Vbar;
+    u64 Mair;
+    u64 Tcr;
+    u64 Ttbr0;
+    u64 Sctlr;
+    u64 Scr;
+    u64 Cptr;
+} AmpBootParams;
+
+_Static_assert(offsetof(AmpBootParams, Vbar) == 0x08, "AmpCore1Boot");
+_Static_assert(offsetof(AmpBootParams, Cptr) == 0x38, "AmpCore1Boot");
+
+void AmpCore1Boot(void);
+void AmpCore1Main(void);
+void IRQInterrupt(void);
+
+extern u8 AmpCore1Vectors[];
+
+__attribute__((used)) AmpBootParams AmpBoot
+    __attribute__((aligned(AMP_CACHE_LINE)));
+
+static u8 Core1Stack[AMP_CORE1_STACK_SIZE] __attribute__((aligned(16)));
+static Amp_Entry Core1Entry;
+static void *Core1Arg;
+static u32 Core1Up;
+
+/* ------------------------------------------------------------
+ * Core 1 reset vector. SMPEN has to be set before the caches are
+ * turned on; the L1 caches are invalidated by the reset itself.
+ * ------------------------------------------------------------ */
+__asm__(
+    "   .section .text.amp_core1_boot, \"ax\"\n"
+    "   .balign 64\n"
+    "   .global AmpCore1Boot\n"
+    "   .type   AmpCore1Boot, %function\n"
+    "AmpCore1Boot:\n"
+    "   adrp    x0, AmpBoot\n"
+    "   add     x0, x0, :lo12:AmpBoot\n"
+    "   ldr     x1, [x0, #0x38]\n"
+    "   msr     cptr_el3, x1\n"
+    "   ldr     x1, [x0, #0x30]\n"
+    "   msr     scr_el3, x1\n"
+    "   mrs     x1, s3_1_c15_c2_1\n"        /* CPUECTLR_EL1 */
+    "   orr     x1, x1, #(1 << 6)\n"        /* SMPEN */
+    "   msr     s3_1_c15_c2_1, x1\n"
+    "   ldr     x1, [x0, #0x08]\n"
+    "   msr     vbar_el3, x1\n"
+    "   ldr     x1, [x0, #0x10]\n"
+    "   msr     mair_el3, x1\n"
+    "   ldr     x1, [x0, #0x18]\n"
+    "   msr     tcr_el3, x1\n"
+    "   ldr     x1, [x0, #0x20]\n"
+    "   msr     ttbr0_el3, x1\n"
+    "   tlbi    alle3\n"
+    "   ic      iallu\n"
+    "   dsb     sy\n"
+    "   isb\n"
+    "   ldr     x1, [x0, #0x28]\n"
+    "   msr     sctlr_el3, x1\n"
+    "   isb\n"
+    "   ldr     x1, [x0, #0x00]\n"
+    "   mov     sp, x1\n"
+    "   bl      AmpCore1Main\n"
+    "1: wfi\n"
+    "   b       1b\n"
+    "   .size   AmpCore1Boot, . - AmpCore1Boot\n"
+    "   .previous\n");
+
+/* Keep the vector next to the rest of the interrupt path */
+#ifdef FAST_OCM
+#define AMP_VECTOR_SECTION  ".fast_text"
+#else
+#define AMP_VECTOR_SECTION  ".text.amp_core1_vectors"
+#endif
+
+/* ------------------------------------------------------------
+ * VBAR_EL3 table of core 1. Both IRQ entries of the current EL
+ * save the full frame (exc_frame.h) on core 1's stack and call the
+ * BSP's IRQInterrupt, which dispatches through the shared handler
+ * table. The BSP vectors would save FP lazily into the one context
+ * core 0 uses too. Every other entry goes to the same slot of the
+ * BSP table; with FP never trapped on core 1, none of them touch
+ * that context.
+ * ------------------------------------------------------------ */
+#define AMP_FORWARD(Offset) \
+    "   .balign 0x80\n" \
+    "   b       _vector_table + " #Offset "\n"
+
+__asm__(
+    "   .section " AMP_VECTOR_SECTION ", \"ax\"\n"
+    "   .balign 0x800\n"
+    "   .global AmpCore1Vectors\n"
+    "AmpCore1Vectors:\n"
+    AMP_FORWARD(0x000)
+    "   .balign 0x80\n"
+    "   b       AmpCore1Irq\n"              /* IRQ, current EL, SP0 */
+    AMP_FORWARD(0x100)
+    AMP_FORWARD(0x180)
+    AMP_FORWARD(0x200)
+    "   .balign 0x80\n"
+    "   b       AmpCore1Irq\n"              /* IRQ, current EL, SPx */
+    AMP_FORWARD(0x300)
+    AMP_FORWARD(0x380)
+    AMP_FORWARD(0x400)
+    AMP_FORWARD(0x480)
+    AMP_FORWARD(0x500)
+    AMP_FORWARD(0x580)
+    AMP_FORWARD(0x600)
+    AMP_FORWARD(0x680)
+    AMP_FORWARD(0x700)
+    AMP_FORWARD(0x780)
+    "   .balign 0x80\n"
+    "AmpCore1Irq:\n"
+    EXC_FRAME_SAVE
+    "   bl      IRQInterrupt\n"
+    EXC_FRAME_RESTORE
+    "   eret\n"
+    "   .previous\n");
+
+/* ------------------------------------------------------------
+ * Core 1, MMU and caches on. Returns to the WFI loop above with
+ * IRQs unmasked.
+ * ------------------------------------------------------------ */
+__attribute__((used)) void AmpCore1Main(void)
+{
+    Xil_Out32(XPAR_SCUGIC_0_CPU_BASEADDR + GICC_PMR, GICC_PMR_ALL);
+    Xil_Out32(XPAR_SCUGIC_0_CPU_BASEADDR + GICC_CTLR, GICC_CTLR_ENABLE);
+
+    Core1Entry(Core1Arg);
+
+    __atomic_store_n(&Core1Up, 1U, __ATOMIC_RELEASE);
+    dsb();
+    sev();
+    Xil_ExceptionEnable();
+}
+
+/* ------------------------------------------------------------
+ * Release core 1 and wait for it to run Entry(Arg). Returns
+ * XST_DEVICE_IS_STARTED if it is already out of reset, XST_FAILURE
+ * if it does not come up.
+ * ------------------------------------------------------------ */
+int Amp_StartCore1(Amp_Entry Entry, void *Arg)
+{
+    u64 Boot = (u64)(UINTPTR)AmpCore1Boot;
+    XTime Start;
+    XTime Now;
+
+    if ((Xil_In32(CRF_APB_RST_FPD_APU) & RST_ACPU1) == 0) {
+        return XST_DEVICE_IS_STARTED;
+    }
+
+    Core1Entry = Entry;
+    Core1Arg = Arg;
+    Core1Up = 0;
+
+    AmpBoot.StackTop = (u64)(UINTPTR)&Core1Stack[AMP_CORE1_STACK_SIZE];
+    AmpBoot.Vbar = (u64)(UINTPTR)AmpCore1Vectors;
+    AmpBoot.Mair = mfcp(MAIR_EL3);
+    AmpBoot.Tcr = mfcp(TCR_EL3);
+    AmpBoot.Ttbr0 = mfcp(TTBR0_EL3);
+    AmpBoot.Sctlr = mfcp(SCTLR_EL3);
+    AmpBoot.Scr = mfcp(SCR_EL3);
+    AmpBoot.Cptr = mfcp(CPTR_EL3);
+    Xil_DCacheFlushRange((INTPTR)&AmpBoot, sizeof(AmpBoot));
+
+    Xil_Out32(APU_RVBARADDR1L, (u32)Boot);
+    Xil_Out32(APU_RVBARADDR1H, (u32)(Boot >> 32));
+    dsb();
+    Xil_Out32(CRF_APB_RST_FPD_APU, Xil_In32(CRF_APB_RST_FPD_APU) &
+              ~(RST_ACPU1 | RST_ACPU1_PWRON));
+
+    XTime_GetTime(&Start);
+    while (__atomic_load_n(&Core1Up, __ATOMIC_ACQUIRE) == 0) {
+        XTime_GetTime(&Now);
+        if ((Now - Start) >
+            ((u64)AMP_START_TIMEOUT_US * COUNTS_PER_SECOND / 1000000U)) {
+            return XST_FAILURE;
+        }
+    }
+    return XST_SUCCESS;
+}
+
+#else
+
+#include "sim.h"
+
+int Amp_StartCore1(Amp_Entry Entry, void *Arg)
+{
+    return Sim_StartCore1(Entry, Arg);
+}
+
+#endif
+
+/* ------------------------------------------------------------
+ * Initialize an empty mailbox, before either core uses it
+ * ------------------------------------------------------------ */
+void AmpMailbox_Init(AmpMailbox *BoxPtr)
+{
+    BoxPtr->Head = 0;
+    BoxPtr->Tail = 0;
+    BoxPtr->Dropped = 0;
+}
+
+/* ------------------------------------------------------------
+ * Producer side, one core at a time (interrupt context).
+ * Returns XST_FAILURE when the mailbox is full; the message is
+ * dropped and counted.
+ * ------------------------------------------------------------ */
+FAST_TEXT int AmpMailbox_Post(AmpMailbox *BoxPtr, u16 Event, u32 Data)
+{
+    u32 Head = BoxPtr->Head;
+    u32 Tail = __atomic_load_n(&BoxPtr->Tail, __ATOMIC_ACQUIRE);
+    AmpMsg *MsgPtr;
+
+    if ((Head - Tail) >= AMP_MAILBOX_DEPTH) {
+        BoxPtr->Dropped++;
+        return XST_FAILURE;
+    }
+
+    MsgPtr = &BoxPtr->Msg[Head & AMP_MAILBOX_MASK];
+    MsgPtr->Event = Event;
+    MsgPtr->Cpu = (u16)IrqAffinity_CpuId();
+    MsgPtr->Data = Data;
+
+    /* Publish, then wake the other core if it sits in WFE */
+    __atomic_store_n(&BoxPtr->Head, Head + 1U, __ATOMIC_RELEASE);
+    dsb();
+    sev();
+    return XST_SUCCESS;
+}
+
+/* ------------------------------------------------------------
+ * Consumer side, the other core. Returns XST_SUCCESS with *MsgPtr
+ * filled in, or XST_NO_DATA when the mailbox is empty.
+ * ------------------------------------------------------------ */
+int AmpMailbox_Take(AmpMailbox *BoxPtr, AmpMsg *MsgPtr)
+{
+    u32 Tail = BoxPtr->Tail;
+    u32 Head = __atomic_load_n(&BoxPtr->Head, __ATOMIC_ACQUIRE);
+
+    if (Head == Tail) {
+        return XST_NO_DATA;
+    }
+
+    *MsgPtr = BoxPtr->Msg[Tail & AMP_MAILBOX_MASK];
+    __atomic_store_n(&BoxPtr->Tail, Tail + 1U, __ATOMIC_RELEASE);
+    return XST_SUCCESS;
+}
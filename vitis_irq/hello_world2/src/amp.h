@@ -0,0 +1,91 @@
+/******************************************************************************
+ * Second A53 core for interrupt handling, with an OCM mailbox
+ *
+ * Amp_StartCore1() brings core 1 up inside this application, at EL3
+ * like core 0. Core 0 writes the core 1 entry point to RVBARADDR1 and
+ * releases ACPU1 from reset in CRF_APB. Core 1 then does the following:
+ *   - takes SMP coherency and core 0's EL3 MMU settings, so both
+ *     cores see the same cached memory
+ *   - sets up its own stack and exception vectors
+ *   - enables its banked GIC CPU interface
+ *   - runs the caller's setup function
+ *   - unmasks IRQs and sleeps in WFI
+ * From then on it only runs the interrupt handlers that the
+ * distributor targets at it (irq_affinity.h). The handler table is
+ * shared, so an interrupt connected by core 0 runs its usual handler on
+ * core 1.
+ *
+ * The BSP vectors keep one lazy FP context in asm_vectors.S for all
+ * cores, so core 1 does not use them for IRQ. Its IRQ vector saves
+ * every FP/SIMD register on core 1's stack instead (exc_frame.h), and
+ * handlers on either core may use FP. The PMU firmware must leave
+ * ACPU1 powered, which it does by default.
+ *
+ * AmpMailbox is a single-producer / single-consumer ring in OCM that
+ * hands events from the core that handles an interrupt to the core
+ * that runs the main loop. Head and Tail are on separate cache lines,
+ * so each is written by one core only. Post ends with SEV so a
+ * consumer parked in WFE wakes up.
+ *
+ * In the host simulation core 1 is a second interrupt context. The
+ * setup function runs at once, and interrupts targeted at CPU 1 are
+ * taken even while core 0 is masked or busy in a handler.
+ ******************************************************************************/
+
+#ifndef AMP_H_
+#define AMP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+#define AMP_CACHE_LINE          64U
+
+/* Messages in the mailbox, must be a power of two */
+#ifndef AMP_MAILBOX_DEPTH
+#define AMP_MAILBOX_DEPTH       64U
+#endif
+
+#if (AMP_MAILBOX_DEPTH & (AMP_MAILBOX_DEPTH - 1U)) != 0
+#error "AMP_MAILBOX_DEPTH must be a power of two"
+#endif
+
+#ifndef AMP_CORE1_STACK_SIZE
+#define AMP_CORE1_STACK_SIZE    0x2000U
+#endif
+
+/* Core 1 setup, runs once on core 1 before its IRQs are unmasked */
+typedef void (*Amp_Entry)(void *Arg);
+
+typedef struct {
+    u16 Event;          /* Application defined */
+    u16 Cpu;            /* Core that posted it */
+    u32 Data;
+} AmpMsg;
+
+typedef struct {
+    u32 Head __attribute__((aligned(AMP_CACHE_LINE)));  /* Producer only */
+    u32 Dropped;        /* Messages lost because the ring was full */
+    u32 Tail __attribute__((aligned(AMP_CACHE_LINE)));  /* Consumer only */
+    AmpMsg Msg[AMP_MAILBOX_DEPTH] __attribute__((aligned(AMP_CACHE_LINE)));
+} AmpMailbox;
+
+/* Placement of mailboxes shared between the cores: OCM */
+#if defined(__aarch64__) && !defined(HOST_SIM)
+#define AMP_SHARED  __attribute__((section(".ocm_shared")))
+#else
+#define AMP_SHARED
+#endif
+
+int Amp_StartCore1(Amp_Entry Entry, void *Arg);
+
+void AmpMailbox_Init(AmpMailbox *BoxPtr);
+int AmpMailbox_Post(AmpMailbox *BoxPtr, u16 Event, u32 Data);
+int AmpMailbox_Take(AmpMailbox *BoxPtr, AmpMsg *MsgPtr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
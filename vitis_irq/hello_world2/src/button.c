@@ -0,0 +1,212 @@
+/******************************************************************************
+ * Interrupt-driven push button with timer wheel debounce - see button.h
+ ******************************************************************************/
+
+#include "button.h"
+#include "cycles.h"
+#include "xparameters.h"
+#include "xstatus.h"
+#include "xtime_l.h"
+#include "xil_printf.h"
+
+#define BUTTON_DEBOUNCE_TICKS \
+    ((BUTTON_DEBOUNCE_MS * (XPAR_XTMRCTR_0_CLOCK_FREQUENCY / 1000U)) / \
+     TWHEEL_TICK_CYCLES)
+
+#define BUTTON_POLL_SAMPLES 64U
+
+static u32 ReadLevel(Button *InstancePtr)
+{
+    return XGpio_DiscreteRead(&InstancePtr->Gpio, BUTTON_CHANNEL) &
+           BUTTON_MASK;
+}
+
+static u64 CyclesToUs(u64 Cycles)
+{
+    return (Cycles * 1000000U) / CYCLES_PER_SECOND;
+}
+
+/* ------------------------------------------------------------
+ * Debounce timer, runs from the wheel's interrupt handler
+ * ------------------------------------------------------------ */
+static void DebounceExpired(TWheelTimer *TimerPtr, void *CallBackRef)
+{
+    Button *InstancePtr = (Button *)CallBackRef;
+    u64 Start = Cycles_Read();
+    u32 Level = ReadLevel(InstancePtr);
+
+    if (Level != InstancePtr->Stable) {
+        InstancePtr->Stable = Level;
+        if (Level != 0) {
+            InstancePtr->Presses++;
+        } else {
+            InstancePtr->Releases++;
+        }
+        InstancePtr->Handler(InstancePtr->CallBackRef, Level,
+                             InstancePtr->EdgeTime);
+    }
+
+    /* Drop the bounces latched while masked, the level is known */
+    XGpio_InterruptClear(&InstancePtr->Gpio, XGPIO_IR_CH1_MASK);
+    XGpio_InterruptEnable(&InstancePtr->Gpio, XGPIO_IR_CH1_MASK);
+
+    if (ReadLevel(InstancePtr) != Level) {
+        /* Changed before IPISR was cleared, no interrupt will come */
+        XGpio_InterruptDisable(&InstancePtr->Gpio, XGPIO_IR_CH1_MASK);
+        XTime_GetTime(&InstancePtr->EdgeTime);
+        TWheel_Add(InstancePtr->WheelPtr, TimerPtr,
+                   InstancePtr->DebounceTicks, 0);
+        InstancePtr->Rechecks++;
+    } else {
+        InstancePtr->Settling = FALSE;
+    }
+
+    InstancePtr->HandlerCycles += Cycles_Read() - Start;
+    InstancePtr->HandlerRuns++;
+}
+
+/* ------------------------------------------------------------
+ * Initialize the button on the GPIO at BaseAddress. The design must
+ * have the GPIO interrupt (C_INTERRUPT_PRESENT) and the wheel must be
+ * running on the AXI timer. Also measures the cost of one poll, so
+ * the cycle counter must be enabled.
+ * ------------------------------------------------------------ */
+int Button_Initialize(Button *InstancePtr, UINTPTR BaseAddress,
+                      TWheel *WheelPtr, Button_Handler Handler,
+                      void *CallBackRef)
+{
+    u64 Start;
+    u32 i;
+    int Status;
+
+    Status = XGpio_Initialize(&InstancePtr->Gpio, BaseAddress);
+    if (Status != XST_SUCCESS) {
+        return Status;
+    }
+    if (!InstancePtr->Gpio.InterruptPresent) {
+        return XST_FAILURE;
+    }
+
+    InstancePtr->WheelPtr = WheelPtr;
+    InstancePtr->DebounceTicks = BUTTON_DEBOUNCE_TICKS;
+    InstancePtr->Handler = Handler;
+    InstancePtr->CallBackRef = CallBackRef;
+    TWheel_TimerInit(&InstancePtr->Debounce, DebounceExpired, InstancePtr);
+
+    InstancePtr->Settling = FALSE;
+    InstancePtr->EdgeTime = 0;
+    InstancePtr->Interrupts = 0;
+    InstancePtr->Rechecks = 0;
+    InstancePtr->Presses = 0;
+    InstancePtr->Releases = 0;
+    InstancePtr->HandlerCycles = 0;
+    InstancePtr->HandlerRuns = 0;
+    InstancePtr->StartTime = 0;
+    InstancePtr->StopTime = 0;
+
+    XGpio_SetDataDirection(&InstancePtr->Gpio, BUTTON_CHANNEL, BUTTON_MASK);
+    XGpio_InterruptDisable(&InstancePtr->Gpio, XGPIO_IR_MASK);
+
+    /* What a polled button would pay on every sample */
+    Start = Cycles_Read();
+    for (i = 0; i < BUTTON_POLL_SAMPLES; i++) {
+        (void)ReadLevel(InstancePtr);
+    }
+    InstancePtr->PollCycles = (u32)((Cycles_Read() - Start) /
+                                    BUTTON_POLL_SAMPLES);
+
+    InstancePtr->Stable = ReadLevel(InstancePtr);
+    return XST_SUCCESS;
+}
+
+/* ------------------------------------------------------------
+ * Start taking interrupts. Edges seen before are dropped, the
+ * current level is the starting state.
+ * ------------------------------------------------------------ */
+void Button_Start(Button *InstancePtr)
+{
+    InstancePtr->Stable = ReadLevel(InstancePtr);
+    XGpio_InterruptClear(&InstancePtr->Gpio, XGPIO_IR_CH1_MASK);
+    XGpio_InterruptEnable(&InstancePtr->Gpio, XGPIO_IR_CH1_MASK);
+    XGpio_InterruptGlobalEnable(&InstancePtr->Gpio);
+    XTime_GetTime(&InstancePtr->StartTime);
+}
+
+void Button_Stop(Button *InstancePtr)
+{
+    XGpio_InterruptGlobalDisable(&InstancePtr->Gpio);
+    XGpio_InterruptDisable(&InstancePtr->Gpio, XGPIO_IR_MASK);
+    TWheel_Stop(InstancePtr->WheelPtr, &InstancePtr->Debounce);
+    InstancePtr->Settling = FALSE;
+    XTime_GetTime(&InstancePtr->StopTime);
+}
+
+/* ------------------------------------------------------------
+ * Interrupt handler to pass to XSetupInterruptSystem(). Only the
+ * first edge of a burst gets here: it masks the channel until the
+ * debounce timer has read the settled level.
+ * ------------------------------------------------------------ */
+void Button_InterruptHandler(void *InstancePtr)
+{
+    Button *ButtonPtr = (Button *)InstancePtr;
+    u64 Start = Cycles_Read();
+
+    if ((XGpio_InterruptGetStatus(&ButtonPtr->Gpio) &
+         XGPIO_IR_CH1_MASK) == 0) {
+        return;
+    }
+
+    XGpio_InterruptDisable(&ButtonPtr->Gpio, XGPIO_IR_CH1_MASK);
+    XGpio_InterruptClear(&ButtonPtr->Gpio, XGPIO_IR_CH1_MASK);
+    ButtonPtr->Interrupts++;
+
+    if (!ButtonPtr->Settling) {
+        ButtonPtr->Settling = TRUE;
+        XTime_GetTime(&ButtonPtr->EdgeTime);
+        TWheel_ScheduleFromIsr(ButtonPtr->WheelPtr, &ButtonPtr->Debounce,
+                               ButtonPtr->DebounceTicks, 0);
+    }
+
+    ButtonPtr->HandlerCycles += Cycles_Read() - Start;
+    ButtonPtr->HandlerRuns++;
+}
+
+/* ------------------------------------------------------------
+ * CPU time of the interrupt-driven button against polling. Handler
+ * time only: exception entry and GIC dispatch are not counted, nor
+ * is the loop around a poll.
+ * ------------------------------------------------------------ */
+void Button_Report(const Button *InstancePtr)
+{
+    u64 ElapsedUs = ((InstancePtr->StopTime - InstancePtr->StartTime) *
+                     1000000U) / COUNTS_PER_SECOND;
+    u64 IrqUs = CyclesToUs(InstancePtr->HandlerCycles);
+    u64 PollUs = CyclesToUs((u64)InstancePtr->PollCycles * BUTTON_POLL_HZ *
+                            ElapsedUs / 1000000U);
+
+    xil_printf("\r\n--- Push button (%d ms debounce, %d ms) ---\r\n",
+               (int)BUTTON_DEBOUNCE_MS, (int)(ElapsedUs / 1000U));
+    xil_printf("  presses %d, releases %d, %d GPIO interrupts, "
+               "%d rechecks\r\n",
+               (int)InstancePtr->Presses, (int)InstancePtr->Releases,
+               (int)InstancePtr->Interrupts, (int)InstancePtr->Rechecks);
+    if (InstancePtr->HandlerRuns != 0) {
+        xil_printf("  interrupts  %d handler runs, %d cycles avg, "
+                   "%d us CPU\r\n",
+                   (int)InstancePtr->HandlerRuns,
+                   (int)(InstancePtr->HandlerCycles /
+                         InstancePtr->HandlerRuns),
+                   (int)IrqUs);
+    }
+    xil_printf("  %d Hz poll  %d cycles per read, %d us CPU\r\n",
+               (int)BUTTON_POLL_HZ, (int)InstancePtr->PollCycles,
+               (int)PollUs);
+    xil_printf("  busy poll   %d us CPU\r\n", (int)ElapsedUs);
+    if (PollUs > IrqUs) {
+        xil_printf("Interrupts save %d us of CPU time over %d Hz polling "
+                   "(%d ppm of the run)\r\n",
+                   (int)(PollUs - IrqUs), (int)BUTTON_POLL_HZ,
+                   (int)(((PollUs - IrqUs) * 1000000U) /
+                         (ElapsedUs != 0 ? ElapsedUs : 1U)));
+    }
+}
@@ -0,0 +1,77 @@
+/******************************************************************************
+ * Interrupt-driven push button with timer wheel debounce
+ *
+ * axi_gpio_0 raises ip2intc_irpt (pl_ps_irq1) on any change of the
+ * button input. The first edge of a burst masks the channel in IPIER,
+ * timestamps the edge and arms a one-shot wheel timer; the bounces
+ * that follow only latch IPISR. When the timer fires the input has
+ * settled: the level is read once, a change is reported to the
+ * handler, and IPISR is cleared before IPIER is opened again. A level
+ * that moved between that read and the re-enable raised no interrupt,
+ * so it is read a second time and debounced again if it differs.
+ *
+ * Every handler run is timed with the cycle counter, against the cost
+ * of one poll of the DATA register, for a CPU time comparison with a
+ * polled button.
+ ******************************************************************************/
+
+#ifndef BUTTON_H_
+#define BUTTON_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+#include "xgpio.h"
+#include "twheel.h"
+
+#define BUTTON_CHANNEL      1U
+#define BUTTON_MASK         0x1U
+
+/* Contacts settle within a few milliseconds */
+#ifndef BUTTON_DEBOUNCE_MS
+#define BUTTON_DEBOUNCE_MS  10U
+#endif
+
+/* Poll rate a polled button would need for the same response */
+#define BUTTON_POLL_HZ      1000U
+
+typedef void (*Button_Handler)(void *CallBackRef, u32 Pressed, u64 EdgeTime);
+
+typedef struct {
+    XGpio Gpio;
+    TWheel *WheelPtr;
+    TWheelTimer Debounce;
+    u32 DebounceTicks;
+    Button_Handler Handler;
+    void *CallBackRef;
+
+    u32 Stable;             /* Debounced level */
+    u8 Settling;            /* Debounce timer running, IPIER masked */
+    u64 EdgeTime;           /* XTime of the first edge of the burst */
+
+    /* Statistics */
+    u32 Interrupts;         /* GPIO interrupts taken */
+    u32 Rechecks;           /* Level moved while the channel was reopened */
+    u32 Presses;
+    u32 Releases;
+    u64 HandlerCycles;      /* GPIO ISR and debounce callbacks */
+    u32 HandlerRuns;
+    u32 PollCycles;         /* One DATA register poll */
+    u64 StartTime;
+    u64 StopTime;
+} Button;
+
+int Button_Initialize(Button *InstancePtr, UINTPTR BaseAddress,
+                      TWheel *WheelPtr, Button_Handler Handler,
+                      void *CallBackRef);
+void Button_Start(Button *InstancePtr);
+void Button_Stop(Button *InstancePtr);
+void Button_InterruptHandler(void *InstancePtr);
+void Button_Report(const Button *InstancePtr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,79 @@
+/******************************************************************************
+ * Hardware event timestamps from the AXI timer capture input - see capture.h
+ ******************************************************************************/
+
+#include "capture.h"
+#include "xtmrctr.h"
+#include "xstatus.h"
+
+/* Up count, external capture enabled, hold the first capture and
+ * interrupt on it */
+#define CAPTURE_CSR     (XTC_CSR_CAPTURE_MODE_ENABLE_MASK | \
+                         XTC_CSR_EXT_CAPTURE_MASK | \
+                         XTC_CSR_ENABLE_INT_MASK)
+
+void Capture_Initialize(Capture *InstancePtr, UINTPTR BaseAddress,
+                        u8 TmrCtrNumber)
+{
+    InstancePtr->BaseAddress = BaseAddress;
+    InstancePtr->TmrCtrNumber = TmrCtrNumber;
+    InstancePtr->Captures = 0;
+}
+
+/* ------------------------------------------------------------
+ * Start the counter from zero. A capture left over from an earlier
+ * run is dropped.
+ * ------------------------------------------------------------ */
+void Capture_Start(Capture *InstancePtr)
+{
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, InstancePtr->TmrCtrNumber,
+                     XTC_TCSR_OFFSET, 0);
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, InstancePtr->TmrCtrNumber,
+                     XTC_TLR_OFFSET, 0);
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, InstancePtr->TmrCtrNumber,
+                     XTC_TCSR_OFFSET,
+                     CAPTURE_CSR | XTC_CSR_LOAD_MASK |
+                     XTC_CSR_INT_OCCURED_MASK);
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, InstancePtr->TmrCtrNumber,
+                     XTC_TCSR_OFFSET,
+                     CAPTURE_CSR | XTC_CSR_ENABLE_TMR_MASK);
+}
+
+void Capture_Stop(Capture *InstancePtr)
+{
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, InstancePtr->TmrCtrNumber,
+                     XTC_TCSR_OFFSET, 0);
+}
+
+/* ------------------------------------------------------------
+ * Timestamp of the last event, in counter cycles, and re-arm the
+ * capture. XST_NO_DATA if no edge has been captured since the last
+ * read.
+ * ------------------------------------------------------------ */
+int Capture_Read(Capture *InstancePtr, u32 *StampPtr)
+{
+    u32 Csr = XTmrCtr_ReadReg(InstancePtr->BaseAddress,
+                              InstancePtr->TmrCtrNumber, XTC_TCSR_OFFSET);
+
+    if ((Csr & XTC_CSR_INT_OCCURED_MASK) == 0) {
+        return XST_NO_DATA;
+    }
+    *StampPtr = XTmrCtr_ReadReg(InstancePtr->BaseAddress,
+                                InstancePtr->TmrCtrNumber, XTC_TLR_OFFSET);
+
+    /* TINT is write-one-to-clear, the next edge is captured from here */
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, InstancePtr->TmrCtrNumber,
+                     XTC_TCSR_OFFSET, Csr);
+    InstancePtr->Captures++;
+    return XST_SUCCESS;
+}
+
+/* ------------------------------------------------------------
+ * Counter value now, in the same time base as the captures - what a
+ * software timestamp taken at this point reads
+ * ------------------------------------------------------------ */
+u32 Capture_Now(const Capture *InstancePtr)
+{
+    return XTmrCtr_ReadReg(InstancePtr->BaseAddress,
+                           InstancePtr->TmrCtrNumber, XTC_TCR_OFFSET);
+}
@@ -0,0 +1,52 @@
+/******************************************************************************
+ * Hardware event timestamps from the AXI timer capture input
+ *
+ * A counter in capture mode (MDT) counts up freely and, on the active
+ * edge of its capturetrig input, copies TCR into TLR and sets TINT in
+ * hardware (PG079). The timestamp is the cycle of the edge itself, as
+ * opposed to an ISR reading TCR, which stamps the edge plus whatever
+ * the interrupt latency was that time.
+ *
+ * ARHT is left clear: the first capture is held in TLR until software
+ * clears TINT, so a value is never overwritten while being read. Edges
+ * that arrive before then are lost; Capture_Read() must run once per
+ * event.
+ *
+ * ENIT is set, so each capture raises the timer interrupt. Call
+ * Capture_Read() from the timer ISR before XTmrCtr_InterruptHandler():
+ * the driver would otherwise take the capture for an expiry of that
+ * counter and acknowledge it.
+ *
+ * In this design capturetrig0 comes from the capture_in pin
+ * (constrs_1/new/capture.xdc), so counter 0 timestamps edges from
+ * outside the PL clock domain and counter 1 is left to generate.
+ * capturetrig passes a synchroniser on its way in, a fixed delay that
+ * cancels out of every interval.
+ ******************************************************************************/
+
+#ifndef CAPTURE_H_
+#define CAPTURE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+typedef struct {
+    UINTPTR BaseAddress;
+    u8 TmrCtrNumber;        /* Counter in capture mode */
+    u32 Captures;           /* Timestamps read */
+} Capture;
+
+void Capture_Initialize(Capture *InstancePtr, UINTPTR BaseAddress,
+                        u8 TmrCtrNumber);
+void Capture_Start(Capture *InstancePtr);
+void Capture_Stop(Capture *InstancePtr);
+int Capture_Read(Capture *InstancePtr, u32 *StampPtr);
+u32 Capture_Now(const Capture *InstancePtr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,114 @@
+/******************************************************************************
+ * 64-bit monotonic clock on the 32-bit AXI timer - see clock64.h
+ ******************************************************************************/
+
+#include "clock64.h"
+#include "xtmrctr.h"
+
+/* Value the counter reloads with, see clock64.h */
+#define CLOCK64_TLR         1U
+
+/* Clock used by now64(), the last one started */
+static Clock64 *SystemClock;
+
+void Clock64_Initialize(Clock64 *ClockPtr, UINTPTR BaseAddress, u32 ClockHz,
+                        Clock64_Handler Handler, void *CallBackRef)
+{
+    ClockPtr->BaseAddress = BaseAddress;
+    ClockPtr->ClockHz = ClockHz;
+    ClockPtr->Epoch = 0;
+    ClockPtr->Handler = Handler;
+    ClockPtr->CallBackRef = CallBackRef;
+}
+
+/* ------------------------------------------------------------
+ * Start the clock at StartValue cycles. Useful to place the first
+ * rollover close by; pass 0 for a clock counting from boot.
+ * ------------------------------------------------------------ */
+void Clock64_Start(Clock64 *ClockPtr, u64 StartValue)
+{
+    u32 Low = (u32)StartValue + CLOCK64_TLR;
+
+    if (Low < CLOCK64_TLR) {
+        /* Counter cannot hold MAX + 1, start right after the rollover */
+        Low = CLOCK64_TLR;
+        StartValue += 1U;
+    }
+
+    ClockPtr->Epoch = (u32)(StartValue >> 32);
+
+    /* Load the start value, then leave TLR at the reload value */
+    XTmrCtr_WriteReg(ClockPtr->BaseAddress, 0, XTC_TLR_OFFSET, Low);
+    XTmrCtr_WriteReg(ClockPtr->BaseAddress, 0, XTC_TCSR_OFFSET,
+                     XTC_CSR_INT_OCCURED_MASK | XTC_CSR_LOAD_MASK);
+    XTmrCtr_WriteReg(ClockPtr->BaseAddress, 0, XTC_TLR_OFFSET, CLOCK64_TLR);
+
+    SystemClock = ClockPtr;
+    XTmrCtr_WriteReg(ClockPtr->BaseAddress, 0, XTC_TCSR_OFFSET,
+                     XTC_CSR_ENABLE_TMR_MASK | XTC_CSR_ENABLE_INT_MASK |
+                     XTC_CSR_AUTO_RELOAD_MASK);
+}
+
+/* ------------------------------------------------------------
+ * Current time in timer cycles. Safe from thread and ISR context.
+ * ------------------------------------------------------------ */
+u64 Clock64_Now(Clock64 *ClockPtr)
+{
+    u32 Epoch;
+    u32 Csr1;
+    u32 Csr2;
+    u32 Tcr;
+
+    while (1) {
+        Epoch = __atomic_load_n(&ClockPtr->Epoch, __ATOMIC_ACQUIRE);
+
+        Csr1 = XTmrCtr_ReadReg(ClockPtr->BaseAddress, 0, XTC_TCSR_OFFSET);
+        Tcr = XTmrCtr_ReadReg(ClockPtr->BaseAddress, 0, XTC_TCR_OFFSET);
+        Csr2 = XTmrCtr_ReadReg(ClockPtr->BaseAddress, 0, XTC_TCSR_OFFSET);
+
+        /* Rolled over while sampling, TCR may be from either side */
+        if (((Csr1 ^ Csr2) & XTC_CSR_INT_OCCURED_MASK) != 0) {
+            continue;
+        }
+
+        /* The ISR ran in between, the epoch read is stale */
+        if (__atomic_load_n(&ClockPtr->Epoch, __ATOMIC_ACQUIRE) != Epoch) {
+            continue;
+        }
+        break;
+    }
+
+    /* Rollover already happened but is not serviced yet */
+    if ((Csr1 & XTC_CSR_INT_OCCURED_MASK) != 0) {
+        Epoch++;
+    }
+
+    return ((u64)Epoch << 32) + (Tcr - CLOCK64_TLR);
+}
+
+u64 now64(void)
+{
+    return (SystemClock != NULL) ? Clock64_Now(SystemClock) : 0U;
+}
+
+/* ------------------------------------------------------------
+ * Interrupt handler to pass to XSetupInterruptSystem(). The epoch is
+ * bumped before T0INT is cleared; readers never interleave with this
+ * (see clock64.h), so either order is consistent for them.
+ * ------------------------------------------------------------ */
+void Clock64_InterruptHandler(void *CallBackRef)
+{
+    Clock64 *ClockPtr = (Clock64 *)CallBackRef;
+    u32 Csr = XTmrCtr_ReadReg(ClockPtr->BaseAddress, 0, XTC_TCSR_OFFSET);
+
+    if ((Csr & XTC_CSR_INT_OCCURED_MASK) == 0) {
+        return;
+    }
+
+    __atomic_store_n(&ClockPtr->Epoch, ClockPtr->Epoch + 1U, __ATOMIC_RELEASE);
+    XTmrCtr_WriteReg(ClockPtr->BaseAddress, 0, XTC_TCSR_OFFSET, Csr);
+
+    if (ClockPtr->Handler != NULL) {
+        ClockPtr->Handler(ClockPtr->CallBackRef, ClockPtr->Epoch);
+    }
+}
@@ -0,0 +1,50 @@
+/******************************************************************************
+ * 64-bit monotonic clock on the 32-bit AXI timer
+ *
+ * The counter free-runs upwards with TLR = 1, which makes the up-count
+ * interval (MAX_COUNT - TLR + 2, PG079) exactly 2^32 cycles. Every
+ * rollover raises T0INT and the ISR bumps a 32-bit epoch, so
+ *
+ *     now = (Epoch << 32) + TCR - 1
+ *
+ * counts timer cycles (10 ns at 100 MHz) for ~5800 years.
+ *
+ * Readers cope with a rollover whose interrupt has not been serviced
+ * yet (T0INT still pending, e.g. IRQs masked or reading from another
+ * ISR) and with the ISR running between their register reads, so
+ * Clock64_Now() never returns a torn value. Readers must not preempt
+ * Clock64_InterruptHandler itself, which holds with the default
+ * non-nested interrupt dispatch.
+ ******************************************************************************/
+
+#ifndef CLOCK64_H_
+#define CLOCK64_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+typedef void (*Clock64_Handler)(void *CallBackRef, u32 Epoch);
+
+typedef struct {
+    UINTPTR BaseAddress;
+    u32 ClockHz;
+    u32 Epoch;              /* Rollovers serviced */
+    Clock64_Handler Handler;
+    void *CallBackRef;
+} Clock64;
+
+void Clock64_Initialize(Clock64 *ClockPtr, UINTPTR BaseAddress, u32 ClockHz,
+                        Clock64_Handler Handler, void *CallBackRef);
+void Clock64_Start(Clock64 *ClockPtr, u64 StartValue);
+u64 Clock64_Now(Clock64 *ClockPtr);
+void Clock64_InterruptHandler(void *CallBackRef);
+
+u64 now64(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,77 @@
+/******************************************************************************
+ * Cortex-A53 PMU cycle counter
+ *
+ * PMCCNTR_EL0 counts CPU clock cycles (XPAR_CPU_CORE_CLOCK_FREQ_HZ).
+ * Used to time short code paths such as interrupt handlers, where the
+ * 100 MHz global timer is too coarse. Other targets, and the host
+ * simulation, fall back to the global timer. A host build with
+ * CYCLES_HOST_CLOCK counts host nanoseconds instead, to time the
+ * generated code rather than the simulated register accesses.
+ ******************************************************************************/
+
+#ifndef CYCLES_H_
+#define CYCLES_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+#include "xparameters.h"
+
+#if defined(__aarch64__) && !defined(HOST_SIM)
+#define CYCLES_USE_PMU      1
+#define CYCLES_PER_SECOND   XPAR_CPU_CORE_CLOCK_FREQ_HZ
+#elif defined(HOST_SIM) && defined(CYCLES_HOST_CLOCK)
+#include <time.h>
+#define CYCLES_USE_HOST     1
+#define CYCLES_PER_SECOND   1000000000U
+#else
+#include "xtime_l.h"
+#define CYCLES_PER_SECOND   COUNTS_PER_SECOND
+#endif
+
+/* ------------------------------------------------------------
+ * Enable and reset the cycle counter (PMCR_EL0.E/.C, PMCNTENSET_EL0.C)
+ * ------------------------------------------------------------ */
+static inline void Cycles_Enable(void)
+{
+#ifdef CYCLES_USE_PMU
+    u64 Pmcr;
+
+    __asm__ __volatile__("mrs %0, pmcr_el0" : "=r" (Pmcr));
+    Pmcr |= (1U << 0) | (1U << 2);
+    __asm__ __volatile__("msr pmcr_el0, %0" : : "r" (Pmcr));
+    __asm__ __volatile__("msr pmcntenset_el0, %0" : : "r" ((u64)1U << 31));
+    __asm__ __volatile__("isb" : : : "memory");
+#endif
+}
+
+/* ------------------------------------------------------------
+ * Read the cycle counter. The isb keeps the read from being
+ * hoisted above the code being measured.
+ * ------------------------------------------------------------ */
+static inline u64 Cycles_Read(void)
+{
+#ifdef CYCLES_USE_PMU
+    u64 Count;
+
+    __asm__ __volatile__("isb\n\tmrs %0, pmccntr_el0" : "=r" (Count) : : "memory");
+    return Count;
+#elif defined(CYCLES_USE_HOST)
+    struct timespec Ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return ((u64)Ts.tv_sec * 1000000000U) + (u64)Ts.tv_nsec;
+#else
+    XTime Now;
+
+    XTime_GetTime(&Now);
+    return Now;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif
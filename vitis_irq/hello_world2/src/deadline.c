@@ -0,0 +1,207 @@
+/******************************************************************************
+ * Drift-free periodic timer on absolute deadlines - see deadline.h
+ ******************************************************************************/
+
+#include "deadline.h"
+#include "xtmrctr.h"
+#include "xtime_l.h"
+#include "xil_printf.h"
+
+/* Down count interval is TLR + 2 cycles */
+#define DL_TLR(Period)      ((Period) - 2U)
+
+/* Timer cycles to global timer counts, without 64-bit overflow on
+ * long runs
+ */
+static u64 CyclesToCounts(u64 Cycles, u32 ClockHz)
+{
+    return (Cycles / ClockHz) * COUNTS_PER_SECOND +
+           ((Cycles % ClockHz) * COUNTS_PER_SECOND) / ClockHz;
+}
+
+static u64 CountsToCycles(u64 Counts, u32 ClockHz)
+{
+    return (Counts / COUNTS_PER_SECOND) * ClockHz +
+           ((Counts % COUNTS_PER_SECOND) * ClockHz) / COUNTS_PER_SECOND;
+}
+
+void DlTimer_Initialize(DlTimer *InstancePtr, UINTPTR BaseAddress,
+                        u32 ClockHz, DlTimer_Handler Handler,
+                        void *CallBackRef)
+{
+    InstancePtr->BaseAddress = BaseAddress;
+    InstancePtr->ClockHz = ClockHz;
+    InstancePtr->Handler = Handler;
+    InstancePtr->CallBackRef = CallBackRef;
+    InstancePtr->Deadline = 0;
+    InstancePtr->Period = 0;
+    InstancePtr->NextPeriod = 0;
+    InstancePtr->PendingPeriod = 0;
+    InstancePtr->Expiries = 0;
+    InstancePtr->Missed = 0;
+    InstancePtr->LastExpiry = 0;
+    InstancePtr->StartTime = 0;
+    InstancePtr->FirstError = 0;
+    InstancePtr->LastError = 0;
+    InstancePtr->MinJitter = 0;
+    InstancePtr->MaxJitter = 0;
+}
+
+/* ------------------------------------------------------------
+ * Start counting; the first deadline is Period cycles from now
+ * ------------------------------------------------------------ */
+void DlTimer_Start(DlTimer *InstancePtr, u32 Period)
+{
+    XTime Now;
+
+    InstancePtr->Deadline = 0;
+    InstancePtr->Period = Period;
+    InstancePtr->NextPeriod = Period;
+    InstancePtr->PendingPeriod = Period;
+    InstancePtr->Expiries = 0;
+    InstancePtr->Missed = 0;
+
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, 0, XTC_TLR_OFFSET,
+                     DL_TLR(Period));
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, 0, XTC_TCSR_OFFSET,
+                     XTC_CSR_INT_OCCURED_MASK | XTC_CSR_LOAD_MASK);
+
+    XTime_GetTime(&Now);
+    InstancePtr->StartTime = Now;
+    InstancePtr->LastExpiry = Now;
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, 0, XTC_TCSR_OFFSET,
+                     XTC_CSR_ENABLE_TMR_MASK | XTC_CSR_ENABLE_INT_MASK |
+                     XTC_CSR_AUTO_RELOAD_MASK | XTC_CSR_DOWN_COUNT_MASK);
+}
+
+/* ------------------------------------------------------------
+ * Request a new period. It is written to TLR at the next expiry and
+ * so applies from the deadline after that one, or one later if that
+ * expiry is serviced within the guard of its reload; deadlines
+ * already scheduled do not move.
+ * ------------------------------------------------------------ */
+void DlTimer_SetPeriod(DlTimer *InstancePtr, u32 Period)
+{
+    __atomic_store_n(&InstancePtr->PendingPeriod, Period, __ATOMIC_RELAXED);
+}
+
+void DlTimer_Stop(DlTimer *InstancePtr)
+{
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, 0, XTC_TCSR_OFFSET, 0);
+}
+
+/* ------------------------------------------------------------
+ * Interrupt handler to pass to XSetupInterruptSystem()
+ * ------------------------------------------------------------ */
+void DlTimer_InterruptHandler(void *InstancePtr)
+{
+    DlTimer *TmrPtr = (DlTimer *)InstancePtr;
+    u32 Csr = XTmrCtr_ReadReg(TmrPtr->BaseAddress, 0, XTC_TCSR_OFFSET);
+    u32 Tcr;
+    u32 Expired = 0;
+    XTime Now;
+    u64 Since;
+    s64 Whole;
+    u64 Into;
+    u64 Ideal;
+    s64 Error;
+
+    if ((Csr & XTC_CSR_INT_OCCURED_MASK) == 0) {
+        return;
+    }
+    XTmrCtr_WriteReg(TmrPtr->BaseAddress, 0, XTC_TCSR_OFFSET, Csr);
+
+    /* Sampled after the ack: an expiry from here on raises T0INT again */
+    Tcr = XTmrCtr_ReadReg(TmrPtr->BaseAddress, 0, XTC_TCR_OFFSET);
+    XTime_GetTime(&Now);
+
+    /* The first expiry since the last one counted ends Period and every
+     * later one reloads NextPeriod, so Since + TCR + 1 - Period comes to
+     * one NextPeriod per expiry. None at all: the T0INT of an expiry
+     * the last run already counted.
+     */
+    Since = CountsToCycles(Now - TmrPtr->LastExpiry, TmrPtr->ClockHz);
+    Whole = (s64)(Since + Tcr + 1U) - (s64)TmrPtr->Period +
+            (s64)(TmrPtr->NextPeriod / 2U);
+    if (Whole > 0) {
+        Expired = (u32)((u64)Whole / TmrPtr->NextPeriod);
+    }
+    if (Expired == 0) {
+        return;
+    }
+    Into = (Tcr < DL_TLR(TmrPtr->NextPeriod)) ?
+           ((u64)DL_TLR(TmrPtr->NextPeriod) - Tcr + 1U) : 0U;
+
+    TmrPtr->Deadline += TmrPtr->Period +
+                        (u64)(Expired - 1U) * TmrPtr->NextPeriod;
+    TmrPtr->Period = TmrPtr->NextPeriod;
+    TmrPtr->Expiries += Expired;
+    TmrPtr->Missed += Expired - 1U;
+    TmrPtr->LastExpiry = Now - CyclesToCounts(Into, TmrPtr->ClockHz);
+
+    /* Queue the interval after this one, unless the reload is too
+     * close for the write to land before it
+     */
+    if (Tcr >= DL_GUARD_CYCLES) {
+        TmrPtr->NextPeriod = __atomic_load_n(&TmrPtr->PendingPeriod,
+                                             __ATOMIC_RELAXED);
+        XTmrCtr_WriteReg(TmrPtr->BaseAddress, 0, XTC_TLR_OFFSET,
+                         DL_TLR(TmrPtr->NextPeriod));
+    }
+
+    /* Where the PS clock says we are, against where we should be */
+    Ideal = TmrPtr->StartTime +
+            CyclesToCounts(TmrPtr->Deadline, TmrPtr->ClockHz);
+    Error = (s64)(Now - Ideal);
+    if (TmrPtr->Expiries == Expired) {
+        TmrPtr->FirstError = Error;
+    }
+    TmrPtr->LastError = Error;
+    if ((Error - TmrPtr->FirstError) < TmrPtr->MinJitter) {
+        TmrPtr->MinJitter = Error - TmrPtr->FirstError;
+    }
+    if ((Error - TmrPtr->FirstError) > TmrPtr->MaxJitter) {
+        TmrPtr->MaxJitter = Error - TmrPtr->FirstError;
+    }
+
+    if (TmrPtr->Handler != NULL) {
+        TmrPtr->Handler(TmrPtr->CallBackRef, TmrPtr->Deadline);
+    }
+}
+
+/* ------------------------------------------------------------
+ * Drift: change in deadline error between first and last expiry.
+ * A steady slope is the ppm offset between the PL timer clock and
+ * the PS global timer; software slip would show as extra drift
+ * proportional to the number of periods.
+ * ------------------------------------------------------------ */
+static int CountsToNs(s64 Counts)
+{
+    return (int)((Counts * 1000000000LL) / (s64)COUNTS_PER_SECOND);
+}
+
+void DlTimer_Report(const DlTimer *InstancePtr)
+{
+    s64 Drift = InstancePtr->LastError - InstancePtr->FirstError;
+    u64 ElapsedCounts = CyclesToCounts(InstancePtr->Deadline,
+                                       InstancePtr->ClockHz);
+
+    xil_printf("\r\n--- Deadline timer (%d expiries, %d ms) ---\r\n",
+               (int)InstancePtr->Expiries,
+               (int)(InstancePtr->Deadline / (InstancePtr->ClockHz / 1000U)));
+    if (InstancePtr->Expiries < 2) {
+        return;
+    }
+    xil_printf("  drift   %8d ns", CountsToNs(Drift));
+    if (ElapsedCounts != 0) {
+        xil_printf("  (%d ppb vs PS clock)",
+                   (int)((Drift * 1000000000LL) / (s64)ElapsedCounts));
+    }
+    xil_printf("\r\n");
+    xil_printf("  jitter  %8d .. %d ns\r\n", CountsToNs(InstancePtr->MinJitter),
+               CountsToNs(InstancePtr->MaxJitter));
+    if (InstancePtr->Missed != 0) {
+        xil_printf("  missed  %8d periods, ISR a period or more late\r\n",
+                   (int)InstancePtr->Missed);
+    }
+}
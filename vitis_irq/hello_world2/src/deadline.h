@@ -0,0 +1,83 @@
+/******************************************************************************
+ * Drift-free periodic timer on absolute deadlines
+ *
+ * In down-count mode the AXI timer period is TLR + 2 clock cycles
+ * (PG079), and reloading the counter from software (LOAD) restarts the
+ * interval from whenever the write lands, so ISR latency leaks into the
+ * phase on every period change.
+ *
+ * DlTimer keeps the deadlines in a 64-bit cycle domain and never
+ * reloads a running counter. Auto-reload restarts each interval in
+ * hardware at the exact expiry; the ISR only writes TLR for the
+ * interval *after* the one that just started, so a period change
+ * takes effect one period later without moving the phase.
+ *
+ * An ISR that runs more than a period late finds several expiries
+ * behind one T0INT. It counts them from the PS global timer since the
+ * last expiry it accounted for, with TCR giving the exact phase. Every
+ * reload after the first took the TLR it had queued, so the deadline
+ * moves on by the real number of intervals and the misses are counted.
+ * The count is exact while the PS timer and the timer clock agree to
+ * better than half a period over the time the ISR was held up.
+ *
+ * TLR is never written within DL_GUARD_CYCLES of a reload, where the
+ * write could land after it. The ISR leaves TLR alone then, and the
+ * T0INT of that reload runs it again to queue the next interval.
+ * Periods must be longer than twice the guard.
+ *
+ * Each expiry is also timestamped with the PS global timer, and the
+ * deviation from the ideal deadline is tracked for a drift/jitter
+ * report.
+ ******************************************************************************/
+
+#ifndef DEADLINE_H_
+#define DEADLINE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+/* Longest time from the TCR read in the ISR to its TLR write landing */
+#ifndef DL_GUARD_CYCLES
+#define DL_GUARD_CYCLES     1000U
+#endif
+
+typedef void (*DlTimer_Handler)(void *CallBackRef, u64 Deadline);
+
+typedef struct {
+    UINTPTR BaseAddress;
+    u32 ClockHz;            /* AXI timer clock */
+    DlTimer_Handler Handler;
+    void *CallBackRef;
+
+    u64 Deadline;           /* Cycles from start to the last expiry */
+    u32 Period;             /* Interval running now */
+    u32 NextPeriod;         /* Interval already in TLR */
+    u32 PendingPeriod;      /* Requested by DlTimer_SetPeriod() */
+    u32 Expiries;
+    u32 Missed;             /* Expiries the ISR was a period or more late for */
+    u64 LastExpiry;         /* Global timer count of the last expiry counted */
+
+    /* Drift against the PS global timer, in global timer counts */
+    u64 StartTime;
+    s64 FirstError;
+    s64 LastError;
+    s64 MinJitter;          /* Error relative to FirstError */
+    s64 MaxJitter;
+} DlTimer;
+
+void DlTimer_Initialize(DlTimer *InstancePtr, UINTPTR BaseAddress,
+                        u32 ClockHz, DlTimer_Handler Handler,
+                        void *CallBackRef);
+void DlTimer_Start(DlTimer *InstancePtr, u32 Period);
+void DlTimer_SetPeriod(DlTimer *InstancePtr, u32 Period);
+void DlTimer_Stop(DlTimer *InstancePtr);
+void DlTimer_InterruptHandler(void *InstancePtr);
+void DlTimer_Report(const DlTimer *InstancePtr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
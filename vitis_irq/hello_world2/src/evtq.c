@@ -0,0 +1,119 @@
+/******************************************************************************
+ * Lock-free event queue from interrupt handlers to the main loop
+ * - see evtq.h
+ ******************************************************************************/
+
+#include "evtq.h"
+#include "xstatus.h"
+#include "fast_mem.h"
+
+#define EVTQ_MASK       (EVTQ_DEPTH - 1U)
+
+/* ------------------------------------------------------------
+ * Initialize an empty queue, before any producer uses it
+ * ------------------------------------------------------------ */
+void EvtQ_Init(EvtQ *QueuePtr)
+{
+    u32 i;
+
+    for (i = 0; i < EVTQ_DEPTH; i++) {
+        QueuePtr->Slot[i].Seq = i;
+    }
+    QueuePtr->Head = 0;
+    QueuePtr->Tail = 0;
+    QueuePtr->Overflows = 0;
+    QueuePtr->HighWater = 0;
+}
+
+/* ------------------------------------------------------------
+ * Producer side, any context on any core.
+ * Returns XST_SUCCESS, or XST_FAILURE when the queue is full
+ * (the event is dropped and counted, the caller never spins).
+ * ------------------------------------------------------------ */
+FAST_TEXT int EvtQ_Post(EvtQ *QueuePtr, u16 Type, u16 Source, u32 Data)
+{
+    u32 Head = __atomic_load_n(&QueuePtr->Head, __ATOMIC_RELAXED);
+    EvtQSlot *SlotPtr;
+    s32 Diff;
+
+    while (1) {
+        SlotPtr = &QueuePtr->Slot[Head & EVTQ_MASK];
+        Diff = (s32)(__atomic_load_n(&SlotPtr->Seq, __ATOMIC_ACQUIRE) - Head);
+
+        if (Diff == 0) {
+            /* Slot is free: claim it, or retry from the new Head */
+            if (__atomic_compare_exchange_n(&QueuePtr->Head, &Head,
+                                            Head + 1U, 1, __ATOMIC_RELAXED,
+                                            __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (Diff < 0) {
+            /* Still holds the event from one lap ago */
+            __atomic_fetch_add(&QueuePtr->Overflows, 1U, __ATOMIC_RELAXED);
+            return XST_FAILURE;
+        } else {
+            /* Another producer claimed it first */
+            Head = __atomic_load_n(&QueuePtr->Head, __ATOMIC_RELAXED);
+        }
+    }
+
+    SlotPtr->Event.Type = Type;
+    SlotPtr->Event.Source = Source;
+    SlotPtr->Event.Data = Data;
+
+    /* Publish the slot only once it is completely written */
+    __atomic_store_n(&SlotPtr->Seq, Head + 1U, __ATOMIC_RELEASE);
+    return XST_SUCCESS;
+}
+
+/* ------------------------------------------------------------
+ * Consumer side, one context only (the main loop).
+ * Copies up to MaxEvents published events to BatchPtr and returns
+ * how many. Stops early at a slot that is claimed but not yet
+ * published.
+ * ------------------------------------------------------------ */
+u32 EvtQ_Drain(EvtQ *QueuePtr, EvtQEvent *BatchPtr, u32 MaxEvents)
+{
+    u32 Tail = QueuePtr->Tail;
+    u32 Queued = __atomic_load_n(&QueuePtr->Head, __ATOMIC_RELAXED) - Tail;
+    EvtQSlot *SlotPtr;
+    u32 Count = 0;
+
+    if (Queued > QueuePtr->HighWater) {
+        QueuePtr->HighWater = Queued;
+    }
+
+    while (Count < MaxEvents) {
+        SlotPtr = &QueuePtr->Slot[Tail & EVTQ_MASK];
+        if (__atomic_load_n(&SlotPtr->Seq, __ATOMIC_ACQUIRE) != Tail + 1U) {
+            break;
+        }
+        BatchPtr[Count++] = SlotPtr->Event;
+
+        /* Hand the slot to the producer one lap ahead */
+        __atomic_store_n(&SlotPtr->Seq, Tail + EVTQ_DEPTH, __ATOMIC_RELEASE);
+        Tail++;
+    }
+
+    QueuePtr->Tail = Tail;
+    return Count;
+}
+
+/* ------------------------------------------------------------
+ * Nothing published at Tail, consumer side only
+ * ------------------------------------------------------------ */
+int EvtQ_IsEmpty(EvtQ *QueuePtr)
+{
+    u32 Tail = QueuePtr->Tail;
+
+    return __atomic_load_n(&QueuePtr->Slot[Tail & EVTQ_MASK].Seq,
+                           __ATOMIC_ACQUIRE) != Tail + 1U;
+}
+
+/* ------------------------------------------------------------
+ * Posts refused since the last call
+ * ------------------------------------------------------------ */
+u32 EvtQ_TakeOverflows(EvtQ *QueuePtr)
+{
+    return __atomic_exchange_n(&QueuePtr->Overflows, 0, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Lock-free event queue from interrupt handlers to the main loop
+ *
+ * Bounded multi-producer / single-consumer ring of typed events. Any
+ * handler, on any core, posts with EvtQ_Post(); the main loop takes
+ * them in batches with EvtQ_Drain(). Nothing blocks and nothing masks
+ * interrupts.
+ *
+ * Every slot carries a sequence number. A producer claims the slot at
+ * Head with a compare-and-swap once its sequence says the consumer
+ * has freed it, fills it in, and publishes it with a store-release of
+ * the sequence. The consumer load-acquires a slot's sequence before it
+ * reads the slot, and hands the slot back with a store-release. On the
+ * A53 these are LDAR / STLR, and the claim is an LDAXR / STLXR loop.
+ *
+ * Events are taken in the order the slots were claimed. A producer
+ * that is interrupted between claiming and publishing holds up the
+ * consumer until it resumes: EvtQ_Drain() stops at that slot and
+ * returns what it has, it never waits.
+ *
+ * A post to a full queue is refused and counted in Overflows, so an
+ * event is either delivered or accounted for.
+ ******************************************************************************/
+
+#ifndef EVTQ_H_
+#define EVTQ_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+#define EVTQ_CACHE_LINE     64U
+
+/* Number of slots, must be a power of two */
+#ifndef EVTQ_DEPTH
+#define EVTQ_DEPTH          64U
+#endif
+
+#if (EVTQ_DEPTH & (EVTQ_DEPTH - 1U)) != 0
+#error "EVTQ_DEPTH must be a power of two"
+#endif
+
+typedef struct {
+    u16 Type;           /* Application defined */
+    u16 Source;         /* Poster, e.g. interrupt ID or core */
+    u32 Data;
+} EvtQEvent;
+
+typedef struct {
+    u32 Seq;            /* Slot index: free, + 1: published */
+    EvtQEvent Event;
+} EvtQSlot;
+
+typedef struct {
+    u32 Head __attribute__((aligned(EVTQ_CACHE_LINE)));  /* Producers */
+    u32 Overflows;      /* Posts refused because the queue was full */
+    u32 Tail __attribute__((aligned(EVTQ_CACHE_LINE)));  /* Consumer only */
+    u32 HighWater;      /* Most events seen queued by the consumer */
+    EvtQSlot Slot[EVTQ_DEPTH] __attribute__((aligned(EVTQ_CACHE_LINE)));
+} EvtQ;
+
+void EvtQ_Init(EvtQ *QueuePtr);
+int EvtQ_Post(EvtQ *QueuePtr, u16 Type, u16 Source, u32 Data);
+u32 EvtQ_Drain(EvtQ *QueuePtr, EvtQEvent *BatchPtr, u32 MaxEvents);
+int EvtQ_IsEmpty(EvtQ *QueuePtr);
+u32 EvtQ_TakeOverflows(EvtQ *QueuePtr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,109 @@
+/******************************************************************************
+ * Exception frame for vectors of our own that call C
+ *
+ * EXC_FRAME_SAVE / EXC_FRAME_RESTORE are assembly strings for the
+ * entry and exit of such a vector at EL3. They keep the full state of
+ * the interrupted code on the current stack:
+ *   - the caller-saved integer registers, x0-x18, x29 and x30;
+ *   - ELR_EL3 and SPSR_EL3, so the handler may unmask and nest;
+ *   - all of q0-q31 and FPCR/FPSR. A C function keeps only the low
+ *     64 bits of v8-v15, and the interrupted code may hold all 128.
+ *
+ * Unlike the BSP vectors (asm_vectors.S), which save FP lazily into one
+ * context for all cores, this is eager and per stack: the handler can
+ * use FP on any core, and the frame costs 720 bytes of stack. FP
+ * access must be enabled (CPTR_EL3.TFP clear) when the vector is
+ * taken, and the handler must return with IRQ masked again. Use as
+ *
+ *   EXC_FRAME_SAVE "   bl      Handler\n" EXC_FRAME_RESTORE "   eret\n"
+ ******************************************************************************/
+
+#ifndef EXC_FRAME_H_
+#define EXC_FRAME_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * 720 bytes: x29/x30 at 0, x0-x18 from 16, ELR/SPSR at 176, FPCR/FPSR
+ * at 192, q0-q31 from 208
+ */
+#define EXC_FRAME_SAVE \
+    "   sub     sp, sp, #720\n" \
+    "   stp     x29, x30, [sp]\n" \
+    "   stp     x0, x1, [sp, #16]\n" \
+    "   stp     x2, x3, [sp, #32]\n" \
+    "   stp     x4, x5, [sp, #48]\n" \
+    "   stp     x6, x7, [sp, #64]\n" \
+    "   stp     x8, x9, [sp, #80]\n" \
+    "   stp     x10, x11, [sp, #96]\n" \
+    "   stp     x12, x13, [sp, #112]\n" \
+    "   stp     x14, x15, [sp, #128]\n" \
+    "   stp     x16, x17, [sp, #144]\n" \
+    "   str     x18, [sp, #160]\n" \
+    "   mrs     x0, elr_el3\n" \
+    "   mrs     x1, spsr_el3\n" \
+    "   stp     x0, x1, [sp, #176]\n" \
+    "   mrs     x0, fpcr\n" \
+    "   mrs     x1, fpsr\n" \
+    "   stp     x0, x1, [sp, #192]\n" \
+    "   add     x0, sp, #208\n" \
+    "   stp     q0, q1, [x0], #32\n" \
+    "   stp     q2, q3, [x0], #32\n" \
+    "   stp     q4, q5, [x0], #32\n" \
+    "   stp     q6, q7, [x0], #32\n" \
+    "   stp     q8, q9, [x0], #32\n" \
+    "   stp     q10, q11, [x0], #32\n" \
+    "   stp     q12, q13, [x0], #32\n" \
+    "   stp     q14, q15, [x0], #32\n" \
+    "   stp     q16, q17, [x0], #32\n" \
+    "   stp     q18, q19, [x0], #32\n" \
+    "   stp     q20, q21, [x0], #32\n" \
+    "   stp     q22, q23, [x0], #32\n" \
+    "   stp     q24, q25, [x0], #32\n" \
+    "   stp     q26, q27, [x0], #32\n" \
+    "   stp     q28, q29, [x0], #32\n" \
+    "   stp     q30, q31, [x0]\n"
+
+#define EXC_FRAME_RESTORE \
+    "   add     x0, sp, #208\n" \
+    "   ldp     q0, q1, [x0], #32\n" \
+    "   ldp     q2, q3, [x0], #32\n" \
+    "   ldp     q4, q5, [x0], #32\n" \
+    "   ldp     q6, q7, [x0], #32\n" \
+    "   ldp     q8, q9, [x0], #32\n" \
+    "   ldp     q10, q11, [x0], #32\n" \
+    "   ldp     q12, q13, [x0], #32\n" \
+    "   ldp     q14, q15, [x0], #32\n" \
+    "   ldp     q16, q17, [x0], #32\n" \
+    "   ldp     q18, q19, [x0], #32\n" \
+    "   ldp     q20, q21, [x0], #32\n" \
+    "   ldp     q22, q23, [x0], #32\n" \
+    "   ldp     q24, q25, [x0], #32\n" \
+    "   ldp     q26, q27, [x0], #32\n" \
+    "   ldp     q28, q29, [x0], #32\n" \
+    "   ldp     q30, q31, [x0]\n" \
+    "   ldp     x0, x1, [sp, #192]\n" \
+    "   msr     fpcr, x0\n" \
+    "   msr     fpsr, x1\n" \
+    "   ldp     x0, x1, [sp, #176]\n" \
+    "   msr     elr_el3, x0\n" \
+    "   msr     spsr_el3, x1\n" \
+    "   ldr     x18, [sp, #160]\n" \
+    "   ldp     x16, x17, [sp, #144]\n" \
+    "   ldp     x14, x15, [sp, #128]\n" \
+    "   ldp     x12, x13, [sp, #112]\n" \
+    "   ldp     x10, x11, [sp, #96]\n" \
+    "   ldp     x8, x9, [sp, #80]\n" \
+    "   ldp     x6, x7, [sp, #64]\n" \
+    "   ldp     x4, x5, [sp, #48]\n" \
+    "   ldp     x2, x3, [sp, #32]\n" \
+    "   ldp     x0, x1, [sp, #16]\n" \
+    "   ldp     x29, x30, [sp]\n" \
+    "   add     sp, sp, #720\n"
+
+#ifdef __cplusplus
+}
+#endif
+#endif
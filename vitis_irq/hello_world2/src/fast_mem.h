@@ -0,0 +1,51 @@
+/******************************************************************************
+ * Hot code and data in on-chip memory
+ *
+ * FAST_TEXT / FAST_DATA put a function or variable into .fast_text /
+ * .fast_data. lscript_ocm.ld maps those into the 256 KB OCM at
+ * 0xFFFC0000, together with the vector table, the GIC/timer driver
+ * dispatch path from libxil and the exception stacks, so a cache miss
+ * on the interrupt path is an OCM access instead of a DDR one.
+ *
+ * The attributes only take effect with FAST_OCM defined, which goes
+ * together with selecting lscript_ocm.ld in UserConfig.cmake. Without
+ * it the default lscript.ld layout is unchanged.
+ *
+ * .fast_data is loaded with the image and is not cleared at startup:
+ * tagged variables rely on the loader for their initial value, zero
+ * included.
+ ******************************************************************************/
+
+#ifndef FAST_MEM_H_
+#define FAST_MEM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+#define FAST_OCM_BASE       0xFFFC0000U
+#define FAST_OCM_SIZE       0x00040000U
+
+#ifdef FAST_OCM
+#define FAST_TEXT           __attribute__((section(".fast_text")))
+#define FAST_DATA           __attribute__((section(".fast_data")))
+#else
+#define FAST_TEXT
+#define FAST_DATA
+#endif
+
+/* ------------------------------------------------------------
+ * Whether a function or object ended up in OCM
+ * ------------------------------------------------------------ */
+static inline int FastMem_InOcm(UINTPTR Addr)
+{
+    return (Addr >= FAST_OCM_BASE) &&
+           ((Addr - FAST_OCM_BASE) < FAST_OCM_SIZE);
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif
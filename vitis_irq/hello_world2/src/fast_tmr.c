@@ -0,0 +1,40 @@
+/******************************************************************************
+ * Direct-register fast-path timer ISR - see fast_tmr.h
+ ******************************************************************************/
+
+#include "fast_tmr.h"
+#include "xtmrctr.h"
+#include "fast_mem.h"
+
+/* ------------------------------------------------------------
+ * Bind the fast path to a timer instance. The timer itself is still
+ * configured through the XTmrCtr driver.
+ * ------------------------------------------------------------ */
+void FastTmr_Initialize(FastTmr *InstancePtr, UINTPTR BaseAddress,
+                        FastTmr_Handler Handler, void *CallBackRef)
+{
+    InstancePtr->BaseAddress = BaseAddress;
+    InstancePtr->Handler = Handler;
+    InstancePtr->CallBackRef = CallBackRef;
+    InstancePtr->Spurious = 0;
+}
+
+/* ------------------------------------------------------------
+ * Interrupt handler to pass to XSetupInterruptSystem() in place of
+ * XTmrCtr_InterruptHandler: one read, one write, then dispatch.
+ * ------------------------------------------------------------ */
+FAST_TEXT void FastTmr_InterruptHandler(void *InstancePtr)
+{
+    FastTmr *TmrPtr = (FastTmr *)InstancePtr;
+    u32 Csr = XTmrCtr_ReadReg(TmrPtr->BaseAddress, 0, XTC_TCSR_OFFSET);
+
+    if ((Csr & XTC_CSR_INT_OCCURED_MASK) == 0) {
+        TmrPtr->Spurious++;
+        return;
+    }
+
+    /* Ack before dispatch so a new expiry during the callback is kept */
+    XTmrCtr_WriteReg(TmrPtr->BaseAddress, 0, XTC_TCSR_OFFSET, Csr);
+
+    TmrPtr->Handler(TmrPtr->CallBackRef);
+}
@@ -0,0 +1,42 @@
+/******************************************************************************
+ * Direct-register fast-path timer ISR
+ *
+ * The stock chain GIC -> XTmrCtr_InterruptHandler -> callback ->
+ * XTmrCtr_IsExpired costs, per interrupt:
+ *   - TCSR0 read, TCSR1 read (driver loops over both counters)
+ *   - TCSR0 read in XTmrCtr_IsExpired
+ *   - TCSR0 re-read and write to clear T0INT
+ * i.e. 4 AXI-Lite reads + 1 write over the HPM0_LPD SmartConnect.
+ *
+ * FastTmr_InterruptHandler() does one TCSR0 read and one TCSR0 write
+ * (T0INT is write-1-to-clear, so writing back the value read acks it
+ * and leaves every other control bit untouched), then calls the user
+ * callback. Only counter 0 is serviced.
+ ******************************************************************************/
+
+#ifndef FAST_TMR_H_
+#define FAST_TMR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+typedef void (*FastTmr_Handler)(void *CallBackRef);
+
+typedef struct {
+    UINTPTR BaseAddress;
+    FastTmr_Handler Handler;
+    void *CallBackRef;
+    u32 Spurious;       /* Entries with T0INT clear */
+} FastTmr;
+
+void FastTmr_Initialize(FastTmr *InstancePtr, UINTPTR BaseAddress,
+                        FastTmr_Handler Handler, void *CallBackRef);
+void FastTmr_InterruptHandler(void *InstancePtr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
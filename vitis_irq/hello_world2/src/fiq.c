@@ -0,0 +1,215 @@
+/******************************************************************************
+ * One interrupt on the FIQ line (GIC Group 0) - see fiq.h
+ ******************************************************************************/
+
+#include "fiq.h"
+#include "irq_affinity.h"
+#include "xparameters.h"
+#include "xinterrupt_wrap.h"
+#include "xil_exception.h"
+#include "xil_io.h"
+#include "xpseudo_asm.h"
+#include "xstatus.h"
+#include "fast_mem.h"
+#include "exc_frame.h"
+
+/* GIC-400 distributor */
+#define GICD_BASE           XPAR_SCUGIC_0_DIST_BASEADDR
+#define GICD_CTLR           0x000U
+#define GICD_TYPER          0x004U
+#define GICD_IGROUPR        0x080U
+#define GICD_ISENABLER      0x100U
+#define GICD_ICENABLER      0x180U
+#define GICD_IPRIORITYR     0x400U
+#define GICD_ICFGR          0xC00U
+
+#define GICD_CTLR_ENABLE    0x3U        /* EnableGrp0 | EnableGrp1 */
+#define GICD_TYPER_LINES    0x1FU
+#define GICD_ICFGR_EDGE     0x2U
+
+/* GIC-400 CPU interface, banked per core */
+#define GICC_BASE           XPAR_SCUGIC_0_CPU_BASEADDR
+#define GICC_CTLR           0x000U
+#define GICC_IAR            0x00CU
+#define GICC_EOIR           0x010U
+
+#define GICC_CTLR_FIQEN     (1U << 3)
+#define GICC_IAR_ID_MASK    0x3FFU
+
+#define GIC_FIRST_SPI       32U
+#define GIC_SPURIOUS        1020U
+
+static Fiq_Handler FiqHandler;
+static void *FiqCallBackRef;
+
+#if defined(__aarch64__) && !defined(HOST_SIM)
+
+/* Keep the vector next to the rest of the interrupt path */
+#ifdef FAST_OCM
+#define FIQ_VECTOR_SECTION  ".fast_text"
+#else
+#define FIQ_VECTOR_SECTION  ".text.fiq_vectors"
+#endif
+
+static u64 FiqSavedVbar;
+
+/* ------------------------------------------------------------
+ * VBAR_EL3 table while an interrupt is routed to FIQ. Both FIQ
+ * entries of the current EL go to FiqEntry, every other entry to
+ * the same slot of the BSP table. FiqEntry saves the full frame
+ * (exc_frame.h), FP/SIMD included: the FIQ preempts code that the
+ * BSP's lazy FP save knows nothing about.
+ * ------------------------------------------------------------ */
+#define FIQ_FORWARD(Offset) \
+    "   .balign 0x80\n" \
+    "   b       _vector_table + " #Offset "\n"
+
+__asm__(
+    "   .section " FIQ_VECTOR_SECTION ", \"ax\"\n"
+    "   .balign 0x800\n"
+    "   .global FiqVectors\n"
+    "FiqVectors:\n"
+    FIQ_FORWARD(0x000)
+    FIQ_FORWARD(0x080)
+    "   .balign 0x80\n"
+    "   b       FiqEntry\n"                 /* FIQ, current EL, SP0 */
+    FIQ_FORWARD(0x180)
+    FIQ_FORWARD(0x200)
+    FIQ_FORWARD(0x280)
+    "   .balign 0x80\n"
+    "   b       FiqEntry\n"                 /* FIQ, current EL, SPx */
+    FIQ_FORWARD(0x380)
+    FIQ_FORWARD(0x400)
+    FIQ_FORWARD(0x480)
+    FIQ_FORWARD(0x500)
+    FIQ_FORWARD(0x580)
+    FIQ_FORWARD(0x600)
+    FIQ_FORWARD(0x680)
+    FIQ_FORWARD(0x700)
+    FIQ_FORWARD(0x780)
+    "   .balign 0x80\n"
+    "FiqEntry:\n"
+    EXC_FRAME_SAVE
+    "   bl      Fiq_Dispatch\n"
+    EXC_FRAME_RESTORE
+    "   eret\n"
+    "   .previous\n");
+
+extern u8 FiqVectors[];
+
+static void InstallVector(u32 Id)
+{
+    (void)Id;
+    FiqSavedVbar = mfcp(VBAR_EL3);
+    mtcp(VBAR_EL3, (u64)(UINTPTR)FiqVectors);
+    isb();
+}
+
+static void RemoveVector(void)
+{
+    mtcp(VBAR_EL3, FiqSavedVbar);
+    isb();
+}
+
+#else
+
+#include "sim.h"
+
+/* The simulated core calls Fiq_Dispatch as FiqEntry does */
+static void InstallVector(u32 Id)
+{
+    Sim_ConnectFiq(Id - GIC_FIRST_SPI, Fiq_Dispatch);
+}
+
+static void RemoveVector(void)
+{
+    Sim_DisconnectFiq();
+}
+
+#endif
+
+static u32 GicId(u32 IntrId)
+{
+    return XGet_IntrId(IntrId) + XGet_IntrOffset(IntrId);
+}
+
+static void GicdModify(u32 Offset, u32 Clear, u32 Set)
+{
+    Xil_Out32(GICD_BASE + Offset,
+              (Xil_In32(GICD_BASE + Offset) & ~Clear) | Set);
+}
+
+/* ------------------------------------------------------------
+ * Called from FiqEntry with IRQ and FIQ masked. Only the Group 0
+ * interrupt signals FIQ and it has the highest priority, so the
+ * acknowledge returns it or a spurious ID.
+ * ------------------------------------------------------------ */
+FAST_TEXT void Fiq_Dispatch(void)
+{
+    u32 Iar = Xil_In32(GICC_BASE + GICC_IAR);
+
+    if ((Iar & GICC_IAR_ID_MASK) >= GIC_SPURIOUS) {
+        return;
+    }
+    FiqHandler(FiqCallBackRef);
+    Xil_Out32(GICC_BASE + GICC_EOIR, Iar);
+}
+
+/* ------------------------------------------------------------
+ * Take IntrId (Config.IntrId form) on the FIQ line of the calling
+ * core, disconnected from the IRQ path first. Returns
+ * XST_INVALID_PARAM for an SGI/PPI or no handler.
+ * ------------------------------------------------------------ */
+int Fiq_Route(u32 IntrId, Fiq_Handler Handler, void *CallBackRef)
+{
+    u32 Id = GicId(IntrId);
+    u32 Bit = 1U << (Id % 32U);
+    u32 Lines;
+    u32 Reg;
+
+    if ((Id < GIC_FIRST_SPI) || (Id >= GIC_SPURIOUS) || (Handler == NULL)) {
+        return XST_INVALID_PARAM;
+    }
+
+    Xil_Out32(GICD_BASE + GICD_ICENABLER + (Id / 32U) * 4U, Bit);
+    FiqHandler = Handler;
+    FiqCallBackRef = CallBackRef;
+
+    /* Everything else to Group 1, this one alone in Group 0 */
+    Lines = ((Xil_In32(GICD_BASE + GICD_TYPER) & GICD_TYPER_LINES) + 1U) * 32U;
+    for (Reg = 0; Reg < Lines / 32U; Reg++) {
+        Xil_Out32(GICD_BASE + GICD_IGROUPR + Reg * 4U, 0xFFFFFFFFU);
+    }
+    GicdModify(GICD_IGROUPR + (Id / 32U) * 4U, Bit, 0);
+
+    GicdModify(GICD_IPRIORITYR + (Id & ~3U), 0xFFU << ((Id % 4U) * 8U),
+               FIQ_PRIORITY << ((Id % 4U) * 8U));
+    GicdModify(GICD_ICFGR + (Id / 16U) * 4U,
+               GICD_ICFGR_EDGE << ((Id % 16U) * 2U), 0);
+    IrqAffinity_Set(IntrId, IRQ_AFFINITY_CPU(IrqAffinity_CpuId()));
+
+    InstallVector(Id);
+    GicdModify(GICD_CTLR, 0, GICD_CTLR_ENABLE);
+    Xil_Out32(GICC_BASE + GICC_CTLR,
+              Xil_In32(GICC_BASE + GICC_CTLR) | GICC_CTLR_FIQEN);
+
+    Xil_Out32(GICD_BASE + GICD_ISENABLER + (Id / 32U) * 4U, Bit);
+    Xil_ExceptionEnableMask(XIL_EXCEPTION_FIQ);
+    return XST_SUCCESS;
+}
+
+/* ------------------------------------------------------------
+ * Stop taking IntrId as FIQ. The other interrupts stay in
+ * Group 1, which is still signalled as IRQ.
+ * ------------------------------------------------------------ */
+void Fiq_Unroute(u32 IntrId)
+{
+    u32 Id = GicId(IntrId);
+
+    Xil_ExceptionDisableMask(XIL_EXCEPTION_FIQ);
+    Xil_Out32(GICD_BASE + GICD_ICENABLER + (Id / 32U) * 4U,
+              1U << (Id % 32U));
+    Xil_Out32(GICC_BASE + GICC_CTLR,
+              Xil_In32(GICC_BASE + GICC_CTLR) & ~GICC_CTLR_FIQEN);
+    RemoveVector();
+}
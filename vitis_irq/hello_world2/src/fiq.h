@@ -0,0 +1,55 @@
+/******************************************************************************
+ * One interrupt on the FIQ line (GIC Group 0)
+ *
+ * The standalone BSP at EL3 leaves every interrupt in Group 0 with
+ * GICC_CTLR.FIQEn clear. Every interrupt is then signalled as IRQ and
+ * dispatched through XScuGic_InterruptHandler. Fiq_Route() does the
+ * following:
+ *   - moves every other interrupt to Group 1. The secure CPU interface
+ *     still signals and acknowledges those as IRQ (AckCtl).
+ *   - keeps the chosen interrupt in Group 0 at FIQ_PRIORITY, above
+ *     everything else, and sets FIQEn so that it alone arrives as FIQ.
+ *   - programs it level-sensitive. The device tree declares the PL
+ *     interrupts level-high (interrupts = <0 89 4>), and the AXI timer
+ *     holds its output until TINT is cleared.
+ *   - points VBAR_EL3 at FiqVectors. Its FIQ entries save the
+ *     caller-saved integer registers and every FP/SIMD register
+ *     (exc_frame.h), acknowledge the GIC and call the handler. Every
+ *     other entry branches to the BSP vector table.
+ *
+ * Xil_ExceptionDisable() masks IRQ only, so critical sections that
+ * keep IRQ handlers out do not delay the FIQ. The handler must
+ * therefore not share state with such sections. Taking an IRQ masks
+ * FIQ too, so a running IRQ handler still delays it.
+ *
+ * The handler may use FP. The BSP's lazy FP save covers its own IRQ
+ * path only, and a FIQ can arrive anywhere IRQ handlers are not
+ * running, so FiqEntry saves q0-q31 and FPCR/FPSR eagerly, 720 bytes
+ * of stack in all. FP access must be enabled when the FIQ is
+ * taken, which holds as long as IRQ handlers leave FIQ masked.
+ ******************************************************************************/
+
+#ifndef FIQ_H_
+#define FIQ_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+/* Above XINTERRUPT_DEFAULT_PRIORITY (0xA0), lower is more urgent */
+#ifndef FIQ_PRIORITY
+#define FIQ_PRIORITY        0x10U
+#endif
+
+typedef void (*Fiq_Handler)(void *CallBackRef);
+
+int Fiq_Route(u32 IntrId, Fiq_Handler Handler, void *CallBackRef);
+void Fiq_Unroute(u32 IntrId);
+void Fiq_Dispatch(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
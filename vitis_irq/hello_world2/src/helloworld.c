@@ -13,7 +13,34 @@
 #include "xscugic.h"
 #include "xtmrctr.h"
 #include "xinterrupt_wrap.h"
+#include "isr_log.h"
+#include "latency.h"
+#include "fast_tmr.h"
+#include "cycles.h"
+#include "idle.h"
+#include "twheel.h"
+#include "deadline.h"
+#include "clock64.h"
+#include "fast_mem.h"
+#include "xil_cache.h"
+#include "platform.h"
+#include "mmu.h"
+#include "button.h"
+#include "pwm.h"
+#include "capture.h"
+#include "amp.h"
+#include "irq_affinity.h"
+#include "evtq.h"
+#include "fiq.h"
+#include "irq_rate.h"
+#include "irq_nest.h"
+#include "xpseudo_asm.h"
+#include "sleep.h"
+#include <string.h>
 #include <stdio.h>
+#ifdef HOST_SIM
+#include "sim.h"
+#endif
 
 /* ------------------------------------------------------------
  * Hardware definitions (MUST come from xparameters.h)
@@ -22,27 +49,165 @@
 #define TIMER_INT_ID      XPAR_FABRIC_XTMRCTR_0_INTR
 #define INTC_DEVICE_ID    XPAR_SCUGIC_SINGLE_DEVICE_ID
 #define TIMER_CNTR_0      0
+#define TIMER_CNTR_1      1
 
+/* ------------------------------------------------------------
+ * Demo mode - select through USER_COMPILE_DEFINITIONS in
+ * UserConfig.cmake, e.g. "DEMO_MODE=1"
+ * ------------------------------------------------------------ */
+#define DEMO_MODE_BASIC     0   /* 10 interrupts, 1 s apart, logged */
+#define DEMO_MODE_LATENCY   1   /* IRQ latency histogram */
+#define DEMO_MODE_FASTPATH  2   /* Stock driver ISR vs direct-register ISR */
+#define DEMO_MODE_IDLE      3   /* Wake latency of spin vs WFE vs WFI */
+#define DEMO_MODE_TWHEEL    4   /* Software timer wheel on the one counter */
+#define DEMO_MODE_DEADLINE  5   /* Drift-free absolute deadline periodic timer */
+#define DEMO_MODE_CLOCK64   6   /* 64-bit clock, now64() hammered across a wrap */
+#define DEMO_MODE_COLDISR   7   /* IRQ latency and ISR cost, cold vs warm caches */
+#define DEMO_MODE_MMU       8   /* memcpy and MMIO cost per memory mapping */
+#define DEMO_MODE_BUTTON    9   /* GPIO button interrupt, wheel debounce */
+#define DEMO_MODE_PWM       10  /* PWM0 duty sweep on both counters */
+#define DEMO_MODE_CAPTURE   11  /* Capture-input vs ISR event timestamps */
+#define DEMO_MODE_AMP       12  /* Timer IRQ on the busy core vs on core 1 */
+#define DEMO_MODE_EVTQ      13  /* Timer and GPIO ISRs post to one queue */
+#define DEMO_MODE_FIQ       14  /* Timer on IRQ vs on FIQ, IRQs masked often */
+#define DEMO_MODE_STORM     15  /* Timer storm held off by the rate guard */
+#define DEMO_MODE_NEST      16  /* Timer preempting a slow GPIO handler */
+
+#ifndef DEMO_MODE
+#define DEMO_MODE         DEMO_MODE_BASIC
+#endif
+
+#if DEMO_MODE == DEMO_MODE_BASIC
 /* Timer reset value - 100 MHz clock
  * 100,000,000 cycles = 1 second at 100 MHz
  */
 #define RESET_VALUE       100000000U
+#define IRQ_COUNT         10
+#define IRQ_LOG_ENABLE    1
+#elif DEMO_MODE == DEMO_MODE_TWHEEL
+/* The wheel programs the counter itself, IRQ_COUNT counts 1 s timer fires */
+#define RESET_VALUE       100000000U
+#define IRQ_COUNT         5
+#define IRQ_LOG_ENABLE    1
+#elif DEMO_MODE == DEMO_MODE_CLOCK64
+/* The clock free-runs over the full 32 bits, IRQ_COUNT counts rollovers.
+ * It is started CLOCK64_LEAD cycles before the first one.
+ */
+#define RESET_VALUE       100000000U
+#define IRQ_COUNT         1
+#define IRQ_LOG_ENABLE    1
+#define CLOCK64_LEAD      200000000U
+#elif DEMO_MODE == DEMO_MODE_BUTTON
+/*
+ * The timer wheel only runs debounce timers; the run ends after
+ * IRQ_COUNT debounced presses
+ */
+#define RESET_VALUE       100000000U
+#define IRQ_COUNT         5
+#define IRQ_LOG_ENABLE    1
+#elif DEMO_MODE == DEMO_MODE_PWM
+/*
+ * The PWM sweep runs before the interrupt setup, then a few interrupts
+ * show the counter is back in normal use
+ */
+#define RESET_VALUE       100000000U
+#define IRQ_COUNT         3
+#define IRQ_LOG_ENABLE    1
+#elif DEMO_MODE == DEMO_MODE_STORM
+/*
+ * IRQ_COUNT counts phases: RESET_VALUE, then STORM_RESET_VALUE, then
+ * RESET_VALUE again, STORM_PHASE_MS each
+ */
+#define RESET_VALUE       100000U
+#define IRQ_COUNT         3
+#define IRQ_LOG_ENABLE    0
+#elif DEMO_MODE == DEMO_MODE_MMU
+/* Benchmarks run before the timer starts, then 10 logged interrupts
+ * through the platform mapping of the PL window */
+#define RESET_VALUE       100000000U
+#define IRQ_COUNT         10
+#define IRQ_LOG_ENABLE    1
+#else
+/* Benchmark modes: 100,000 cycles = 1 ms at 100 MHz, 10,000 samples.
+ * Per-interrupt logging would back up the UART at this rate.
+ */
+#define RESET_VALUE       100000U
+#define IRQ_COUNT         10000
+#define IRQ_LOG_ENABLE    0
+#endif
+
+#if DEMO_MODE == DEMO_MODE_NEST
+/* Above the GPIO at XINTERRUPT_DEFAULT_PRIORITY, lower is more urgent */
+#define TIMER_PRIORITY      0x80U
+#else
+#define TIMER_PRIORITY      XINTERRUPT_DEFAULT_PRIORITY
+#endif
+
+/* Main loop idle policy between interrupts (see idle.h) */
+#ifndef IDLE_POLICY
+#define IDLE_POLICY       IDLE_WFI
+#endif
 
 /* ------------------------------------------------------------
  * Driver instances
  * ------------------------------------------------------------ */
-static XTmrCtr TimerCounterInst;
-static XScuGic InterruptController;
+static XTmrCtr TimerCounterInst FAST_DATA;
 
 /*
  * Shared variable between interrupt handler and main loop
  */
-static volatile int TimerExpired = 0;
+static volatile int TimerExpired FAST_DATA = 0;
+
+/*
+ * Deferred log written by the ISR and drained by the main loop, so
+ * the handler never blocks on the UART
+ */
+static IsrLog TimerLog FAST_DATA;
+
+#if DEMO_MODE == DEMO_MODE_LATENCY
+/*
+ * Expiry-to-handler latency, sampled from TCR on ISR entry
+ */
+static LatencyHist IrqLatency FAST_DATA;
+
+/* ------------------------------------------------------------
+ * Latency probe - installed in front of XTmrCtr_InterruptHandler.
+ * The counter reloaded to RESET_VALUE when it hit zero and has been
+ * counting down since, so RESET_VALUE - TCR is the latency in timer
+ * clock cycles.
+ * ------------------------------------------------------------ */
+static FAST_TEXT void TimerLatencyProbe(void *CallBackRef)
+{
+    XTmrCtr *InstancePtr = (XTmrCtr *)CallBackRef;
+    u32 Tcr = XTmrCtr_ReadReg(InstancePtr->BaseAddress, TIMER_CNTR_0,
+                              XTC_TCR_OFFSET);
+
+    LatencyHist_Record(&IrqLatency, RESET_VALUE - Tcr);
+    XTmrCtr_InterruptHandler(InstancePtr);
+}
+#endif
+
+/* ------------------------------------------------------------
+ * Work done on every timer expiry, whichever ISR path got here
+ * ------------------------------------------------------------ */
+static FAST_TEXT void TimerTick(XTmrCtr *InstancePtr, u8 TmrCtrNumber)
+{
+    TimerExpired++;
+    Idle_Signal();
+#if IRQ_LOG_ENABLE
+    IsrLog_Write(&TimerLog, ISR_LOG_EVT_TIMER_EXPIRED, TimerExpired);
+#endif
+
+    /* Stop timer after IRQ_COUNT interrupts */
+    if (TimerExpired >= IRQ_COUNT) {
+        XTmrCtr_SetOptions(InstancePtr, TmrCtrNumber, 0);
+    }
+}
 
 /* ------------------------------------------------------------
  * Timer Interrupt Service Routine
  * ------------------------------------------------------------ */
-void TimerCounterHandler(void *CallBackRef, u8 TmrCtrNumber)
+FAST_TEXT void TimerCounterHandler(void *CallBackRef, u8 TmrCtrNumber)
 {
     XTmrCtr *InstancePtr = (XTmrCtr *)CallBackRef;
 
@@ -52,16 +217,1050 @@ void TimerCounterHandler(void *CallBackRef, u8 TmrCtrNumber)
      * how the callback reference can be used as a pointer to the instance
      * of the timer counter that expired
      */
+#if DEMO_MODE == DEMO_MODE_CAPTURE
+    /* Counter 0 captures; an edge after the probe's read is dropped */
+    if (TmrCtrNumber != TIMER_CNTR_1) {
+        return;
+    }
+#endif
     if (XTmrCtr_IsExpired(InstancePtr, TmrCtrNumber)) {
+        TimerTick(InstancePtr, TmrCtrNumber);
+    }
+}
+
+#if DEMO_MODE == DEMO_MODE_IDLE
+/*
+ * Per idle policy: expiry-to-main-loop wake latency (timer cycles)
+ * and total loop iterations. The run is split in equal phases, one
+ * per policy.
+ */
+#define IDLE_PHASE_IRQS   (IRQ_COUNT / IDLE_NUM_POLICIES)
+
+static LatencyHist WakeLatency[IDLE_NUM_POLICIES];
+static u64 IdleIterations[IDLE_NUM_POLICIES];
+#endif
+
+#if DEMO_MODE == DEMO_MODE_TWHEEL
+/*
+ * Timer wheel demo: a 1 s timer drives the main loop, a few logged
+ * periodic/one-shot timers, and a load of silent periodic timers to
+ * exercise batching
+ */
+#define WHEEL_MS(ms)        ((u32)(ms) * (100000U / TWHEEL_TICK_CYCLES))
+#define WHEEL_LOAD_TIMERS   200
+
+static TWheel TimerWheel;
+static TWheelTimer SecondTimer;
+static TWheelTimer LoggedTimer[4];
+static TWheelTimer LoadTimer[WHEEL_LOAD_TIMERS];
+static volatile u32 LoadFires;
+
+static void WheelSecondHandler(TWheelTimer *TimerPtr, void *CallBackRef)
+{
+    (void)TimerPtr;
+    (void)CallBackRef;
+    TimerExpired++;
+    Idle_Signal();
+    IsrLog_Write(&TimerLog, ISR_LOG_EVT_TIMER_EXPIRED, TimerExpired);
+}
+
+static void WheelLogHandler(TWheelTimer *TimerPtr, void *CallBackRef)
+{
+    (void)TimerPtr;
+    IsrLog_Write(&TimerLog, ISR_LOG_EVT_TWHEEL, (u32)(UINTPTR)CallBackRef);
+}
+
+static void WheelLoadHandler(TWheelTimer *TimerPtr, void *CallBackRef)
+{
+    (void)TimerPtr;
+    (void)CallBackRef;
+    LoadFires++;
+}
+
+static void StartTimerWheel(void)
+{
+    static const u32 LoggedMs[4] = { 100, 250, 330, 2500 };
+    int i;
+
+    TWheel_Init(&TimerWheel, TimerCounterInst.BaseAddress);
+    TWheel_TimerInit(&SecondTimer, WheelSecondHandler, NULL);
+    TWheel_Schedule(&TimerWheel, &SecondTimer, WHEEL_MS(1000), WHEEL_MS(1000));
+
+    /* Three periodic timers and one one-shot, logged by id */
+    for (i = 0; i < 4; i++) {
+        TWheel_TimerInit(&LoggedTimer[i], WheelLogHandler, (void *)(UINTPTR)i);
+        TWheel_Schedule(&TimerWheel, &LoggedTimer[i], WHEEL_MS(LoggedMs[i]),
+                        (i < 3) ? WHEEL_MS(LoggedMs[i]) : 0);
+    }
+
+    /* Background load, periods from 7 to 49 ms */
+    for (i = 0; i < WHEEL_LOAD_TIMERS; i++) {
+        TWheel_TimerInit(&LoadTimer[i], WheelLoadHandler, NULL);
+        TWheel_Schedule(&TimerWheel, &LoadTimer[i], WHEEL_MS(7 + (i % 43)),
+                        WHEEL_MS(7 + (i % 43)));
+    }
+}
+
+static void StopTimerWheel(void)
+{
+    int i;
+
+    TWheel_Stop(&TimerWheel, &SecondTimer);
+    for (i = 0; i < 4; i++) {
+        TWheel_Stop(&TimerWheel, &LoggedTimer[i]);
+    }
+    for (i = 0; i < WHEEL_LOAD_TIMERS; i++) {
+        TWheel_Stop(&TimerWheel, &LoadTimer[i]);
+    }
+}
+#endif
+
+#if DEMO_MODE == DEMO_MODE_BUTTON
+/*
+ * Push button on axi_gpio_0, debounced on a timer wheel that owns the
+ * counter
+ */
+#define BUTTON_BASEADDR     XPAR_XGPIO_0_BASEADDR
+
+static TWheel ButtonWheel;
+static Button PushButton;
+static XGpio_Config *ButtonConfig;
+
+static void ButtonHandler(void *CallBackRef, u32 Pressed, u64 EdgeTime)
+{
+    XTime Now;
+
+    (void)CallBackRef;
+    XTime_GetTime(&Now);
+    IsrLog_Write(&TimerLog,
+                 Pressed ? ISR_LOG_EVT_BUTTON_DOWN : ISR_LOG_EVT_BUTTON_UP,
+                 (u32)((Now - EdgeTime) / (COUNTS_PER_SECOND / 1000000U)));
+    if (Pressed) {
         TimerExpired++;
-        xil_printf("IRQ %d\r\n", TimerExpired);
-        
-        /* Stop timer after 10 interrupts */
-        if (TimerExpired >= 10) {
-            XTmrCtr_SetOptions(InstancePtr, TmrCtrNumber, 0);
+        Idle_Signal();
+    }
+}
+#endif
+
+#if DEMO_MODE == DEMO_MODE_PWM
+/*
+ * PWM0 duty sweep, then a frequency change on the fly. The CPU only
+ * writes TLR1 (and TLR0) per step and sleeps in between.
+ */
+#define PWM_DEMO_HZ         1000U
+#define PWM_STEP_MS         200U
+
+static Pwm LedPwm;
+
+static void PwmStep(u32 FreqHz, u32 Duty)
+{
+    u32 Actual;
+
+    if (Pwm_Set(&LedPwm, FreqHz, Duty) != XST_SUCCESS) {
+        xil_printf("  %d Hz %d.%02d%%: rejected\r\n", (int)FreqHz,
+                   (int)(Duty / 100U), (int)(Duty % 100U));
+        return;
+    }
+    Actual = Pwm_GetDuty(&LedPwm);
+    xil_printf("  %d Hz %d.%02d%%: TLR0 %d, TLR1 %d -> %d Hz %d.%02d%%\r\n",
+               (int)FreqHz, (int)(Duty / 100U), (int)(Duty % 100U),
+               (int)XTmrCtr_ReadReg(LedPwm.BaseAddress, 0, XTC_TLR_OFFSET),
+               (int)XTmrCtr_ReadReg(LedPwm.BaseAddress, 1, XTC_TLR_OFFSET),
+               (int)Pwm_GetFreqHz(&LedPwm), (int)(Actual / 100U),
+               (int)(Actual % 100U));
+    usleep(PWM_STEP_MS * 1000U);
+}
+
+static void PwmSweep(UINTPTR BaseAddress, u32 ClockHz)
+{
+    static const u32 Duty[] = { 1, 100, 1000, 2500, 5000, 7500, 9900,
+                                PWM_DUTY_SCALE };
+    u32 i;
+
+    Pwm_Initialize(&LedPwm, BaseAddress, ClockHz);
+    xil_printf("PWM0 sweep, %d ms per step:\r\n", (int)PWM_STEP_MS);
+    for (i = 0; i < sizeof(Duty) / sizeof(Duty[0]); i++) {
+        PwmStep(PWM_DEMO_HZ, Duty[i]);
+    }
+    PwmStep(20000U, 5000);
+    PwmStep(40000000U, 5000);
+    Pwm_Stop(&LedPwm);
+    xil_printf("PWM0 stopped\r\n");
+}
+#endif
+
+#if DEMO_MODE == DEMO_MODE_CAPTURE
+/*
+ * Counter 0 captures every rising edge on the capture_in pin
+ * (capturetrig0) and interrupts on it; counter 1 runs the 1 ms tick.
+ * The probe also reads TCR0 on ISR entry, the software timestamp of
+ * the same edge, so both methods are compared on the same events in
+ * the same time base. The edges come from outside the design, so
+ * neither timestamp is derived from the other. The main loop runs
+ * MaskedLoad() meanwhile.
+ */
+typedef struct {
+    u32 Last;
+    u32 Min;
+    u32 Max;
+    u32 Count;
+} StampIntervals;
+
+static Capture EdgeCapture FAST_DATA;
+static StampIntervals CaptureIntervals FAST_DATA;
+static StampIntervals IsrIntervals FAST_DATA;
+static LatencyHist IsrStampError FAST_DATA;
+static u8 StampsValid FAST_DATA;
+
+static void StampIntervals_Init(StampIntervals *StatsPtr)
+{
+    StatsPtr->Min = 0xFFFFFFFFU;
+    StatsPtr->Max = 0;
+    StatsPtr->Count = 0;
+}
+
+static FAST_TEXT void StampIntervals_Record(StampIntervals *StatsPtr,
+                                            u32 Stamp)
+{
+    /* Wrap-safe, the counter rolls over every 43 s */
+    u32 Interval = Stamp - StatsPtr->Last;
+
+    if (Interval < StatsPtr->Min) {
+        StatsPtr->Min = Interval;
+    }
+    if (Interval > StatsPtr->Max) {
+        StatsPtr->Max = Interval;
+    }
+    StatsPtr->Count++;
+}
+
+static void StampIntervals_Report(const StampIntervals *StatsPtr,
+                                  const char *Name, u32 ClockHz)
+{
+    u32 Jitter = StatsPtr->Max - StatsPtr->Min;
+
+    if (StatsPtr->Count == 0) {
+        return;
+    }
+    xil_printf("  %s interval %d..%d cycles, jitter %d cycles (%d ns)\r\n",
+               Name, (int)StatsPtr->Min, (int)StatsPtr->Max, (int)Jitter,
+               (int)(((u64)Jitter * 1000000000U) / ClockHz));
+}
+
+/* ------------------------------------------------------------
+ * Capture probe - installed in front of XTmrCtr_InterruptHandler.
+ * TCR0 is read first thing, as a software timestamp would be. The
+ * interrupt may be the tick on counter 1 instead, with no capture.
+ * ------------------------------------------------------------ */
+static FAST_TEXT void TimerCaptureProbe(void *CallBackRef)
+{
+    u32 IsrStamp = Capture_Now(&EdgeCapture);
+    u32 HwStamp;
+
+    if (Capture_Read(&EdgeCapture, &HwStamp) == XST_SUCCESS) {
+        if (StampsValid) {
+            StampIntervals_Record(&CaptureIntervals, HwStamp);
+            StampIntervals_Record(&IsrIntervals, IsrStamp);
+        }
+        LatencyHist_Record(&IsrStampError, IsrStamp - HwStamp);
+        CaptureIntervals.Last = HwStamp;
+        IsrIntervals.Last = IsrStamp;
+        StampsValid = TRUE;
+    }
+    XTmrCtr_InterruptHandler(CallBackRef);
+}
+#endif
+
+#if (DEMO_MODE == DEMO_MODE_CAPTURE) || (DEMO_MODE == DEMO_MODE_AMP) || \
+    (DEMO_MODE == DEMO_MODE_FIQ)
+/* ------------------------------------------------------------
+ * Main loop load until the counter moves: IRQs masked for
+ * pseudo-random stretches, as driver critical sections mask them
+ * ------------------------------------------------------------ */
+#define MASKED_LOAD_MAX_US  20U
+
+static void MaskedLoad(volatile int *CounterPtr, int Last)
+{
+    static u32 Seed = 1U;
+
+    while (*CounterPtr == Last) {
+        Seed = (Seed * 1664525U) + 1013904223U;
+        Xil_ExceptionDisable();
+        usleep((Seed >> 16) % MASKED_LOAD_MAX_US);
+        Xil_ExceptionEnable();
+    }
+}
+#endif
+
+#if DEMO_MODE == DEMO_MODE_AMP
+/*
+ * The timer interrupt targets core 0 for the first half of the run and
+ * core 1 for the second. Core 0 runs the same load throughout: masked
+ * sections of pseudo-random length, as driver critical sections would
+ * be. Whichever core takes the interrupt posts the expiry-to-handler
+ * latency to core 0 through the OCM mailbox.
+ */
+#define AMP_EVT_TIMER       1U
+
+static AmpMailbox TimerMailbox AMP_SHARED;
+static LatencyHist AmpLatency[2];
+static u8 TimerOnCore1;
+static volatile u32 Core1Id;
+
+/* ------------------------------------------------------------
+ * Latency probe as TimerLatencyProbe, on either core
+ * ------------------------------------------------------------ */
+static FAST_TEXT void TimerAmpProbe(void *CallBackRef)
+{
+    XTmrCtr *InstancePtr = (XTmrCtr *)CallBackRef;
+    u32 Tcr = XTmrCtr_ReadReg(InstancePtr->BaseAddress, TIMER_CNTR_0,
+                              XTC_TCR_OFFSET);
+
+    AmpMailbox_Post(&TimerMailbox, AMP_EVT_TIMER, RESET_VALUE - Tcr);
+    XTmrCtr_InterruptHandler(InstancePtr);
+}
+
+/* Runs on core 1; the handler table it dispatches from is shared */
+static void Core1Setup(void *Arg)
+{
+    (void)Arg;
+    Core1Id = IrqAffinity_CpuId();
+}
+
+static void AmpDrain(void)
+{
+    AmpMsg Msg;
+
+    while (AmpMailbox_Take(&TimerMailbox, &Msg) == XST_SUCCESS) {
+        if ((Msg.Event == AMP_EVT_TIMER) && (Msg.Cpu < 2U)) {
+            LatencyHist_Record(&AmpLatency[Msg.Cpu], Msg.Data);
+        }
+    }
+}
+
+#endif
+
+#if DEMO_MODE == DEMO_MODE_FIQ
+/*
+ * The timer interrupt comes in on IRQ for the first half of the run
+ * and on FIQ for the second, under the same masked load. Both probes
+ * read TCR first thing, so they measure expiry to handler entry.
+ */
+static LatencyHist FiqLatency[2];   /* 0: IRQ, 1: FIQ */
+static FastTmr FastTimerFiq;
+static u8 TimerOnFiq;
+
+static FAST_TEXT void TimerIrqPhaseProbe(void *CallBackRef)
+{
+    XTmrCtr *InstancePtr = (XTmrCtr *)CallBackRef;
+    u32 Tcr = XTmrCtr_ReadReg(InstancePtr->BaseAddress, TIMER_CNTR_0,
+                              XTC_TCR_OFFSET);
+
+    LatencyHist_Record(&FiqLatency[0], RESET_VALUE - Tcr);
+    XTmrCtr_InterruptHandler(InstancePtr);
+}
+
+/* ------------------------------------------------------------
+ * FIQ side: no driver calls, see fiq.h. FastTmr acks TINT with
+ * one read and one write, then counts the expiry here.
+ * ------------------------------------------------------------ */
+static FAST_TEXT void TimerFiqTick(void *CallBackRef)
+{
+    (void)CallBackRef;
+    TimerExpired++;
+    Idle_Signal();
+}
+
+static FAST_TEXT void TimerFiqProbe(void *CallBackRef)
+{
+    FastTmr *TmrPtr = (FastTmr *)CallBackRef;
+    u32 Tcr = XTmrCtr_ReadReg(TmrPtr->BaseAddress, TIMER_CNTR_0,
+                              XTC_TCR_OFFSET);
+
+    LatencyHist_Record(&FiqLatency[1], RESET_VALUE - Tcr);
+    FastTmr_InterruptHandler(TmrPtr);
+}
+#endif
+
+#if DEMO_MODE == DEMO_MODE_STORM
+/*
+ * The timer runs at 1 kHz, then with a reload far shorter than its
+ * handler, then at 1 kHz again. The rate guard sits in front of the
+ * fast-path handler and allows STORM_LIMIT expiries per window. The
+ * main loop does STORM_WORK_US units of work and polls the guard
+ * between them. Per phase it counts its passes and the handler time
+ * the guard let through.
+ */
+#define STORM_RESET_VALUE   50U         /* 0.52 us period */
+#define STORM_PHASE_MS      1000U
+#define STORM_WINDOW_US     10000U
+#define STORM_LIMIT         50U         /* 5 kHz */
+#define STORM_WORK_US       10U
+
+typedef struct {
+    u32 Expiries;
+    u32 Trips;
+    u32 ThrottledMs;
+    u32 Passes;
+    u32 HandlerUs;
+} StormPhase;
+
+static const u32 StormReload[IRQ_COUNT] = {
+    RESET_VALUE, STORM_RESET_VALUE, RESET_VALUE
+};
+
+static FastTmr StormTimer FAST_DATA;
+static IrqRate TimerRate FAST_DATA;
+static volatile u32 StormExpiries FAST_DATA;
+static StormPhase StormPhases[IRQ_COUNT];
+
+static FAST_TEXT void StormTick(void *CallBackRef)
+{
+    (void)CallBackRef;
+    StormExpiries++;
+}
+
+/* ------------------------------------------------------------
+ * One phase of main loop work at the given reload value
+ * ------------------------------------------------------------ */
+static void StormRun(u32 Phase)
+{
+    StormPhase *PhasePtr = &StormPhases[Phase];
+    u32 Expiries = StormExpiries;
+    u32 Trips = TimerRate.Trips;
+    u64 Throttled = TimerRate.ThrottledCycles;
+    u64 Handler = TimerRate.HandlerCycles;
+    XTime Start;
+    XTime Now;
+
+    XTmrCtr_SetResetValue(&TimerCounterInst, TIMER_CNTR_0,
+                          StormReload[Phase]);
+    XTime_GetTime(&Start);
+    do {
+        usleep(STORM_WORK_US);
+        PhasePtr->Passes++;
+        IrqRate_Poll(&TimerRate);
+        XTime_GetTime(&Now);
+    } while ((Now - Start) <
+             (XTime)STORM_PHASE_MS * (COUNTS_PER_SECOND / 1000U));
+
+    /* A hold counts towards the phase it ends in */
+    PhasePtr->Expiries = StormExpiries - Expiries;
+    PhasePtr->Trips = TimerRate.Trips - Trips;
+    PhasePtr->ThrottledMs = (u32)((TimerRate.ThrottledCycles - Throttled) /
+                                  (COUNTS_PER_SECOND / 1000U));
+    PhasePtr->HandlerUs = (u32)((TimerRate.HandlerCycles - Handler) /
+                                (COUNTS_PER_SECOND / 1000000U));
+}
+#endif
+
+#if DEMO_MODE == DEMO_MODE_NEST
+/*
+ * The timer every 1 ms, and the push button's raw edges with a handler
+ * that busy-waits NEST_SLOW_US, as one stuck on a slow peripheral
+ * would. The timer has the higher GIC priority. The run has three
+ * phases, by the GPIO handler's preemption budget:
+ *   0: none, the GPIO handler runs masked as it would without nesting
+ *   1: NEST_BUDGET_US, then it finishes masked
+ *   2: unlimited
+ * The probe measures expiry to timer handler. An expiry held up past
+ * the next one is folded into it: it is recorded with the latency of
+ * the oldest expiry and counted as missed.
+ */
+#define NEST_GPIO_BASEADDR  XPAR_XGPIO_0_BASEADDR
+#define NEST_GPIO_CHANNEL   1U
+#define NEST_SLOW_US        2500U
+#define NEST_BUDGET_US      1U
+#define NEST_PHASES         3U
+
+typedef struct {
+    u32 GpioRuns;
+    u32 MaxGpioUs;      /* Longest GPIO handler run */
+    u32 Preemptions;
+    u32 BudgetSpent;
+    u32 Missed;         /* Timer expiries folded into a later one */
+} NestPhase;
+
+static const u32 NestBudgetUs[NEST_PHASES] = {
+    0, NEST_BUDGET_US, IRQ_NEST_UNLIMITED
+};
+static const char *const NestPhaseName[NEST_PHASES] = {
+    "Timer, GPIO handler masked", "Timer, GPIO handler on a budget",
+    "Timer, GPIO handler preemptible"
+};
+
+static IrqNestSource TimerNest FAST_DATA;
+static IrqNestSource GpioNest;
+static XGpio NestGpio;
+static XGpio_Config *NestGpioConfig;
+static LatencyHist NestLatency[NEST_PHASES];
+static NestPhase NestPhases[NEST_PHASES];
+static volatile u32 NestPhaseNow;
+static XTime LastTimerEntry FAST_DATA;
+static u32 LastTimerLatency FAST_DATA;
+
+/* ------------------------------------------------------------
+ * Timer probe, as TimerLatencyProbe. The gap since the last entry
+ * says how many expiries the counter went through meanwhile.
+ * ------------------------------------------------------------ */
+static FAST_TEXT void TimerNestProbe(void *CallBackRef)
+{
+    XTmrCtr *InstancePtr = (XTmrCtr *)CallBackRef;
+    u32 Tcr = XTmrCtr_ReadReg(InstancePtr->BaseAddress, TIMER_CNTR_0,
+                              XTC_TCR_OFFSET);
+    u32 Period = RESET_VALUE + 2U;
+    u32 Latency = RESET_VALUE - Tcr;
+    NestPhase *PhasePtr = &NestPhases[NestPhaseNow];
+    XTime Now;
+
+    XTime_GetTime(&Now);
+    if (LastTimerEntry != 0) {
+        /* Last expiry taken to this one, in timer cycles */
+        s64 Between = (s64)(((Now - LastTimerEntry) *
+                         InstancePtr->Config.SysClockFreqHz) /
+                        COUNTS_PER_SECOND) - Latency + LastTimerLatency;
+        u32 Expiries = (u32)((Between + Period / 2U) / Period);
+        if (Expiries > 1U) {
+            PhasePtr->Missed += Expiries - 1U;
+            Latency += (Expiries - 1U) * Period;
+        }
+    }
+    LastTimerEntry = Now;
+    LastTimerLatency = RESET_VALUE - Tcr;
+
+    LatencyHist_Record(&NestLatency[NestPhaseNow], Latency);
+    XTmrCtr_InterruptHandler(InstancePtr);
+}
+
+/* ------------------------------------------------------------
+ * GPIO: ack, then hold the CPU for NEST_SLOW_US
+ * ------------------------------------------------------------ */
+static void GpioSlowHandler(void *CallBackRef)
+{
+    XGpio *GpioPtr = (XGpio *)CallBackRef;
+    NestPhase *PhasePtr = &NestPhases[NestPhaseNow];
+    XTime Start;
+    XTime End;
+    u32 Us;
+
+    XTime_GetTime(&Start);
+    XGpio_InterruptClear(GpioPtr, XGPIO_IR_CH1_MASK);
+    usleep(NEST_SLOW_US);
+    XTime_GetTime(&End);
+
+    Us = (u32)((End - Start) / (COUNTS_PER_SECOND / 1000000U));
+    if (Us > PhasePtr->MaxGpioUs) {
+        PhasePtr->MaxGpioUs = Us;
+    }
+    PhasePtr->GpioRuns++;
+}
+
+/* GPIO handler counters since the last call, into Phase */
+static void NestTakeCounts(u32 Phase)
+{
+    static u32 Preemptions;
+    static u32 BudgetSpent;
+
+    NestPhases[Phase].Preemptions = GpioNest.Preemptions - Preemptions;
+    NestPhases[Phase].BudgetSpent = GpioNest.BudgetSpent - BudgetSpent;
+    Preemptions = GpioNest.Preemptions;
+    BudgetSpent = GpioNest.BudgetSpent;
+}
+
+static int NestInit(void)
+{
+    u32 i;
+    int Status;
+
+    for (i = 0; i < NEST_PHASES; i++) {
+        LatencyHist_Init(&NestLatency[i], 64U);
+    }
+    NestPhaseNow = 0;
+    IrqNest_Initialize(&TimerNest, TimerNestProbe, &TimerCounterInst, 0);
+    IrqNest_Initialize(&GpioNest, GpioSlowHandler, &NestGpio,
+                       NestBudgetUs[0]);
+
+    NestGpioConfig = XGpio_LookupConfig(NEST_GPIO_BASEADDR);
+    Status = XGpio_Initialize(&NestGpio, NEST_GPIO_BASEADDR);
+    if ((Status != XST_SUCCESS) || (NestGpioConfig == NULL)) {
+        return XST_FAILURE;
+    }
+    XGpio_SetDataDirection(&NestGpio, NEST_GPIO_CHANNEL, 0x1U);
+    XGpio_InterruptDisable(&NestGpio, XGPIO_IR_MASK);
+    return XST_SUCCESS;
+}
+
+static void NestReport(void)
+{
+    u32 i;
+
+    for (i = 0; i < NEST_PHASES; i++) {
+        LatencyHist_Report(&NestLatency[i], NestPhaseName[i],
+                           TimerCounterInst.Config.SysClockFreqHz);
+        xil_printf("  %d timer expiries missed; GPIO handler: %d runs,"
+                   " longest %d us, preempted %d times, %d finished masked"
+                   "\r\n", (int)NestPhases[i].Missed,
+                   (int)NestPhases[i].GpioRuns, (int)NestPhases[i].MaxGpioUs,
+                   (int)NestPhases[i].Preemptions,
+                   (int)NestPhases[i].BudgetSpent);
+    }
+}
+
+static void NestSetPhase(int Expired)
+{
+    u32 Phase = ((u32)Expired * NEST_PHASES) / IRQ_COUNT;
+
+    if ((Phase == NestPhaseNow) || (Phase >= NEST_PHASES)) {
+        return;
+    }
+    NestTakeCounts(NestPhaseNow);
+    IrqNest_SetBudget(&GpioNest, NestBudgetUs[Phase]);
+    NestPhaseNow = Phase;
+}
+#endif
+
+#if DEMO_MODE == DEMO_MODE_EVTQ
+/*
+ * Two interrupt sources post to one event queue: the timer every 1 ms
+ * and every raw edge of the push button, bounces included. The main
+ * loop sleeps until something is queued and takes it in batches.
+ * Every EVTQ_STALL_EVERY expiries it is held up for EVTQ_STALL_US, as
+ * a slow UART write would hold it, and once for longer than the queue
+ * lasts. The sequence numbers in the timer events show what was lost.
+ */
+#define EDGE_GPIO_BASEADDR  XPAR_XGPIO_0_BASEADDR
+#define EDGE_GPIO_CHANNEL   1U
+
+#define APP_EVT_TIMER       1U  /* Data = post sequence number */
+#define APP_EVT_EDGE        2U  /* Data = GPIO level */
+
+#define EVTQ_BATCH          16U
+#define EVTQ_STALL_EVERY    1000U
+#define EVTQ_STALL_US       20000U
+#define EVTQ_OVERRUN_US     100000U
+
+static EvtQ AppEvents;
+static XGpio EdgeGpio;
+static XGpio_Config *EdgeGpioConfig;
+
+/* Posted by the handlers */
+static volatile u32 TimerPosts;
+static volatile u32 EdgePosts;
+
+/* Seen by the main loop */
+static u32 TimerEvents;
+static u32 EdgeEvents;
+static u32 TimerSeqGaps;
+static u32 LastTimerSeq;
+static u32 EvtRefused;
+static u32 BatchSizes[EVTQ_BATCH + 1U];
+
+/* ------------------------------------------------------------
+ * Timer: stock driver handler, then post the expiry
+ * ------------------------------------------------------------ */
+static FAST_TEXT void TimerEvtQProbe(void *CallBackRef)
+{
+    XTmrCtr *InstancePtr = (XTmrCtr *)CallBackRef;
+
+    XTmrCtr_InterruptHandler(InstancePtr);
+    TimerPosts++;
+    EvtQ_Post(&AppEvents, APP_EVT_TIMER, (u16)IrqAffinity_CpuId(),
+              TimerPosts);
+}
+
+/* ------------------------------------------------------------
+ * GPIO: post the level on every edge, no debounce
+ * ------------------------------------------------------------ */
+static FAST_TEXT void EdgeGpioHandler(void *CallBackRef)
+{
+    XGpio *GpioPtr = (XGpio *)CallBackRef;
+    u32 Level = XGpio_DiscreteRead(GpioPtr, EDGE_GPIO_CHANNEL);
+
+    XGpio_InterruptClear(GpioPtr, XGPIO_IR_CH1_MASK);
+    EdgePosts++;
+    EvtQ_Post(&AppEvents, APP_EVT_EDGE, (u16)IrqAffinity_CpuId(), Level);
+}
+
+static void EvtQHandle(const EvtQEvent *EventPtr)
+{
+    switch (EventPtr->Type) {
+    case APP_EVT_TIMER:
+        TimerSeqGaps += EventPtr->Data - LastTimerSeq - 1U;
+        LastTimerSeq = EventPtr->Data;
+        TimerEvents++;
+        break;
+    case APP_EVT_EDGE:
+        EdgeEvents++;
+        break;
+    default:
+        break;
+    }
+}
+
+static void EvtQDrainAll(void)
+{
+    EvtQEvent Batch[EVTQ_BATCH];
+    u32 Count;
+    u32 i;
+
+    while ((Count = EvtQ_Drain(&AppEvents, Batch, EVTQ_BATCH)) != 0) {
+        BatchSizes[Count]++;
+        for (i = 0; i < Count; i++) {
+            EvtQHandle(&Batch[i]);
         }
     }
+    EvtRefused += EvtQ_TakeOverflows(&AppEvents);
+}
+
+/* ------------------------------------------------------------
+ * Main loop: sleep as IDLE_WFI does until an event is queued,
+ * then take everything queued
+ * ------------------------------------------------------------ */
+static void EvtQWork(void)
+{
+    Xil_ExceptionDisable();
+    while (EvtQ_IsEmpty(&AppEvents)) {
+        dsb();
+        wfi();
+        Xil_ExceptionEnable();
+        Xil_ExceptionDisable();
+    }
+    Xil_ExceptionEnable();
+
+    EvtQDrainAll();
+}
+
+/* ------------------------------------------------------------
+ * Hold the main loop up every EVTQ_STALL_EVERY expiries, past
+ * the queue's depth halfway through the run
+ * ------------------------------------------------------------ */
+static void EvtQStall(int Expired)
+{
+    static u32 Stalls;
+
+    if (((u32)Expired / EVTQ_STALL_EVERY) > Stalls) {
+        Stalls++;
+        usleep((Stalls == (IRQ_COUNT / EVTQ_STALL_EVERY / 2U)) ?
+               EVTQ_OVERRUN_US : EVTQ_STALL_US);
+    }
+}
+#endif
+
+#if DEMO_MODE == DEMO_MODE_DEADLINE
+/*
+ * Absolute deadline periodic timer, RESET_VALUE is the base period
+ */
+static DlTimer DeadlineTimer;
+
+static void DeadlineHandler(void *CallBackRef, u64 Deadline)
+{
+    (void)CallBackRef;
+    (void)Deadline;
+    TimerExpired++;
+    Idle_Signal();
 }
+#endif
+
+#if DEMO_MODE == DEMO_MODE_CLOCK64
+/*
+ * 64-bit clock, rollovers logged with the clock value read in the ISR
+ */
+static Clock64 SystemClock64;
+
+static void Clock64Handler(void *CallBackRef, u32 Epoch)
+{
+    (void)CallBackRef;
+    TimerExpired++;
+    Idle_Signal();
+    IsrLog_Write(&TimerLog, ISR_LOG_EVT_TIMER_EXPIRED, Epoch);
+    IsrLog_Write(&TimerLog, ISR_LOG_EVT_CLOCK64, (u32)now64());
+}
+
+/* ------------------------------------------------------------
+ * Read now64() back to back until the first rollover has been
+ * serviced; every read must be >= the one before
+ * ------------------------------------------------------------ */
+static void CheckClock64(void)
+{
+    u64 Last = now64();
+    u64 Now;
+    u32 Reads = 0;
+    u32 Backwards = 0;
+
+    xil_printf("now64() before rollover: 0x%08X%08X\r\n",
+               (u32)(Last >> 32), (u32)Last);
+    while (TimerExpired == 0) {
+        Now = now64();
+        if (Now < Last) {
+            Backwards++;
+        }
+        Last = Now;
+        Reads++;
+    }
+    xil_printf("now64() after rollover:  0x%08X%08X\r\n",
+               (u32)(Last >> 32), (u32)Last);
+    xil_printf("%d reads, %d went backwards\r\n", (int)Reads, (int)Backwards);
+}
+#endif
+
+#if DEMO_MODE == DEMO_MODE_FASTPATH
+/*
+ * Fast path instance and per-path ISR cost in CPU cycles
+ */
+static FastTmr FastTimerInst FAST_DATA;
+static LatencyHist StockIsrCycles FAST_DATA;
+static LatencyHist FastIsrCycles FAST_DATA;
+
+#ifdef HOST_SIM
+/* AXI reads and writes of each path, counted by the register model.
+ * A run that finds no T0INT to acknowledge writes nothing; it is
+ * counted apart, not averaged in. */
+typedef struct {
+    u64 Reads;
+    u64 Writes;
+    u32 Acked;
+    u32 Unacked;
+} AxiTotals;
+
+static AxiTotals StockAxi;
+static AxiTotals FastAxi;
+
+static void AxiTally(AxiTotals *Total, const u64 *Before)
+{
+    u64 Reads;
+    u64 Writes;
+
+    Sim_AxiCounts(&Reads, &Writes);
+    if (Writes == Before[1]) {
+        Total->Unacked++;
+        return;
+    }
+    Total->Reads += Reads - Before[0];
+    Total->Writes += Writes - Before[1];
+    Total->Acked++;
+}
+
+/* Tenths of Total / Count, rounded */
+static u32 AxiTenths(u64 Total, u32 Count)
+{
+    return (u32)(((Total * 10U) + (Count / 2U)) / Count);
+}
+
+static void AxiReport(const AxiTotals *Total)
+{
+    u32 Reads;
+    u32 Writes;
+
+    if (Total->Acked != 0) {
+        Reads = AxiTenths(Total->Reads, Total->Acked);
+        Writes = AxiTenths(Total->Writes, Total->Acked);
+        xil_printf("  AXI accesses per IRQ: %d.%d read(s) + %d.%d write(s)"
+                   " (register model)\r\n", (int)(Reads / 10U),
+                   (int)(Reads % 10U), (int)(Writes / 10U),
+                   (int)(Writes % 10U));
+        xil_printf("  %d reads + %d writes over %d acknowledged IRQs\r\n",
+                   (int)Total->Reads, (int)Total->Writes,
+                   (int)Total->Acked);
+    }
+    if (Total->Unacked != 0) {
+        xil_printf("  %d run(s) with nothing to acknowledge not counted\r\n",
+                   (int)Total->Unacked);
+    }
+}
+#endif
+
+/* ------------------------------------------------------------
+ * Fast path callback - T0INT is already acked, no re-check needed
+ * ------------------------------------------------------------ */
+static FAST_TEXT void TimerFastHandler(void *CallBackRef)
+{
+    TimerTick((XTmrCtr *)CallBackRef, TIMER_CNTR_0);
+}
+
+/* ------------------------------------------------------------
+ * Comparison ISR - first half of the run goes through the stock
+ * driver, second half through the fast path. Both are timed with
+ * the PMU cycle counter from the same entry point.
+ * ------------------------------------------------------------ */
+static FAST_TEXT void TimerIsrCompare(void *CallBackRef)
+{
+    u64 Start = Cycles_Read();
+#ifdef HOST_SIM
+    u64 Axi[2];
+
+    Sim_AxiCounts(&Axi[0], &Axi[1]);
+#endif
+
+    if (TimerExpired < (IRQ_COUNT / 2)) {
+        XTmrCtr_InterruptHandler(CallBackRef);
+        LatencyHist_Record(&StockIsrCycles, (u32)(Cycles_Read() - Start));
+#ifdef HOST_SIM
+        AxiTally(&StockAxi, Axi);
+#endif
+    } else {
+        FastTmr_InterruptHandler(&FastTimerInst);
+        LatencyHist_Record(&FastIsrCycles, (u32)(Cycles_Read() - Start));
+#ifdef HOST_SIM
+        AxiTally(&FastAxi, Axi);
+#endif
+    }
+}
+#endif
+
+#if DEMO_MODE == DEMO_MODE_COLDISR
+/*
+ * Latency (timer clock) and ISR cost (CPU cycles) with the caches
+ * flushed before the interrupt, and with them left warm
+ */
+static LatencyHist ColdLatency FAST_DATA;
+static LatencyHist WarmLatency FAST_DATA;
+static LatencyHist ColdIsrCycles FAST_DATA;
+static LatencyHist WarmIsrCycles FAST_DATA;
+
+/* Set by the main loop when it flushed before waiting */
+static volatile int CachesFlushed FAST_DATA;
+
+/* ------------------------------------------------------------
+ * Cache probe - latency as TimerLatencyProbe, then the stock
+ * driver ISR timed with the PMU cycle counter
+ * ------------------------------------------------------------ */
+static FAST_TEXT void TimerCacheProbe(void *CallBackRef)
+{
+    XTmrCtr *InstancePtr = (XTmrCtr *)CallBackRef;
+    u32 Tcr = XTmrCtr_ReadReg(InstancePtr->BaseAddress, TIMER_CNTR_0,
+                              XTC_TCR_OFFSET);
+    u64 Start = Cycles_Read();
+
+    XTmrCtr_InterruptHandler(InstancePtr);
+    if (CachesFlushed) {
+        LatencyHist_Record(&ColdIsrCycles, (u32)(Cycles_Read() - Start));
+        LatencyHist_Record(&ColdLatency, RESET_VALUE - Tcr);
+    } else {
+        LatencyHist_Record(&WarmIsrCycles, (u32)(Cycles_Read() - Start));
+        LatencyHist_Record(&WarmLatency, RESET_VALUE - Tcr);
+    }
+}
+
+/* ------------------------------------------------------------
+ * Every other interrupt: write back and invalidate L1/L2 data and
+ * invalidate the I-cache, so the next IRQ fetches its vectors, code,
+ * driver state and stack from memory. Last thing before the wait.
+ * ------------------------------------------------------------ */
+static void PrepareCaches(int LastTimerExpired)
+{
+    CachesFlushed = ((LastTimerExpired & 1) == 0);
+    if (CachesFlushed) {
+        Xil_DCacheFlush();
+        Xil_ICacheInvalidate();
+    }
+}
+#endif
+
+#if DEMO_MODE == DEMO_MODE_MMU
+/* One 2 MB block each, so remapping them touches nothing else */
+#define MMU_BENCH_COPY      0x40000U    /* 256 KB: past L1, within L2 */
+#define MMU_BENCH_ROUNDS    16U
+#define MMIO_BENCH_ACCESSES 1000U
+
+static u8 BenchSrc[MMU_BLOCK_SIZE] __attribute__((aligned(MMU_BLOCK_SIZE)));
+static u8 BenchDst[MMU_BLOCK_SIZE] __attribute__((aligned(MMU_BLOCK_SIZE)));
+
+static const u64 BenchMemAttrs[] = {
+    MMU_NORMAL_WB, MMU_NORMAL_WT, MMU_NORMAL_NC
+};
+static const u64 BenchMmioAttrs[] = {
+    MMU_DEVICE_NGNRNE, MMU_DEVICE_NGNRE
+};
+
+static u32 CyclesToNs(u64 Cycles, u32 Count)
+{
+    return (u32)((Cycles * 1000000000U) / CYCLES_PER_SECOND / Count);
+}
+
+/* ------------------------------------------------------------
+ * memcpy bandwidth with both buffers under each normal mapping
+ * ------------------------------------------------------------ */
+static void BenchMemcpy(void)
+{
+    u64 Start;
+    u64 Cycles;
+    u32 i;
+    u32 j;
+
+    memset(BenchSrc, 0x5A, MMU_BENCH_COPY);
+    xil_printf("memcpy %d KB x %d:\r\n", (int)(MMU_BENCH_COPY / 1024U),
+               (int)MMU_BENCH_ROUNDS);
+    for (i = 0; i < sizeof(BenchMemAttrs) / sizeof(BenchMemAttrs[0]); i++) {
+        if ((Mmu_MapRange((UINTPTR)BenchSrc, MMU_BLOCK_SIZE,
+                          BenchMemAttrs[i]) != XST_SUCCESS) ||
+            (Mmu_MapRange((UINTPTR)BenchDst, MMU_BLOCK_SIZE,
+                          BenchMemAttrs[i]) != XST_SUCCESS)) {
+            xil_printf("  cannot remap, not at EL3 or not the BSP MAIR\r\n");
+            return;
+        }
+        memcpy(BenchDst, BenchSrc, MMU_BENCH_COPY);     /* Warm up */
+
+        Start = Cycles_Read();
+        for (j = 0; j < MMU_BENCH_ROUNDS; j++) {
+            memcpy(BenchDst, BenchSrc, MMU_BENCH_COPY);
+        }
+        Cycles = Cycles_Read() - Start;
+        if (Cycles == 0U) {
+            xil_printf("  %s: not timed\r\n", Mmu_AttrName(BenchMemAttrs[i]));
+            continue;
+        }
+        xil_printf("  %s: %d MB/s\r\n", Mmu_AttrName(BenchMemAttrs[i]),
+                   (int)(((u64)MMU_BENCH_COPY * MMU_BENCH_ROUNDS *
+                          CYCLES_PER_SECOND) / Cycles / 1000000U));
+    }
+    Mmu_MapRange((UINTPTR)BenchSrc, MMU_BLOCK_SIZE, MMU_NORMAL_WB);
+    Mmu_MapRange((UINTPTR)BenchDst, MMU_BLOCK_SIZE, MMU_NORMAL_WB);
+}
+
+/* ------------------------------------------------------------
+ * AXI timer register access cost under each device mapping: TCR
+ * reads, and writes to the load register of the idle counter 1
+ * ------------------------------------------------------------ */
+static void BenchMmio(UINTPTR BaseAddress)
+{
+    UINTPTR Block = BaseAddress & ~(UINTPTR)(MMU_BLOCK_SIZE - 1U);
+    u64 Start;
+    u64 ReadCycles;
+    u64 WriteCycles;
+    u32 i;
+    u32 j;
+
+    xil_printf("AXI timer access, %d each:\r\n", (int)MMIO_BENCH_ACCESSES);
+    for (i = 0; i < sizeof(BenchMmioAttrs) / sizeof(BenchMmioAttrs[0]); i++) {
+        if (Mmu_MapRange(Block, MMU_BLOCK_SIZE, BenchMmioAttrs[i]) !=
+            XST_SUCCESS) {
+            xil_printf("  cannot remap, not at EL3 or not the BSP MAIR\r\n");
+            return;
+        }
+
+        Start = Cycles_Read();
+        for (j = 0; j < MMIO_BENCH_ACCESSES; j++) {
+            (void)XTmrCtr_ReadReg(BaseAddress, TIMER_CNTR_0, XTC_TCR_OFFSET);
+        }
+        ReadCycles = Cycles_Read() - Start;
+
+        Start = Cycles_Read();
+        for (j = 0; j < MMIO_BENCH_ACCESSES; j++) {
+            XTmrCtr_WriteReg(BaseAddress, 1, XTC_TLR_OFFSET, j);
+        }
+        /* Posted writes count once they have landed */
+        (void)XTmrCtr_ReadReg(BaseAddress, 1, XTC_TLR_OFFSET);
+        WriteCycles = Cycles_Read() - Start;
+
+        xil_printf("  %s: read %d ns, write %d ns\r\n",
+                   Mmu_AttrName(BenchMmioAttrs[i]),
+                   (int)CyclesToNs(ReadCycles, MMIO_BENCH_ACCESSES),
+                   (int)CyclesToNs(WriteCycles, MMIO_BENCH_ACCESSES));
+    }
+    XTmrCtr_WriteReg(BaseAddress, 1, XTC_TLR_OFFSET, 0);
+    (void)Mmu_MapPlatform();
+}
+#endif
 
 /* Note: Interrupt setup is handled by XSetupInterruptSystem() wrapper
  * which is part of the SDT (Software Defined Timer) platform support.
@@ -75,7 +1274,14 @@ int main(void)
 {
     int Status;
     int LastTimerExpired = 0;
+#if DEMO_MODE == DEMO_MODE_CAPTURE
+    /* Counter 0 captures capture_in */
+    u8 TmrCtrNumber = TIMER_CNTR_1;
+#else
     u8 TmrCtrNumber = TIMER_CNTR_0;
+#endif
+
+    init_platform();
 
     xil_printf("\r\n");
     xil_printf("===================================\r\n");
@@ -107,15 +1313,143 @@ int main(void)
     }
     xil_printf("Timer self-test passed\r\n");
 
+    /* The ISR log must be empty before the first interrupt can fire */
+    IsrLog_Init(&TimerLog);
+#if DEMO_MODE == DEMO_MODE_LATENCY
+    LatencyHist_Init(&IrqLatency, LATENCY_BUCKET_CYCLES);
+#elif DEMO_MODE == DEMO_MODE_FASTPATH
+    FastTmr_Initialize(&FastTimerInst, TimerCounterInst.BaseAddress,
+                       TimerFastHandler, &TimerCounterInst);
+    LatencyHist_Init(&StockIsrCycles, 16U);
+    LatencyHist_Init(&FastIsrCycles, 16U);
+    Cycles_Enable();
+#elif DEMO_MODE == DEMO_MODE_COLDISR
+    LatencyHist_Init(&ColdLatency, LATENCY_BUCKET_CYCLES);
+    LatencyHist_Init(&WarmLatency, LATENCY_BUCKET_CYCLES);
+    LatencyHist_Init(&ColdIsrCycles, 32U);
+    LatencyHist_Init(&WarmIsrCycles, 32U);
+    Cycles_Enable();
+#elif DEMO_MODE == DEMO_MODE_IDLE
+    for (int i = 0; i < IDLE_NUM_POLICIES; i++) {
+        LatencyHist_Init(&WakeLatency[i], LATENCY_BUCKET_CYCLES);
+        IdleIterations[i] = 0;
+    }
+#elif DEMO_MODE == DEMO_MODE_BUTTON
+    Cycles_Enable();
+    TWheel_Init(&ButtonWheel, TimerCounterInst.BaseAddress);
+    ButtonConfig = XGpio_LookupConfig(BUTTON_BASEADDR);
+    Status = Button_Initialize(&PushButton, BUTTON_BASEADDR, &ButtonWheel,
+                               ButtonHandler, NULL);
+    if (Status != XST_SUCCESS) {
+        xil_printf("Button initialization failed, GPIO interrupt present?\r\n");
+        return XST_FAILURE;
+    }
+#elif DEMO_MODE == DEMO_MODE_PWM
+    PwmSweep(TimerCounterInst.BaseAddress,
+             TimerCounterInst.Config.SysClockFreqHz);
+#elif DEMO_MODE == DEMO_MODE_MMU
+    Cycles_Enable();
+    BenchMemcpy();
+    BenchMmio(TimerCounterInst.BaseAddress);
+#elif DEMO_MODE == DEMO_MODE_CAPTURE
+    StampIntervals_Init(&CaptureIntervals);
+    StampIntervals_Init(&IsrIntervals);
+    LatencyHist_Init(&IsrStampError, 16U);
+    StampsValid = FALSE;
+    Capture_Initialize(&EdgeCapture, TimerCounterInst.BaseAddress,
+                       TIMER_CNTR_0);
+#elif DEMO_MODE == DEMO_MODE_AMP
+    AmpMailbox_Init(&TimerMailbox);
+    LatencyHist_Init(&AmpLatency[0], 16U);
+    LatencyHist_Init(&AmpLatency[1], 16U);
+    TimerOnCore1 = FALSE;
+    Status = Amp_StartCore1(Core1Setup, NULL);
+    if (Status != XST_SUCCESS) {
+        xil_printf("Core 1 did not start\r\n");
+        return XST_FAILURE;
+    }
+    xil_printf("Core 1 up (MPIDR Aff0 %d), mailbox at 0x%08X\r\n",
+               (int)Core1Id, (u32)(UINTPTR)&TimerMailbox);
+#elif DEMO_MODE == DEMO_MODE_FIQ
+    LatencyHist_Init(&FiqLatency[0], 16U);
+    LatencyHist_Init(&FiqLatency[1], 16U);
+    FastTmr_Initialize(&FastTimerFiq, TimerCounterInst.BaseAddress,
+                       TimerFiqTick, NULL);
+    TimerOnFiq = FALSE;
+#elif DEMO_MODE == DEMO_MODE_STORM
+    FastTmr_Initialize(&StormTimer, TimerCounterInst.BaseAddress, StormTick,
+                       NULL);
+    IrqRate_Initialize(&TimerRate, TimerCounterInst.Config.IntrId,
+                       TimerCounterInst.Config.IntrParent,
+                       FastTmr_InterruptHandler, &StormTimer,
+                       STORM_WINDOW_US, STORM_LIMIT);
+#elif DEMO_MODE == DEMO_MODE_NEST
+    if (NestInit() != XST_SUCCESS) {
+        xil_printf("GPIO initialization failed\r\n");
+        return XST_FAILURE;
+    }
+#elif DEMO_MODE == DEMO_MODE_EVTQ
+    EvtQ_Init(&AppEvents);
+    EdgeGpioConfig = XGpio_LookupConfig(EDGE_GPIO_BASEADDR);
+    Status = XGpio_Initialize(&EdgeGpio, EDGE_GPIO_BASEADDR);
+    if ((Status != XST_SUCCESS) || (EdgeGpioConfig == NULL)) {
+        xil_printf("GPIO initialization failed\r\n");
+        return XST_FAILURE;
+    }
+    XGpio_SetDataDirection(&EdgeGpio, EDGE_GPIO_CHANNEL, 0x1U);
+    XGpio_InterruptDisable(&EdgeGpio, XGPIO_IR_MASK);
+#endif
+
     /*
      * Connect the timer counter to the interrupt subsystem such that
      * interrupts can occur. Use XSetupInterruptSystem for SDT platforms.
      */
+#if DEMO_MODE == DEMO_MODE_LATENCY
+    Status = XSetupInterruptSystem(&TimerCounterInst,
+                                   (XInterruptHandler)TimerLatencyProbe,
+#elif DEMO_MODE == DEMO_MODE_FASTPATH
+    Status = XSetupInterruptSystem(&TimerCounterInst,
+                                   (XInterruptHandler)TimerIsrCompare,
+#elif DEMO_MODE == DEMO_MODE_COLDISR
+    Status = XSetupInterruptSystem(&TimerCounterInst,
+                                   (XInterruptHandler)TimerCacheProbe,
+#elif DEMO_MODE == DEMO_MODE_CAPTURE
+    Status = XSetupInterruptSystem(&TimerCounterInst,
+                                   (XInterruptHandler)TimerCaptureProbe,
+#elif DEMO_MODE == DEMO_MODE_AMP
+    Status = XSetupInterruptSystem(&TimerCounterInst,
+                                   (XInterruptHandler)TimerAmpProbe,
+#elif DEMO_MODE == DEMO_MODE_EVTQ
+    Status = XSetupInterruptSystem(&TimerCounterInst,
+                                   (XInterruptHandler)TimerEvtQProbe,
+#elif DEMO_MODE == DEMO_MODE_FIQ
+    Status = XSetupInterruptSystem(&TimerCounterInst,
+                                   (XInterruptHandler)TimerIrqPhaseProbe,
+#elif DEMO_MODE == DEMO_MODE_STORM
+    Status = XSetupInterruptSystem(&TimerRate,
+                                   (XInterruptHandler)IrqRate_InterruptHandler,
+#elif DEMO_MODE == DEMO_MODE_NEST
+    Status = XSetupInterruptSystem(&TimerNest,
+                                   (XInterruptHandler)IrqNest_InterruptHandler,
+#elif DEMO_MODE == DEMO_MODE_TWHEEL
+    Status = XSetupInterruptSystem(&TimerWheel,
+                                   (XInterruptHandler)TWheel_InterruptHandler,
+#elif DEMO_MODE == DEMO_MODE_BUTTON
+    Status = XSetupInterruptSystem(&ButtonWheel,
+                                   (XInterruptHandler)TWheel_InterruptHandler,
+#elif DEMO_MODE == DEMO_MODE_DEADLINE
+    Status = XSetupInterruptSystem(&DeadlineTimer,
+                                   (XInterruptHandler)DlTimer_InterruptHandler,
+#elif DEMO_MODE == DEMO_MODE_CLOCK64
+    Status = XSetupInterruptSystem(&SystemClock64,
+                                   (XInterruptHandler)Clock64_InterruptHandler,
+#else
     Status = XSetupInterruptSystem(&TimerCounterInst, 
                                    (XInterruptHandler)XTmrCtr_InterruptHandler,
+#endif
                                    TimerCounterInst.Config.IntrId, 
                                    TimerCounterInst.Config.IntrParent,
-                                   XINTERRUPT_DEFAULT_PRIORITY);
+                                   TIMER_PRIORITY);
     if (Status != XST_SUCCESS) {
         xil_printf("Interrupt system setup failed\r\n");
         return XST_FAILURE;
@@ -130,6 +1464,85 @@ int main(void)
                        &TimerCounterInst);
     xil_printf("Timer handler registered\r\n");
 
+#if DEMO_MODE == DEMO_MODE_EVTQ
+    Status = XSetupInterruptSystem(&EdgeGpio,
+                                   (XInterruptHandler)EdgeGpioHandler,
+                                   EdgeGpioConfig->IntrId,
+                                   EdgeGpioConfig->IntrParent,
+                                   XINTERRUPT_DEFAULT_PRIORITY);
+    if (Status != XST_SUCCESS) {
+        xil_printf("GPIO interrupt setup failed\r\n");
+        return XST_FAILURE;
+    }
+    XGpio_InterruptClear(&EdgeGpio, XGPIO_IR_CH1_MASK);
+    XGpio_InterruptEnable(&EdgeGpio, XGPIO_IR_CH1_MASK);
+    XGpio_InterruptGlobalEnable(&EdgeGpio);
+    xil_printf("Event queue: %d slots, timer and GPIO IRQ %d posting\r\n",
+               (int)EVTQ_DEPTH, (int)EdgeGpioConfig->IntrId);
+#endif
+
+#if DEMO_MODE == DEMO_MODE_NEST
+    Status = XSetupInterruptSystem(&GpioNest,
+                                   (XInterruptHandler)IrqNest_InterruptHandler,
+                                   NestGpioConfig->IntrId,
+                                   NestGpioConfig->IntrParent,
+                                   XINTERRUPT_DEFAULT_PRIORITY);
+    if (Status != XST_SUCCESS) {
+        xil_printf("GPIO interrupt setup failed\r\n");
+        return XST_FAILURE;
+    }
+    XGpio_InterruptClear(&NestGpio, XGPIO_IR_CH1_MASK);
+    XGpio_InterruptEnable(&NestGpio, XGPIO_IR_CH1_MASK);
+    XGpio_InterruptGlobalEnable(&NestGpio);
+    xil_printf("Timer at priority 0x%02X, GPIO IRQ %d at 0x%02X with a %d us"
+               " handler - press the button during the run\r\n",
+               TIMER_PRIORITY, (int)NestGpioConfig->IntrId,
+               XINTERRUPT_DEFAULT_PRIORITY, (int)NEST_SLOW_US);
+#endif
+
+#if DEMO_MODE == DEMO_MODE_TWHEEL
+    /*
+     * The wheel owns the counter and loads it one-shot for the nearest
+     * deadline, the driver options below do not apply
+     */
+    StartTimerWheel();
+    xil_printf("Timer wheel started (%d timers, %d us tick)\r\n",
+               WHEEL_LOAD_TIMERS + 5, TWHEEL_TICK_CYCLES / 100U);
+#elif DEMO_MODE == DEMO_MODE_BUTTON
+    /*
+     * The wheel owns the counter as in DEMO_MODE_TWHEEL. The button
+     * interrupt comes in on its own line (pl_ps_irq1).
+     */
+    Status = XSetupInterruptSystem(&PushButton,
+                                   (XInterruptHandler)Button_InterruptHandler,
+                                   ButtonConfig->IntrId,
+                                   ButtonConfig->IntrParent,
+                                   XINTERRUPT_DEFAULT_PRIORITY);
+    if (Status != XST_SUCCESS) {
+        xil_printf("Button interrupt setup failed\r\n");
+        return XST_FAILURE;
+    }
+    Button_Start(&PushButton);
+    xil_printf("Button armed (IRQ %d, %d ms debounce, %d cycles per poll)"
+               " - press it %d times\r\n", (int)ButtonConfig->IntrId,
+               (int)BUTTON_DEBOUNCE_MS, (int)PushButton.PollCycles, IRQ_COUNT);
+#elif DEMO_MODE == DEMO_MODE_DEADLINE
+    /*
+     * Auto-reload with TLR written one interval ahead, see deadline.h
+     */
+    DlTimer_Initialize(&DeadlineTimer, TimerCounterInst.BaseAddress,
+                       TimerCounterInst.Config.SysClockFreqHz,
+                       DeadlineHandler, NULL);
+    DlTimer_Start(&DeadlineTimer, RESET_VALUE);
+    xil_printf("Deadline timer started (%d us period)\r\n", RESET_VALUE / 100U);
+#elif DEMO_MODE == DEMO_MODE_CLOCK64
+    Clock64_Initialize(&SystemClock64, TimerCounterInst.BaseAddress,
+                       TimerCounterInst.Config.SysClockFreqHz,
+                       Clock64Handler, NULL);
+    Clock64_Start(&SystemClock64, ((u64)1U << 32) - CLOCK64_LEAD);
+    xil_printf("64-bit clock started, rollover in %d ms\r\n",
+               (int)(CLOCK64_LEAD / 100000U));
+#else
     /*
      * Enable the interrupt of the timer counter so interrupts will occur
      * and use auto reload mode such that the timer counter will reload
@@ -145,18 +1558,25 @@ int main(void)
      * earlier than letting it roll over from 0
      */
     XTmrCtr_SetResetValue(&TimerCounterInst, TmrCtrNumber, RESET_VALUE);
-    xil_printf("Timer reset value set to 0x%08X (~1 sec @ 100 MHz)\r\n", RESET_VALUE);
+    xil_printf("Timer reset value set to 0x%08X (%d us @ 100 MHz)\r\n",
+               RESET_VALUE, RESET_VALUE / 100U);
 
     /*
      * Start the timer counter
      */
     XTmrCtr_Start(&TimerCounterInst, TmrCtrNumber);
+#if DEMO_MODE == DEMO_MODE_CAPTURE
+    /* Not before the interrupt is set up, or the first edge is stale */
+    Capture_Start(&EdgeCapture);
+#endif
+#endif
     xil_printf("Timer started - waiting for interrupts...\r\n");
     
     /* Debug: Check if timer is actually running */
     u32 tcr = XTmrCtr_GetOptions(&TimerCounterInst, TmrCtrNumber);
     xil_printf("Timer Control Register: 0x%08X\r\n", tcr);
-    xil_printf("Timer Base Address: 0x%08X\r\n", TimerCounterInst.BaseAddress);
+    xil_printf("Timer Base Address: 0x%08X\r\n",
+               (u32)TimerCounterInst.BaseAddress);
     
     /* Read actual hardware registers for debugging */
     u32 tcsr0 = XTmrCtr_ReadReg(TimerCounterInst.BaseAddress, 0, XTC_TCSR_OFFSET);
@@ -181,26 +1601,147 @@ int main(void)
     }
     xil_printf("\r\n");
 
+#if DEMO_MODE == DEMO_MODE_CLOCK64
+    CheckClock64();
+#endif
+
+#if DEMO_MODE == DEMO_MODE_AMP
+    /* Start clean: the mailbox filled up during the checks above */
+    Xil_ExceptionDisable();
+    AmpMailbox_Init(&TimerMailbox);
+    Xil_ExceptionEnable();
+#endif
+
+#if DEMO_MODE == DEMO_MODE_EVTQ
+    /* Count from here: the queue overflowed during the checks above */
+    Xil_ExceptionDisable();
+    EvtQ_Init(&AppEvents);
+    TimerPosts = 0;
+    EdgePosts = 0;
+    Xil_ExceptionEnable();
+#endif
+
     /* --------------------------------------------------------
-     * Main loop - Wait for timer to expire 10 times
+     * Main loop - Wait for timer to expire IRQ_COUNT times
      * -------------------------------------------------------- */
     while (1) {
         /*
          * Wait for the timer counter to expire as indicated by the
          * shared variable which the handler will increment
          */
-        while (TimerExpired == LastTimerExpired) {
-            /* Busy wait for interrupt */
+#if DEMO_MODE == DEMO_MODE_IDLE
+        {
+            IdlePolicy Policy = (IdlePolicy)(LastTimerExpired / IDLE_PHASE_IRQS);
+            u32 Iterations;
+            u32 Tcr;
+
+            if (Policy >= IDLE_NUM_POLICIES) {
+                Policy = IDLE_NUM_POLICIES - 1;
+            }
+            Iterations = Idle_WaitForChange(Policy, &TimerExpired,
+                                            LastTimerExpired);
+            /* Cycles since the counter reloaded = expiry-to-wake latency */
+            Tcr = XTmrCtr_ReadReg(TimerCounterInst.BaseAddress, TmrCtrNumber,
+                                  XTC_TCR_OFFSET);
+            LatencyHist_Record(&WakeLatency[Policy], RESET_VALUE - Tcr);
+            IdleIterations[Policy] += Iterations;
         }
+#elif DEMO_MODE == DEMO_MODE_CAPTURE
+        MaskedLoad(&TimerExpired, LastTimerExpired);
+#elif DEMO_MODE == DEMO_MODE_AMP
+        MaskedLoad(&TimerExpired, LastTimerExpired);
+        AmpDrain();
+#elif DEMO_MODE == DEMO_MODE_FIQ
+        MaskedLoad(&TimerExpired, LastTimerExpired);
+#elif DEMO_MODE == DEMO_MODE_EVTQ
+        EvtQWork();
+#elif DEMO_MODE == DEMO_MODE_STORM
+        StormRun((u32)LastTimerExpired);
+        TimerExpired++;
+#else
+#if DEMO_MODE == DEMO_MODE_COLDISR
+        PrepareCaches(LastTimerExpired);
+#endif
+        Idle_WaitForChange(IDLE_POLICY, &TimerExpired, LastTimerExpired);
+#endif
         LastTimerExpired = TimerExpired;
 
+#if DEMO_MODE == DEMO_MODE_DEADLINE
+        /* Halve the period for the middle third of the run, the
+         * deadline phase must carry through both changes
+         */
+        if ((LastTimerExpired >= (IRQ_COUNT / 3)) &&
+            (LastTimerExpired < (2 * IRQ_COUNT / 3))) {
+            DlTimer_SetPeriod(&DeadlineTimer, RESET_VALUE / 2U);
+        } else {
+            DlTimer_SetPeriod(&DeadlineTimer, RESET_VALUE);
+        }
+#endif
+
+#if DEMO_MODE == DEMO_MODE_EVTQ
+        EvtQStall(LastTimerExpired);
+#endif
+
+#if DEMO_MODE == DEMO_MODE_NEST
+        NestSetPhase(LastTimerExpired);
+#endif
+
+#if DEMO_MODE == DEMO_MODE_FIQ
+        /* Second half: off the IRQ path, onto FIQ */
+        if (!TimerOnFiq && (LastTimerExpired >= (IRQ_COUNT / 2))) {
+            XDisconnectInterruptCntrl(TimerCounterInst.Config.IntrId,
+                                      TimerCounterInst.Config.IntrParent);
+            Status = Fiq_Route(TimerCounterInst.Config.IntrId,
+                               TimerFiqProbe, &FastTimerFiq);
+            if (Status != XST_SUCCESS) {
+                xil_printf("FIQ routing failed\r\n");
+                return XST_FAILURE;
+            }
+            TimerOnFiq = TRUE;
+        }
+#endif
+
+#if DEMO_MODE == DEMO_MODE_AMP
+        /* Second half: core 1 owns the timer, core 0 only gets mail */
+        if (!TimerOnCore1 && (LastTimerExpired >= (IRQ_COUNT / 2))) {
+            IrqAffinity_Set(TimerCounterInst.Config.IntrId,
+                            IRQ_AFFINITY_CPU(1));
+            TimerOnCore1 = TRUE;
+        }
+#endif
+
+        /* Print whatever the ISR has logged since the last pass */
+        IsrLog_Drain(&TimerLog);
+
         /*
-         * If it has expired 10 times, stop the timer counter
+         * If it has expired IRQ_COUNT times, stop the timer counter
          * and exit the example
          */
-        if (TimerExpired == 10) {
+        if (TimerExpired >= IRQ_COUNT) {
+#if DEMO_MODE == DEMO_MODE_TWHEEL
+            StopTimerWheel();
+#elif DEMO_MODE == DEMO_MODE_BUTTON
+            Button_Stop(&PushButton);
+            XDisconnectInterruptCntrl(ButtonConfig->IntrId,
+                                      ButtonConfig->IntrParent);
+#elif DEMO_MODE == DEMO_MODE_DEADLINE
+            DlTimer_Stop(&DeadlineTimer);
+#elif DEMO_MODE == DEMO_MODE_CAPTURE
+            Capture_Stop(&EdgeCapture);
+#elif DEMO_MODE == DEMO_MODE_FIQ
+            Fiq_Unroute(TimerCounterInst.Config.IntrId);
+#elif DEMO_MODE == DEMO_MODE_NEST
+            XGpio_InterruptGlobalDisable(&NestGpio);
+            XDisconnectInterruptCntrl(NestGpioConfig->IntrId,
+                                      NestGpioConfig->IntrParent);
+            NestTakeCounts(NestPhaseNow);
+#elif DEMO_MODE == DEMO_MODE_EVTQ
+            XGpio_InterruptGlobalDisable(&EdgeGpio);
+            XDisconnectInterruptCntrl(EdgeGpioConfig->IntrId,
+                                      EdgeGpioConfig->IntrParent);
+#endif
             XTmrCtr_Stop(&TimerCounterInst, TmrCtrNumber);
-            xil_printf("\r\nTimer stopped after 10 interrupts\r\n");
+            xil_printf("\r\nTimer stopped after %d interrupts\r\n", IRQ_COUNT);
             break;
         }
     }
@@ -209,6 +1750,172 @@ int main(void)
     XDisconnectInterruptCntrl(TimerCounterInst.Config.IntrId, 
                               TimerCounterInst.Config.IntrParent);
 
+#if DEMO_MODE == DEMO_MODE_LATENCY
+    LatencyHist_Report(&IrqLatency, "Timer IRQ",
+                       TimerCounterInst.Config.SysClockFreqHz);
+#elif DEMO_MODE == DEMO_MODE_FASTPATH
+    LatencyHist_Report(&StockIsrCycles, "Stock driver ISR", CYCLES_PER_SECOND);
+#ifdef HOST_SIM
+    AxiReport(&StockAxi);
+#endif
+    LatencyHist_Report(&FastIsrCycles, "Fast-path ISR", CYCLES_PER_SECOND);
+#ifdef HOST_SIM
+    AxiReport(&FastAxi);
+#endif
+    if ((StockIsrCycles.Count != 0) && (FastIsrCycles.Count != 0)) {
+        u32 Saved = (u32)(StockIsrCycles.Sum / StockIsrCycles.Count) -
+                    (u32)(FastIsrCycles.Sum / FastIsrCycles.Count);
+        xil_printf("Fast path saves %d cycles (%d ns) per interrupt\r\n",
+                   (int)Saved,
+                   (int)(((u64)Saved * 1000000000U) / CYCLES_PER_SECOND));
+    }
+#elif DEMO_MODE == DEMO_MODE_COLDISR
+    xil_printf("Interrupt path in %s\r\n",
+               FastMem_InOcm((UINTPTR)TimerCounterHandler) ? "OCM" : "DDR");
+    LatencyHist_Report(&ColdLatency, "Cold-cache IRQ",
+                       TimerCounterInst.Config.SysClockFreqHz);
+    LatencyHist_Report(&WarmLatency, "Warm-cache IRQ",
+                       TimerCounterInst.Config.SysClockFreqHz);
+    LatencyHist_Report(&ColdIsrCycles, "Cold-cache ISR", CYCLES_PER_SECOND);
+    LatencyHist_Report(&WarmIsrCycles, "Warm-cache ISR", CYCLES_PER_SECOND);
+#ifdef HOST_SIM
+    /* The register model has no caches to flush: cold and warm differ
+     * only by where the model's events fell */
+    xil_printf("Cold-cache cost not meaningful on the host model\r\n");
+#else
+    if ((ColdIsrCycles.Count != 0) && (WarmIsrCycles.Count != 0)) {
+        s32 Cost = (s32)(ColdIsrCycles.Sum / ColdIsrCycles.Count) -
+                   (s32)(WarmIsrCycles.Sum / WarmIsrCycles.Count);
+        if (Cost > 0) {
+            xil_printf("Cold caches cost %d cycles (%d ns) per ISR\r\n",
+                       (int)Cost,
+                       (int)(((s64)Cost * 1000000000) /
+                             (s64)CYCLES_PER_SECOND));
+        } else {
+            xil_printf("Cold caches cost nothing measurable per ISR"
+                       " (warm average %d cycles higher)\r\n", (int)-Cost);
+        }
+    }
+#endif
+#endif
+
+#if DEMO_MODE == DEMO_MODE_DEADLINE
+    DlTimer_Report(&DeadlineTimer);
+#endif
+
+#if DEMO_MODE == DEMO_MODE_FIQ
+    LatencyHist_Report(&FiqLatency[0], "Timer on IRQ",
+                       TimerCounterInst.Config.SysClockFreqHz);
+    LatencyHist_Report(&FiqLatency[1], "Timer on FIQ",
+                       TimerCounterInst.Config.SysClockFreqHz);
+    if ((FiqLatency[0].Count != 0) && (FiqLatency[1].Count != 0)) {
+        xil_printf("Jitter (max - min): IRQ %d cycles, FIQ %d cycles;"
+                   " %d spurious FIQ entries\r\n",
+                   (int)(FiqLatency[0].Max - FiqLatency[0].Min),
+                   (int)(FiqLatency[1].Max - FiqLatency[1].Min),
+                   (int)FastTimerFiq.Spurious);
+    }
+#endif
+
+#if DEMO_MODE == DEMO_MODE_NEST
+    NestReport();
+#endif
+
+#if DEMO_MODE == DEMO_MODE_STORM
+    IrqRate_Report(&TimerRate, "Timer rate guard");
+    for (u32 i = 0; i < IRQ_COUNT; i++) {
+        xil_printf("  reload %6d: %5d expiries, %5d us in the handler,"
+                   " %2d trips, disabled %4d ms; main loop %d passes\r\n",
+                   (int)StormReload[i], (int)StormPhases[i].Expiries,
+                   (int)StormPhases[i].HandlerUs, (int)StormPhases[i].Trips,
+                   (int)StormPhases[i].ThrottledMs,
+                   (int)StormPhases[i].Passes);
+    }
+    if (StormPhases[0].Passes != 0) {
+        xil_printf("Main loop kept %d%% of its passes through the storm\r\n",
+                   (int)(((u64)StormPhases[1].Passes * 100U) /
+                         StormPhases[0].Passes));
+    }
+#endif
+
+#if DEMO_MODE == DEMO_MODE_EVTQ
+    EvtQDrainAll();
+    xil_printf("\r\n--- Event queue (%d slots, batches of up to %d) ---\r\n",
+               (int)EVTQ_DEPTH, (int)EVTQ_BATCH);
+    xil_printf("  timer  %d of %d posted, %d missing from the sequence\r\n",
+               (int)TimerEvents, (int)TimerPosts, (int)TimerSeqGaps);
+    xil_printf("  edges  %d of %d posted\r\n", (int)EdgeEvents,
+               (int)EdgePosts);
+    xil_printf("  refused %d (queue full), high water %d\r\n",
+               (int)EvtRefused, (int)AppEvents.HighWater);
+    for (u32 i = 1; i <= EVTQ_BATCH; i++) {
+        if (BatchSizes[i] != 0) {
+            xil_printf("  batches of %2d: %d\r\n", (int)i, (int)BatchSizes[i]);
+        }
+    }
+    if ((TimerEvents + EdgeEvents + EvtRefused) == (TimerPosts + EdgePosts)) {
+        xil_printf("Every event delivered or counted as refused\r\n");
+    } else {
+        xil_printf("ERROR: %d event(s) unaccounted for\r\n",
+                   (int)((TimerPosts + EdgePosts) -
+                         (TimerEvents + EdgeEvents + EvtRefused)));
+    }
+#endif
+
+#if DEMO_MODE == DEMO_MODE_AMP
+    AmpDrain();
+    LatencyHist_Report(&AmpLatency[0], "Timer IRQ on busy core 0",
+                       TimerCounterInst.Config.SysClockFreqHz);
+    LatencyHist_Report(&AmpLatency[1], "Timer IRQ on isolated core 1",
+                       TimerCounterInst.Config.SysClockFreqHz);
+    if ((AmpLatency[0].Count != 0) && (AmpLatency[1].Count != 0)) {
+        xil_printf("Jitter (max - min): core 0 %d cycles, core 1 %d cycles;"
+                   " %d messages dropped\r\n",
+                   (int)(AmpLatency[0].Max - AmpLatency[0].Min),
+                   (int)(AmpLatency[1].Max - AmpLatency[1].Min),
+                   (int)TimerMailbox.Dropped);
+    }
+#endif
+
+#if DEMO_MODE == DEMO_MODE_CAPTURE
+    xil_printf("\r\n--- capture_in timestamps, %d captured ---\r\n",
+               (int)EdgeCapture.Captures);
+    if (EdgeCapture.Captures == 0) {
+        xil_printf("  No edges: is a signal on capture_in? See README\r\n");
+    }
+    StampIntervals_Report(&CaptureIntervals, "capture (TLR0)",
+                          TimerCounterInst.Config.SysClockFreqHz);
+    StampIntervals_Report(&IsrIntervals, "ISR (TCR0)    ",
+                          TimerCounterInst.Config.SysClockFreqHz);
+    LatencyHist_Report(&IsrStampError, "ISR timestamp error",
+                       TimerCounterInst.Config.SysClockFreqHz);
+#endif
+
+#if DEMO_MODE == DEMO_MODE_TWHEEL
+    IsrLog_Drain(&TimerLog);
+    xil_printf("Timer wheel: %d callbacks (%d load) in %d counter wakeups\r\n",
+               (int)TimerWheel.Fired, (int)LoadFires, (int)TimerWheel.Wakeups);
+#endif
+
+#if DEMO_MODE == DEMO_MODE_BUTTON
+    IsrLog_Drain(&TimerLog);
+    Button_Report(&PushButton);
+    xil_printf("Timer wheel: %d debounce callbacks in %d counter wakeups\r\n",
+               (int)ButtonWheel.Fired, (int)ButtonWheel.Wakeups);
+#endif
+
+#if DEMO_MODE == DEMO_MODE_IDLE
+    for (int i = 0; i < IDLE_NUM_POLICIES; i++) {
+        LatencyHist_Report(&WakeLatency[i], Idle_PolicyName((IdlePolicy)i),
+                           TimerCounterInst.Config.SysClockFreqHz);
+        if (WakeLatency[i].Count != 0) {
+            xil_printf("  %d loop iterations per interrupt\r\n",
+                       (int)(IdleIterations[i] / WakeLatency[i].Count));
+        }
+    }
+#endif
+
     xil_printf("Successfully ran Timer interrupt Example\r\n");
+    cleanup_platform();
     return XST_SUCCESS;
 }
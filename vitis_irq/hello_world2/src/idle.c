@@ -0,0 +1,83 @@
+/******************************************************************************
+ * Main loop idle policies - see idle.h
+ ******************************************************************************/
+
+#include "idle.h"
+#include "xil_exception.h"
+#include "xpseudo_asm.h"
+#include "fast_mem.h"
+
+/* ------------------------------------------------------------
+ * Block until *CounterPtr differs from Last, which the ISR bumps.
+ * Returns the number of times the loop went around, i.e. how many
+ * polls (SPIN) or wake-ups (WFE/WFI) it took.
+ * ------------------------------------------------------------ */
+u32 Idle_WaitForChange(IdlePolicy Policy, volatile int *CounterPtr, int Last)
+{
+    u32 Iterations = 0;
+
+    switch (Policy) {
+    case IDLE_WFI:
+        /*
+         * Check and sleep with IRQs masked: a pending IRQ still wakes
+         * WFI, and it is taken as soon as the mask is dropped. Without
+         * this an IRQ landing between the check and WFI would be
+         * missed until the next one.
+         */
+        while (1) {
+            Xil_ExceptionDisable();
+            if (*CounterPtr != Last) {
+                Xil_ExceptionEnable();
+                break;
+            }
+            dsb();
+            wfi();
+            Xil_ExceptionEnable();
+            Iterations++;
+        }
+        break;
+
+    case IDLE_WFE:
+        /* A SEV between the check and WFE leaves the event register
+         * set, so WFE returns at once and nothing is lost.
+         */
+        while (*CounterPtr == Last) {
+            wfe();
+            Iterations++;
+        }
+        break;
+
+    case IDLE_SPIN:
+    default:
+        while (*CounterPtr == Last) {
+            Iterations++;
+        }
+        break;
+    }
+
+    return Iterations;
+}
+
+/* ------------------------------------------------------------
+ * Call from the ISR after updating the shared state, to wake a
+ * main loop parked in WFE
+ * ------------------------------------------------------------ */
+FAST_TEXT void Idle_Signal(void)
+{
+    dsb();
+    sev();
+}
+
+const char *Idle_PolicyName(IdlePolicy Policy)
+{
+    switch (Policy) {
+    case IDLE_SPIN:
+        return "busy-spin";
+    case IDLE_WFE:
+        return "WFE/SEV";
+    case IDLE_WFI:
+        return "WFI";
+    default:
+        return "?";
+    }
+}
@@ -0,0 +1,33 @@
+/******************************************************************************
+ * Main loop idle policies
+ *
+ *   IDLE_SPIN - poll the shared counter (original behavior, burns a core)
+ *   IDLE_WFE  - wait for event, the ISR wakes the core with SEV
+ *   IDLE_WFI  - wait for interrupt, the core is clock gated until an IRQ
+ *               is pending
+ ******************************************************************************/
+
+#ifndef IDLE_H_
+#define IDLE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+typedef enum {
+    IDLE_SPIN = 0,
+    IDLE_WFE,
+    IDLE_WFI,
+    IDLE_NUM_POLICIES
+} IdlePolicy;
+
+u32 Idle_WaitForChange(IdlePolicy Policy, volatile int *CounterPtr, int Last);
+void Idle_Signal(void);
+const char *Idle_PolicyName(IdlePolicy Policy);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
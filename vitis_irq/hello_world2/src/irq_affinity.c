@@ -0,0 +1,63 @@
+/******************************************************************************
+ * Interrupt CPU affinity on the GIC-400 distributor - see irq_affinity.h
+ ******************************************************************************/
+
+#include "irq_affinity.h"
+#include "xparameters.h"
+#include "xinterrupt_wrap.h"
+#include "xpseudo_asm.h"
+#include "xil_io.h"
+#include "xstatus.h"
+
+#define GICD_ITARGETSR      0x800U
+#define GIC_FIRST_SPI       32U
+#define GIC_MAX_ID          1019U
+
+#define MPIDR_AFF0_MASK     0xFFU
+
+static u32 GicId(u32 IntrId)
+{
+    return XGet_IntrId(IntrId) + XGet_IntrOffset(IntrId);
+}
+
+static UINTPTR TargetReg(u32 Id)
+{
+    return XPAR_SCUGIC_0_DIST_BASEADDR + GICD_ITARGETSR + (Id & ~3U);
+}
+
+/* ------------------------------------------------------------
+ * Send IntrId to the cores in CpuMask (IRQ_AFFINITY_CPU(n) bits).
+ * Takes effect for the next time the interrupt is signalled.
+ * ------------------------------------------------------------ */
+int IrqAffinity_Set(u32 IntrId, u8 CpuMask)
+{
+    u32 Id = GicId(IntrId);
+    u32 Shift = (Id & 3U) * 8U;
+    u32 Targets;
+
+    if ((Id < GIC_FIRST_SPI) || (Id > GIC_MAX_ID) || (CpuMask == 0) ||
+        (CpuMask >= (1U << IRQ_AFFINITY_NUM_CPUS))) {
+        return XST_INVALID_PARAM;
+    }
+
+    Targets = Xil_In32(TargetReg(Id));
+    Targets &= ~(0xFFU << Shift);
+    Targets |= (u32)CpuMask << Shift;
+    Xil_Out32(TargetReg(Id), Targets);
+    return XST_SUCCESS;
+}
+
+u8 IrqAffinity_Get(u32 IntrId)
+{
+    u32 Id = GicId(IntrId);
+
+    return (u8)(Xil_In32(TargetReg(Id)) >> ((Id & 3U) * 8U));
+}
+
+/* ------------------------------------------------------------
+ * Core this code runs on, MPIDR_EL1.Aff0
+ * ------------------------------------------------------------ */
+u32 IrqAffinity_CpuId(void)
+{
+    return (u32)(mfcp(MPIDR_EL1) & MPIDR_AFF0_MASK);
+}
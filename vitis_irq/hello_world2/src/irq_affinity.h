@@ -0,0 +1,37 @@
+/******************************************************************************
+ * Interrupt CPU affinity on the GIC-400 distributor
+ *
+ * Every shared peripheral interrupt has a byte in GICD_ITARGETSR with
+ * one bit per CPU interface. The distributor sends the interrupt to
+ * one of the cores whose bit is set. SGIs and PPIs are banked per core
+ * and their targets are read-only.
+ *
+ * The interrupt ID is the one the driver configuration carries
+ * (Config.IntrId) and XSetupInterruptSystem() takes. It is converted
+ * to a GIC ID the way the SDT wrapper converts it.
+ *
+ * XScuGic_Enable() maps a source to the core that enables it, so set
+ * the affinity after XSetupInterruptSystem() / XEnableIntrId(). The
+ * word is read-modify-written: only one core may change affinities.
+ ******************************************************************************/
+
+#ifndef IRQ_AFFINITY_H_
+#define IRQ_AFFINITY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+#define IRQ_AFFINITY_NUM_CPUS   4U
+#define IRQ_AFFINITY_CPU(Cpu)   ((u8)(1U << (Cpu)))
+
+int IrqAffinity_Set(u32 IntrId, u8 CpuMask);
+u8 IrqAffinity_Get(u32 IntrId);
+u32 IrqAffinity_CpuId(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
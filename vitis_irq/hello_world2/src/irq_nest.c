@@ -0,0 +1,108 @@
+/******************************************************************************
+ * Nested, priority-preemptive interrupt handlers - see irq_nest.h
+ ******************************************************************************/
+
+#include "irq_nest.h"
+#include "irq_affinity.h"
+#include "xparameters.h"
+#include "xil_exception.h"
+#include "xil_io.h"
+#include "xpseudo_asm.h"
+#include "xtime_l.h"
+#include "fast_mem.h"
+
+/* GIC-400 CPU interface, banked per core */
+#define GICC_PMR            (XPAR_SCUGIC_0_CPU_BASEADDR + 0x04U)
+#define GICC_PMR_MASK_ALL   0x00U       /* No priority is above it */
+
+#define COUNTS_PER_US       (COUNTS_PER_SECOND / 1000000U)
+
+/* Innermost handler running on each core */
+static IrqNestSource *Running[IRQ_NEST_NUM_CPUS] FAST_DATA;
+
+static u64 BudgetCounts(u32 BudgetUs)
+{
+    return (BudgetUs == IRQ_NEST_UNLIMITED) ? ~(u64)0 :
+           (u64)BudgetUs * COUNTS_PER_US;
+}
+
+/* ------------------------------------------------------------
+ * Bind Handler(CallBackRef) to a source that may be preempted
+ * for BudgetUs per run (IRQ_NEST_UNLIMITED, or 0 for never)
+ * ------------------------------------------------------------ */
+void IrqNest_Initialize(IrqNestSource *SourcePtr, IrqNest_Handler Handler,
+                        void *CallBackRef, u32 BudgetUs)
+{
+    SourcePtr->Handler = Handler;
+    SourcePtr->CallBackRef = CallBackRef;
+    SourcePtr->BudgetCycles = BudgetCounts(BudgetUs);
+    SourcePtr->Outer = NULL;
+    SourcePtr->Preempted = 0;
+    SourcePtr->Masked = 0;
+    SourcePtr->SavedPmr = 0;
+    SourcePtr->Runs = 0;
+    SourcePtr->Preemptions = 0;
+    SourcePtr->BudgetSpent = 0;
+    SourcePtr->MaxPreempted = 0;
+}
+
+/* Takes effect from the next run */
+void IrqNest_SetBudget(IrqNestSource *SourcePtr, u32 BudgetUs)
+{
+    __atomic_store_n(&SourcePtr->BudgetCycles, BudgetCounts(BudgetUs),
+                     __ATOMIC_RELAXED);
+}
+
+/* ------------------------------------------------------------
+ * Interrupt handler to pass to XSetupInterruptSystem(). Called
+ * by XScuGic_InterruptHandler() between acknowledge and EOI.
+ * ------------------------------------------------------------ */
+FAST_TEXT void IrqNest_InterruptHandler(void *InstancePtr)
+{
+    IrqNestSource *SourcePtr = (IrqNestSource *)InstancePtr;
+    u32 Cpu = IrqAffinity_CpuId();
+    IrqNestSource *OuterPtr = Running[Cpu];
+    u64 Elr = mfcp(ELR_EL3);
+    u64 Spsr = mfcp(SPSR_EL3);
+    XTime Start;
+    XTime End;
+
+    XTime_GetTime(&Start);
+    SourcePtr->Outer = OuterPtr;
+    SourcePtr->Preempted = 0;
+    SourcePtr->Masked = 0;
+    SourcePtr->Runs++;
+    Running[Cpu] = SourcePtr;
+
+    if (__atomic_load_n(&SourcePtr->BudgetCycles, __ATOMIC_RELAXED) != 0) {
+        Xil_ExceptionEnable();
+    }
+    SourcePtr->Handler(SourcePtr->CallBackRef);
+    Xil_ExceptionDisable();
+
+    Running[Cpu] = OuterPtr;
+    if (SourcePtr->Masked) {
+        Xil_Out32(GICC_PMR, SourcePtr->SavedPmr);
+    }
+    if (SourcePtr->Preempted > SourcePtr->MaxPreempted) {
+        SourcePtr->MaxPreempted = SourcePtr->Preempted;
+    }
+
+    /* Charge this run to the handler it preempted. With its budget
+     * spent, the mask keeps everything out until that handler ends. */
+    if (OuterPtr != NULL) {
+        XTime_GetTime(&End);
+        OuterPtr->Preemptions++;
+        OuterPtr->Preempted += End - Start;
+        if ((OuterPtr->Preempted >= OuterPtr->BudgetCycles) &&
+            !OuterPtr->Masked) {
+            OuterPtr->SavedPmr = Xil_In32(GICC_PMR);
+            Xil_Out32(GICC_PMR, GICC_PMR_MASK_ALL);
+            OuterPtr->Masked = 1;
+            OuterPtr->BudgetSpent++;
+        }
+    }
+
+    mtcp(ELR_EL3, Elr);
+    mtcp(SPSR_EL3, Spsr);
+}
@@ -0,0 +1,78 @@
+/******************************************************************************
+ * Nested, priority-preemptive interrupt handlers
+ *
+ * XScuGic_InterruptHandler() acknowledges an interrupt, calls its
+ * handler with IRQ masked and writes EOIR when it returns. Register
+ * IrqNest_InterruptHandler() with an IrqNestSource instead of the
+ * driver handler, and give each source its priority through the
+ * Priority argument of XSetupInterruptSystem(). The dispatcher then
+ * does the following:
+ *   - saves ELR_EL3 and SPSR_EL3, which a nested exception overwrites.
+ *     The BSP's IRQ vector keeps only x0-x30 and FPCR/FPSR.
+ *   - unmasks IRQ around the handler. The acknowledge raised the GIC
+ *     running priority to the source's priority, so only a strictly
+ *     higher one (lower value) preempts it.
+ *   - masks IRQ again and restores ELR_EL3 and SPSR_EL3
+ *
+ * The GIC-400 implements the top five priority bits (steps of 8) and
+ * the secure binary point leaves all five for preemption.
+ *
+ * Each source has a preemption budget: how long its handler may be
+ * held up by higher priority handlers in one run. The time a nested
+ * handler takes is charged to the one it preempted. Once a handler's
+ * budget is spent, the nested return sets GICC_PMR to mask every
+ * priority on that core, and the handler's own return puts it back,
+ * so the handler finishes its run without preemption. Its
+ * completion time is then bounded by its own run time plus the budget
+ * and one more nested handler. The mask holds Group 0 back as well.
+ * A budget of 0 keeps the handler masked throughout, as without this
+ * layer.
+ *
+ * Nested handlers share the EL3 stack, so size it for the deepest
+ * nesting. The BSP saves one FP context, so handlers that can preempt
+ * or be preempted must not use FP.
+ ******************************************************************************/
+
+#ifndef IRQ_NEST_H_
+#define IRQ_NEST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+#define IRQ_NEST_NUM_CPUS       4U
+
+/* Budget for a handler that may always be preempted */
+#define IRQ_NEST_UNLIMITED      0xFFFFFFFFU
+
+typedef void (*IrqNest_Handler)(void *CallBackRef);
+
+typedef struct IrqNestSource {
+    IrqNest_Handler Handler;
+    void *CallBackRef;
+    u64 BudgetCycles;   /* Global timer counts, 0: never preempted */
+
+    /* Current run */
+    struct IrqNestSource *Outer;    /* Handler this one preempted */
+    u64 Preempted;      /* Counts charged by nested handlers */
+    u32 SavedPmr;       /* GICC_PMR to restore when Masked */
+    u8 Masked;          /* Budget spent, GICC_PMR masks all */
+
+    /* Statistics */
+    u32 Runs;
+    u32 Preemptions;    /* Nested handlers run inside this one */
+    u32 BudgetSpent;    /* Runs finished masked */
+    u64 MaxPreempted;
+} IrqNestSource;
+
+void IrqNest_Initialize(IrqNestSource *SourcePtr, IrqNest_Handler Handler,
+                        void *CallBackRef, u32 BudgetUs);
+void IrqNest_SetBudget(IrqNestSource *SourcePtr, u32 BudgetUs);
+void IrqNest_InterruptHandler(void *InstancePtr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,140 @@
+/******************************************************************************
+ * Interrupt storm guard - see irq_rate.h
+ ******************************************************************************/
+
+#include "irq_rate.h"
+#include "xinterrupt_wrap.h"
+#include "xtime_l.h"
+#include "xil_printf.h"
+#include "fast_mem.h"
+
+#define COUNTS_PER_US       (COUNTS_PER_SECOND / 1000000U)
+#define COUNTS_PER_MS       (COUNTS_PER_SECOND / 1000U)
+
+/* ------------------------------------------------------------
+ * Guard Handler(CallBackRef) on IntrId, at no more than Limit
+ * interrupts per WindowUs. Call before XSetupInterruptSystem().
+ * ------------------------------------------------------------ */
+void IrqRate_Initialize(IrqRate *RatePtr, u32 IntrId, UINTPTR IntrParent,
+                        IrqRate_Handler Handler, void *CallBackRef,
+                        u32 WindowUs, u32 Limit)
+{
+    RatePtr->IntrId = IntrId;
+    RatePtr->IntrParent = IntrParent;
+    RatePtr->Handler = Handler;
+    RatePtr->CallBackRef = CallBackRef;
+    RatePtr->WindowCycles = (u64)WindowUs * COUNTS_PER_US;
+    RatePtr->Limit = Limit;
+    RatePtr->ResumeLimit = Limit / 2U;
+    RatePtr->MaxHoldoff = IRQ_RATE_MAX_HOLDOFF;
+
+    RatePtr->WindowStart = 0;
+    RatePtr->Count = 0;
+    RatePtr->Holdoff = 1U;
+    RatePtr->Probation = FALSE;
+    RatePtr->ThrottledAt = 0;
+    RatePtr->ResumeAt = 0;
+    RatePtr->Throttled = FALSE;
+
+    RatePtr->Taken = 0;
+    RatePtr->MaxCount = 0;
+    RatePtr->Trips = 0;
+    RatePtr->ThrottledCycles = 0;
+    RatePtr->HandlerCycles = 0;
+}
+
+/* ------------------------------------------------------------
+ * Disable the source for Holdoff windows, twice as long as last
+ * time if it tripped again on probation
+ * ------------------------------------------------------------ */
+static FAST_TEXT void Trip(IrqRate *RatePtr, u64 Now)
+{
+    XDisableIntrId(RatePtr->IntrId, RatePtr->IntrParent);
+
+    if (RatePtr->Probation && (RatePtr->Holdoff < RatePtr->MaxHoldoff)) {
+        RatePtr->Holdoff *= 2U;
+    }
+    RatePtr->ThrottledAt = Now;
+    RatePtr->ResumeAt = Now + RatePtr->Holdoff * RatePtr->WindowCycles;
+    RatePtr->Trips++;
+
+    /* Hand the state to the main loop */
+    __atomic_store_n(&RatePtr->Throttled, TRUE, __ATOMIC_RELEASE);
+}
+
+/* ------------------------------------------------------------
+ * Interrupt handler to pass to XSetupInterruptSystem(): count,
+ * run the guarded handler, disable the source if it is over
+ * ------------------------------------------------------------ */
+FAST_TEXT void IrqRate_InterruptHandler(void *InstancePtr)
+{
+    IrqRate *RatePtr = (IrqRate *)InstancePtr;
+    XTime Now;
+    XTime Done;
+
+    XTime_GetTime(&Now);
+    if ((Now - RatePtr->WindowStart) >= RatePtr->WindowCycles) {
+        /* The last window stayed within the limit */
+        if (RatePtr->Probation) {
+            RatePtr->Probation = FALSE;
+            RatePtr->Holdoff = 1U;
+        }
+        RatePtr->WindowStart = Now;
+        RatePtr->Count = 0;
+    }
+    RatePtr->Count++;
+    RatePtr->Taken++;
+    if (RatePtr->Count > RatePtr->MaxCount) {
+        RatePtr->MaxCount = RatePtr->Count;
+    }
+
+    RatePtr->Handler(RatePtr->CallBackRef);
+    XTime_GetTime(&Done);
+    RatePtr->HandlerCycles += Done - Now;
+
+    if (RatePtr->Count > (RatePtr->Probation ? RatePtr->ResumeLimit :
+                          RatePtr->Limit)) {
+        Trip(RatePtr, Now);
+    }
+}
+
+/* ------------------------------------------------------------
+ * Main loop side. Re-enables the source once its holdoff has
+ * passed, on probation for the first window. Returns TRUE while
+ * it stays disabled.
+ * ------------------------------------------------------------ */
+int IrqRate_Poll(IrqRate *RatePtr)
+{
+    XTime Now;
+
+    if (!__atomic_load_n(&RatePtr->Throttled, __ATOMIC_ACQUIRE)) {
+        return FALSE;
+    }
+    XTime_GetTime(&Now);
+    if (Now < RatePtr->ResumeAt) {
+        return TRUE;
+    }
+
+    RatePtr->ThrottledCycles += Now - RatePtr->ThrottledAt;
+    RatePtr->WindowStart = Now;
+    RatePtr->Count = 0;
+    RatePtr->Probation = TRUE;
+    __atomic_store_n(&RatePtr->Throttled, FALSE, __ATOMIC_RELEASE);
+
+    XEnableIntrId(RatePtr->IntrId, RatePtr->IntrParent);
+    return FALSE;
+}
+
+void IrqRate_Report(const IrqRate *RatePtr, const char *Name)
+{
+    xil_printf("\r\n--- %s: at most %d per %d us, %d on probation ---\r\n",
+               Name, (int)RatePtr->Limit,
+               (int)(RatePtr->WindowCycles / COUNTS_PER_US),
+               (int)RatePtr->ResumeLimit);
+    xil_printf("  %d interrupts, busiest window %d, %d us in the handler\r\n",
+               (int)RatePtr->Taken, (int)RatePtr->MaxCount,
+               (int)(RatePtr->HandlerCycles / COUNTS_PER_US));
+    xil_printf("  %d trips, disabled for %d ms%s\r\n", (int)RatePtr->Trips,
+               (int)(RatePtr->ThrottledCycles / COUNTS_PER_MS),
+               RatePtr->Throttled ? " (still disabled)" : "");
+}
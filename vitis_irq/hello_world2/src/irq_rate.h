@@ -0,0 +1,80 @@
+/******************************************************************************
+ * Interrupt storm guard
+ *
+ * Sits between the GIC dispatch and a source's handler: pass
+ * IrqRate_InterruptHandler() to XSetupInterruptSystem() with the IrqRate
+ * as the instance, in place of the driver handler. Every entry is
+ * counted against a window of WindowCycles global timer ticks. When a
+ * window holds more than Limit interrupts, the handler still runs for
+ * that one, then the source is disabled at the GIC.
+ *
+ * The main loop re-enables the source with IrqRate_Poll() once the
+ * holdoff has passed, so a storm can never take the core away from it
+ * for good. The re-enable has hysteresis on two counts:
+ *   - the source is on probation until it gets through a whole window
+ *     at no more than ResumeLimit (Limit / 2 by default)
+ *   - a trip on probation doubles the holdoff, up to MaxHoldoff windows;
+ *     a passed probation resets it to one window
+ *
+ * While the source is disabled its device keeps the interrupt pending,
+ * so the expiries of a hold are coalesced into one interrupt when it
+ * comes back.
+ *
+ * The handler owns the window state. The main loop touches it only
+ * while Throttled is set, when the source cannot interrupt.
+ ******************************************************************************/
+
+#ifndef IRQ_RATE_H_
+#define IRQ_RATE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+/* Longest holdoff, in windows */
+#ifndef IRQ_RATE_MAX_HOLDOFF
+#define IRQ_RATE_MAX_HOLDOFF    16U
+#endif
+
+typedef void (*IrqRate_Handler)(void *CallBackRef);
+
+typedef struct {
+    u32 IntrId;
+    UINTPTR IntrParent;
+    IrqRate_Handler Handler;
+    void *CallBackRef;
+    u64 WindowCycles;
+    u32 Limit;          /* Most interrupts per window */
+    u32 ResumeLimit;    /* Most per window while on probation */
+    u32 MaxHoldoff;     /* Windows */
+
+    /* Handler side, or main loop while Throttled */
+    u64 WindowStart;
+    u32 Count;          /* Interrupts in the current window */
+    u32 Holdoff;        /* Windows to stay disabled on the next trip */
+    u8 Probation;
+    u64 ThrottledAt;
+    u64 ResumeAt;
+    u8 Throttled;       /* Source disabled, set by the handler */
+
+    /* Statistics */
+    u32 Taken;
+    u32 MaxCount;       /* Busiest window */
+    u32 Trips;
+    u64 ThrottledCycles;
+    u64 HandlerCycles;  /* In the guarded handler, entry/exit excluded */
+} IrqRate;
+
+void IrqRate_Initialize(IrqRate *RatePtr, u32 IntrId, UINTPTR IntrParent,
+                        IrqRate_Handler Handler, void *CallBackRef,
+                        u32 WindowUs, u32 Limit);
+void IrqRate_InterruptHandler(void *InstancePtr);
+int IrqRate_Poll(IrqRate *RatePtr);
+void IrqRate_Report(const IrqRate *RatePtr, const char *Name);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,126 @@
+/******************************************************************************
+ * Deferred ISR logging - see isr_log.h
+ ******************************************************************************/
+
+#include "isr_log.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+#include "fast_mem.h"
+
+#define ISR_LOG_MASK      (ISR_LOG_DEPTH - 1U)
+#define COUNTS_PER_US     (COUNTS_PER_SECOND / 1000000U)
+
+/* ------------------------------------------------------------
+ * Initialize an empty ring
+ * ------------------------------------------------------------ */
+void IsrLog_Init(IsrLog *LogPtr)
+{
+    LogPtr->Head = 0;
+    LogPtr->Tail = 0;
+    LogPtr->Dropped = 0;
+}
+
+/* ------------------------------------------------------------
+ * Producer side - call from interrupt context only.
+ * Returns XST_SUCCESS, or XST_FAILURE when the ring is full
+ * (the record is dropped and counted, the ISR never blocks).
+ * ------------------------------------------------------------ */
+FAST_TEXT int IsrLog_Write(IsrLog *LogPtr, u16 EventId, u32 Counter)
+{
+    u32 Head = LogPtr->Head;
+    u32 Tail = __atomic_load_n(&LogPtr->Tail, __ATOMIC_ACQUIRE);
+    IsrLogRecord *RecordPtr;
+    XTime Now;
+
+    if ((Head - Tail) >= ISR_LOG_DEPTH) {
+        LogPtr->Dropped++;
+        return XST_FAILURE;
+    }
+
+    XTime_GetTime(&Now);
+
+    RecordPtr = &LogPtr->Record[Head & ISR_LOG_MASK];
+    RecordPtr->EventId = EventId;
+    RecordPtr->Reserved = 0;
+    RecordPtr->Counter = Counter;
+    RecordPtr->Timestamp = Now;
+
+    /* Publish the slot only once it is completely written */
+    __atomic_store_n(&LogPtr->Head, Head + 1U, __ATOMIC_RELEASE);
+    return XST_SUCCESS;
+}
+
+/* ------------------------------------------------------------
+ * Consumer side - call from the main loop only.
+ * Returns XST_SUCCESS with *RecordPtr filled in, or XST_FAILURE
+ * when the ring is empty.
+ * ------------------------------------------------------------ */
+int IsrLog_Read(IsrLog *LogPtr, IsrLogRecord *RecordPtr)
+{
+    u32 Tail = LogPtr->Tail;
+    u32 Head = __atomic_load_n(&LogPtr->Head, __ATOMIC_ACQUIRE);
+
+    if (Head == Tail) {
+        return XST_FAILURE;
+    }
+
+    *RecordPtr = LogPtr->Record[Tail & ISR_LOG_MASK];
+
+    /* Hand the slot back to the producer after the copy is done */
+    __atomic_store_n(&LogPtr->Tail, Tail + 1U, __ATOMIC_RELEASE);
+    return XST_SUCCESS;
+}
+
+/* "<seconds>.<microseconds> s", whole seconds keep the full 64 bits */
+static void PrintTime(XTime Counts)
+{
+    xil_printf("%d.%06d s", (int)(Counts / COUNTS_PER_SECOND),
+               (int)((Counts % COUNTS_PER_SECOND) / COUNTS_PER_US));
+}
+
+/* ------------------------------------------------------------
+ * Format and print every pending record.
+ * Returns the number of records printed.
+ * ------------------------------------------------------------ */
+u32 IsrLog_Drain(IsrLog *LogPtr)
+{
+    IsrLogRecord Record;
+    u32 Count = 0;
+    u32 Dropped;
+
+    while (IsrLog_Read(LogPtr, &Record) == XST_SUCCESS) {
+        switch (Record.EventId) {
+        case ISR_LOG_EVT_TIMER_EXPIRED:
+            xil_printf("IRQ %d @ ", (int)Record.Counter);
+            PrintTime(Record.Timestamp);
+            xil_printf("\r\n");
+            break;
+        case ISR_LOG_EVT_TWHEEL:
+            xil_printf("  TWHEEL %d @ ", (int)Record.Counter);
+            PrintTime(Record.Timestamp);
+            xil_printf("\r\n");
+            break;
+        case ISR_LOG_EVT_CLOCK64:
+            xil_printf("  now64() low word in ISR: 0x%08X\r\n", Record.Counter);
+            break;
+        case ISR_LOG_EVT_BUTTON_DOWN:
+        case ISR_LOG_EVT_BUTTON_UP:
+            xil_printf("  BUTTON %s @ ",
+                       (Record.EventId == ISR_LOG_EVT_BUTTON_DOWN) ? "down" : "up");
+            PrintTime(Record.Timestamp - (XTime)Record.Counter * COUNTS_PER_US);
+            xil_printf(", settled after %d us\r\n", (int)Record.Counter);
+            break;
+        default:
+            xil_printf("EVT %d cnt %d\r\n", Record.EventId, (int)Record.Counter);
+            break;
+        }
+        Count++;
+    }
+
+    Dropped = __atomic_exchange_n(&LogPtr->Dropped, 0, __ATOMIC_RELAXED);
+    if (Dropped != 0) {
+        xil_printf("ISR log: %d record(s) dropped\r\n", (int)Dropped);
+    }
+
+    return Count;
+}
@@ -0,0 +1,61 @@
+/******************************************************************************
+ * Deferred ISR logging
+ *
+ * Single-producer / single-consumer ring of fixed-size binary records.
+ * The interrupt handler is the only producer and the main loop is the
+ * only consumer, so no lock is needed: the producer owns Head, the
+ * consumer owns Tail, and each index is published with a store-release
+ * after the slot it covers has been written (or read).
+ *
+ * Formatting and UART output happen in IsrLog_Drain(), outside of
+ * interrupt context.
+ ******************************************************************************/
+
+#ifndef ISR_LOG_H_
+#define ISR_LOG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+/* Number of records in the ring, must be a power of two */
+#ifndef ISR_LOG_DEPTH
+#define ISR_LOG_DEPTH       64U
+#endif
+
+#if (ISR_LOG_DEPTH & (ISR_LOG_DEPTH - 1U)) != 0
+#error "ISR_LOG_DEPTH must be a power of two"
+#endif
+
+/* Event identifiers carried in IsrLogRecord.EventId */
+#define ISR_LOG_EVT_TIMER_EXPIRED   1U
+#define ISR_LOG_EVT_TWHEEL          2U  /* Counter = wheel timer id */
+#define ISR_LOG_EVT_CLOCK64         3U  /* Counter = low word of now64() */
+#define ISR_LOG_EVT_BUTTON_DOWN     4U  /* Counter = us since the first edge */
+#define ISR_LOG_EVT_BUTTON_UP       5U
+
+typedef struct {
+    u16 EventId;        /* ISR_LOG_EVT_* */
+    u16 Reserved;
+    u32 Counter;        /* Event specific counter (e.g. expiry count) */
+    u64 Timestamp;      /* Global timer ticks (COUNTS_PER_SECOND) */
+} IsrLogRecord;
+
+typedef struct {
+    IsrLogRecord Record[ISR_LOG_DEPTH];
+    u32 Head;           /* Written by producer (ISR) only */
+    u32 Tail;           /* Written by consumer (main loop) only */
+    u32 Dropped;        /* Records lost because the ring was full */
+} IsrLog;
+
+void IsrLog_Init(IsrLog *LogPtr);
+int IsrLog_Write(IsrLog *LogPtr, u16 EventId, u32 Counter);
+int IsrLog_Read(IsrLog *LogPtr, IsrLogRecord *RecordPtr);
+u32 IsrLog_Drain(IsrLog *LogPtr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
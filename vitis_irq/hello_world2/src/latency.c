@@ -0,0 +1,114 @@
+/******************************************************************************
+ * Interrupt latency histogram - see latency.h
+ ******************************************************************************/
+
+#include "latency.h"
+#include "xil_printf.h"
+#include "fast_mem.h"
+
+/* ------------------------------------------------------------
+ * Reset all counters. BucketCycles sets the histogram resolution,
+ * so the same code can hold timer-clock or CPU-clock samples.
+ * ------------------------------------------------------------ */
+void LatencyHist_Init(LatencyHist *HistPtr, u32 BucketCycles)
+{
+    u32 i;
+
+    for (i = 0; i < LATENCY_NUM_BUCKETS; i++) {
+        HistPtr->Bucket[i] = 0;
+    }
+    HistPtr->BucketCycles = (BucketCycles != 0) ? BucketCycles : 1U;
+    HistPtr->Overflow = 0;
+    HistPtr->Count = 0;
+    HistPtr->Min = 0xFFFFFFFFU;
+    HistPtr->Max = 0;
+    HistPtr->Sum = 0;
+}
+
+/* ------------------------------------------------------------
+ * Add one sample. Cheap enough to be called from the ISR.
+ * ------------------------------------------------------------ */
+FAST_TEXT void LatencyHist_Record(LatencyHist *HistPtr, u32 Cycles)
+{
+    u32 Index = Cycles / HistPtr->BucketCycles;
+
+    if (Index < LATENCY_NUM_BUCKETS) {
+        HistPtr->Bucket[Index]++;
+    } else {
+        HistPtr->Overflow++;
+    }
+
+    if (Cycles < HistPtr->Min) {
+        HistPtr->Min = Cycles;
+    }
+    if (Cycles > HistPtr->Max) {
+        HistPtr->Max = Cycles;
+    }
+    HistPtr->Sum += Cycles;
+    HistPtr->Count++;
+}
+
+/* ------------------------------------------------------------
+ * Return the (Num / Den) percentile in cycles, e.g. 999/1000 for
+ * p99.9. The result is the upper edge of the bucket holding the
+ * requested rank, clamped to the observed maximum. Samples in the
+ * overflow bucket resolve to Max.
+ * ------------------------------------------------------------ */
+u32 LatencyHist_Percentile(const LatencyHist *HistPtr, u32 Num, u32 Den)
+{
+    u64 Rank;
+    u64 Seen = 0;
+    u32 Edge;
+    u32 i;
+
+    if (HistPtr->Count == 0) {
+        return 0;
+    }
+
+    /* 1-based rank of the sample at or below which Num/Den of all fall */
+    Rank = ((u64)HistPtr->Count * Num + Den - 1U) / Den;
+    if (Rank == 0) {
+        Rank = 1;
+    }
+
+    for (i = 0; i < LATENCY_NUM_BUCKETS; i++) {
+        Seen += HistPtr->Bucket[i];
+        if (Seen >= Rank) {
+            Edge = (i + 1U) * HistPtr->BucketCycles - 1U;
+            return (Edge < HistPtr->Max) ? Edge : HistPtr->Max;
+        }
+    }
+
+    return HistPtr->Max;
+}
+
+/* ------------------------------------------------------------
+ * Print min/avg/max and the tail percentiles in cycles and ns
+ * ------------------------------------------------------------ */
+static void PrintCycles(const char *Label, u32 Cycles, u32 ClockHz)
+{
+    u32 Ns = (u32)(((u64)Cycles * 1000000000U) / ClockHz);
+
+    xil_printf("  %-6s %8d cycles  %8d ns\r\n", Label, (int)Cycles, (int)Ns);
+}
+
+void LatencyHist_Report(const LatencyHist *HistPtr, const char *Name,
+                        u32 ClockHz)
+{
+    xil_printf("\r\n--- %s latency (%d samples) ---\r\n", Name,
+               (int)HistPtr->Count);
+    if (HistPtr->Count == 0) {
+        return;
+    }
+
+    PrintCycles("min", HistPtr->Min, ClockHz);
+    PrintCycles("avg", (u32)(HistPtr->Sum / HistPtr->Count), ClockHz);
+    PrintCycles("p50", LatencyHist_Percentile(HistPtr, 50, 100), ClockHz);
+    PrintCycles("p99", LatencyHist_Percentile(HistPtr, 99, 100), ClockHz);
+    PrintCycles("p99.9", LatencyHist_Percentile(HistPtr, 999, 1000), ClockHz);
+    PrintCycles("max", HistPtr->Max, ClockHz);
+    if (HistPtr->Overflow != 0) {
+        xil_printf("  %d sample(s) above %d cycles\r\n", (int)HistPtr->Overflow,
+                   (int)(LATENCY_NUM_BUCKETS * HistPtr->BucketCycles));
+    }
+}
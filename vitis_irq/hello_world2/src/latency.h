@@ -0,0 +1,47 @@
+/******************************************************************************
+ * Interrupt latency histogram
+ *
+ * The AXI timer counts down from the reset value and reloads on expiry,
+ * so (reset value - TCR) read on ISR entry is the number of timer clock
+ * cycles elapsed between the counter hitting zero and the handler
+ * running. Samples are accumulated in fixed-width buckets; the
+ * percentiles are derived from the bucket counts.
+ ******************************************************************************/
+
+#ifndef LATENCY_H_
+#define LATENCY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+/* Default bucket width, in timer clock cycles (10 ns @ 100 MHz) */
+#ifndef LATENCY_BUCKET_CYCLES
+#define LATENCY_BUCKET_CYCLES   4U
+#endif
+#ifndef LATENCY_NUM_BUCKETS
+#define LATENCY_NUM_BUCKETS     256U
+#endif
+
+typedef struct {
+    u32 Bucket[LATENCY_NUM_BUCKETS];
+    u32 BucketCycles;   /* Width of one bucket */
+    u32 Overflow;       /* Samples beyond the last bucket */
+    u32 Count;
+    u32 Min;
+    u32 Max;
+    u64 Sum;
+} LatencyHist;
+
+void LatencyHist_Init(LatencyHist *HistPtr, u32 BucketCycles);
+void LatencyHist_Record(LatencyHist *HistPtr, u32 Cycles);
+u32 LatencyHist_Percentile(const LatencyHist *HistPtr, u32 Num, u32 Den);
+void LatencyHist_Report(const LatencyHist *HistPtr, const char *Name,
+                        u32 ClockHz);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
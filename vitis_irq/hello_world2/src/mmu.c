@@ -0,0 +1,207 @@
+/******************************************************************************
+ * Cortex-A53 memory map - see mmu.h
+ ******************************************************************************/
+
+#include "mmu.h"
+#include "xstatus.h"
+
+#if defined(__aarch64__) && !defined(HOST_SIM)
+
+#include "xil_cache.h"
+
+#define MMU_MAIR_BSP        0x000000BB0400FF44ULL
+
+#define DESC_TYPE_MASK      0x3ULL
+#define DESC_BLOCK          0x1ULL
+#define DESC_TABLE          0x3ULL
+#define DESC_ATTR_MASK      0xFFF0000000000FFCULL   /* Upper and lower attrs */
+
+#define SCTLR_M             (1ULL << 0)
+
+#define L2_PER_GB           (MMU_GB_SIZE / MMU_BLOCK_SIZE)
+#define NUM_GB              4U                      /* Low 4 GB only */
+
+/* translation_table.S: one level 1 entry per GB, each pointing to one
+ * page of MMUTableL2, the pages back to back */
+extern u64 MMUTableL1[];
+extern u64 MMUTableL2[];
+
+/* ------------------------------------------------------------
+ * MMU off / on around descriptor updates
+ * ------------------------------------------------------------ */
+static u64 ReadCurrentEl(void)
+{
+    u64 El;
+
+    __asm__ __volatile__("mrs %0, CurrentEL" : "=r" (El));
+    return (El >> 2) & 3U;
+}
+
+static u64 ReadMair(void)
+{
+    u64 Mair;
+
+    __asm__ __volatile__("mrs %0, mair_el3" : "=r" (Mair));
+    return Mair;
+}
+
+static u64 MmuOff(void)
+{
+    u64 Daif;
+    u64 Sctlr;
+
+    __asm__ __volatile__("mrs %0, daif\n\tmsr daifset, #3"
+                         : "=r" (Daif) : : "memory");
+    Xil_DCacheDisable();
+    __asm__ __volatile__("mrs %0, sctlr_el3" : "=r" (Sctlr));
+    __asm__ __volatile__("msr sctlr_el3, %0\n\tisb"
+                         : : "r" (Sctlr & ~SCTLR_M) : "memory");
+    return Daif;
+}
+
+static void MmuOn(u64 Daif)
+{
+    u64 Sctlr;
+
+    __asm__ __volatile__("dsb sy\n\ttlbi alle3\n\tdsb sy\n\tisb"
+                         : : : "memory");
+    __asm__ __volatile__("mrs %0, sctlr_el3" : "=r" (Sctlr));
+    __asm__ __volatile__("msr sctlr_el3, %0\n\tisb"
+                         : : "r" (Sctlr | SCTLR_M) : "memory");
+    Xil_DCacheEnable();
+    __asm__ __volatile__("msr daif, %0" : : "r" (Daif) : "memory");
+}
+
+static int CanRemap(void)
+{
+    return (ReadCurrentEl() == 3U) && (ReadMair() == MMU_MAIR_BSP);
+}
+
+/* ------------------------------------------------------------
+ * Descriptor updates, MMU off
+ * ------------------------------------------------------------ */
+static void SetGb(u32 Gb, u64 Attr)
+{
+    MMUTableL1[Gb] = ((u64)Gb * MMU_GB_SIZE) | Attr;
+}
+
+/* Replace a 1 GB block by its level 2 page, same attributes */
+static void SplitGb(u32 Gb)
+{
+    u64 Desc = MMUTableL1[Gb];
+    u64 *Page = &MMUTableL2[Gb * L2_PER_GB];
+    u32 i;
+
+    if ((Desc & DESC_TYPE_MASK) != DESC_BLOCK) {
+        return;
+    }
+    for (i = 0; i < L2_PER_GB; i++) {
+        Page[i] = ((u64)Gb * MMU_GB_SIZE) + ((u64)i * MMU_BLOCK_SIZE) +
+                  (Desc & DESC_ATTR_MASK) + DESC_BLOCK;
+    }
+    MMUTableL1[Gb] = (u64)(UINTPTR)Page | DESC_TABLE;
+}
+
+static void SetBlock(u64 Addr, u64 Attr)
+{
+    SplitGb((u32)(Addr / MMU_GB_SIZE));
+    MMUTableL2[Addr / MMU_BLOCK_SIZE] = Addr | Attr;
+}
+
+/* ------------------------------------------------------------
+ * Explicit map of DDR, the PL window and OCM
+ * ------------------------------------------------------------ */
+int Mmu_MapPlatform(void)
+{
+    u64 DdrEnd = (u64)MMU_DDR_BASE + MMU_DDR_SIZE;
+    u64 Base;
+    u64 Addr;
+    u64 Daif;
+    u32 Gb;
+
+    if (!CanRemap()) {
+        return XST_FAILURE;
+    }
+
+    Daif = MmuOff();
+    for (Gb = 0; Gb < NUM_GB; Gb++) {
+        Base = (u64)Gb * MMU_GB_SIZE;
+        if ((Base >= MMU_DDR_BASE) && ((Base + MMU_GB_SIZE) <= DdrEnd)) {
+            SetGb(Gb, MMU_NORMAL_WB);
+        } else if (Base == MMU_PL_BASE) {
+            SetGb(Gb, MMU_DEVICE_NGNRE);
+        }
+    }
+    /* DDR that ends inside a gigabyte stays in 2 MB blocks */
+    for (Addr = MMU_DDR_BASE; Addr < DdrEnd; Addr += MMU_BLOCK_SIZE) {
+        if ((MMUTableL1[Addr / MMU_GB_SIZE] & DESC_TYPE_MASK) == DESC_TABLE) {
+            SetBlock(Addr, MMU_NORMAL_WB);
+        }
+    }
+    SetBlock(MMU_OCM_BLOCK, MMU_NORMAL_WB);
+    MmuOn(Daif);
+
+    return XST_SUCCESS;
+}
+
+/* ------------------------------------------------------------
+ * Remap [Addr, Addr + Size) in 2 MB blocks. Callers moving data
+ * to a non-cacheable mapping need not flush, turning the D-cache
+ * off for the update cleans it.
+ * ------------------------------------------------------------ */
+int Mmu_MapRange(UINTPTR Addr, u64 Size, u64 Attr)
+{
+    u64 Daif;
+    u64 Offset;
+
+    if ((((u64)Addr | Size) & (MMU_BLOCK_SIZE - 1U)) != 0U ||
+        (((u64)Addr + Size) > ((u64)NUM_GB * MMU_GB_SIZE))) {
+        return XST_INVALID_PARAM;
+    }
+    if (!CanRemap()) {
+        return XST_FAILURE;
+    }
+
+    Daif = MmuOff();
+    for (Offset = 0; Offset < Size; Offset += MMU_BLOCK_SIZE) {
+        SetBlock((u64)Addr + Offset, Attr);
+    }
+    MmuOn(Daif);
+
+    return XST_SUCCESS;
+}
+
+#else
+
+int Mmu_MapPlatform(void)
+{
+    return XST_SUCCESS;
+}
+
+int Mmu_MapRange(UINTPTR Addr, u64 Size, u64 Attr)
+{
+    (void)Addr;
+    (void)Size;
+    (void)Attr;
+    return XST_SUCCESS;
+}
+
+#endif
+
+const char *Mmu_AttrName(u64 Attr)
+{
+    switch (Attr) {
+    case MMU_NORMAL_WB:
+        return "normal WB";
+    case MMU_NORMAL_WT:
+        return "normal WT";
+    case MMU_NORMAL_NC:
+        return "normal NC";
+    case MMU_DEVICE_NGNRNE:
+        return "device nGnRnE";
+    case MMU_DEVICE_NGNRE:
+        return "device nGnRE";
+    default:
+        return "?";
+    }
+}
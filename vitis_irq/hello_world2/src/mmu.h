@@ -0,0 +1,68 @@
+/******************************************************************************
+ * Cortex-A53 memory map
+ *
+ * The standalone BSP boots with translation_table.S: the low 4 GB in
+ * 2 MB blocks, DDR and OCM normal write-back, the PL window at
+ * 0x80000000 strongly ordered (Device-nGnRnE). Mmu_MapPlatform()
+ * replaces that with an explicit map of what this application uses:
+ *
+ *   DDR    normal write-back, inner shareable, 1 GB blocks where DDR
+ *          covers the whole gigabyte (one TLB entry for all of it)
+ *   PL     0x80000000-0xBFFFFFFF, one 1 GB Device-nGnRE block, never
+ *          executable: AXI timer/GPIO writes may be acknowledged
+ *          early, accesses to one peripheral stay in order
+ *   OCM    the 2 MB block at 0xFFE00000, normal write-back
+ *
+ * Everything else keeps its BSP entry. Mmu_MapRange() remaps 2 MB
+ * aligned ranges, splitting a 1 GB block into 2 MB ones first.
+ *
+ * Descriptors are written with the MMU and D-cache off, so there is
+ * never a stale or conflicting TLB entry (no break-before-make
+ * needed), and the TLB is invalidated before the MMU is turned back
+ * on. That costs a full D-cache clean per call: bring-up and
+ * benchmarks only, never from an ISR. EL3 only, as the BSP runs.
+ *
+ * The host simulation has no MMU; there these are no-ops.
+ ******************************************************************************/
+
+#ifndef MMU_H_
+#define MMU_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+/* DDR on ZUBoard 1CG */
+#ifndef MMU_DDR_BASE
+#define MMU_DDR_BASE        0x00000000U
+#endif
+#ifndef MMU_DDR_SIZE
+#define MMU_DDR_SIZE        0x40000000U
+#endif
+
+#define MMU_PL_BASE         0x80000000U
+#define MMU_OCM_BLOCK       0xFFE00000U
+
+#define MMU_BLOCK_SIZE      0x00200000U     /* Level 2 block */
+#define MMU_GB_SIZE         0x40000000U     /* Level 1 block */
+
+/* Block descriptor attributes for the BSP's MAIR_EL3 (0x000000BB0400FF44):
+ * AttrIndx 0 normal NC, 1 normal WB, 2 nGnRnE, 3 nGnRE, 4 normal WT;
+ * access flag set, EL3 read/write */
+#define MMU_XN              (3ULL << 53)    /* UXN | PXN */
+#define MMU_NORMAL_WB       0x705ULL        /* Inner shareable */
+#define MMU_NORMAL_WT       0x711ULL        /* Inner shareable */
+#define MMU_NORMAL_NC       0x401ULL
+#define MMU_DEVICE_NGNRNE   (0x409ULL | MMU_XN)
+#define MMU_DEVICE_NGNRE    (0x40DULL | MMU_XN)
+
+int Mmu_MapPlatform(void);
+int Mmu_MapRange(UINTPTR Addr, u64 Size, u64 Attr);
+const char *Mmu_AttrName(u64 Attr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -5,11 +5,24 @@
 
 #include "xparameters.h"
 #include "xil_cache.h"
+#include "mmu.h"
 
 #ifndef SDT
 #include "platform_config.h"
 #endif
 
+/*
+ * Behind a PSU_PERIPH_LAZY FSBL, the PS peripherals the boot deferred
+ * are down until the application brings them up (psu_periph.h).
+ * hello_world2 drives none of them: its GPIOs and timer are in the PL.
+ */
+#ifdef PSU_PERIPH_LAZY
+#ifndef PSU_PERIPH_APP_UNITS
+#define PSU_PERIPH_APP_UNITS    0U
+#endif
+#include "psu_periph.h"
+#endif
+
 /*
  * Uncomment one of the following two lines, depending on the target,
  * if ps7/psu init source files are added in the source directory for
@@ -37,6 +50,12 @@ enable_caches()
 #ifdef XPAR_MICROBLAZE_USE_DCACHE
     Xil_DCacheEnable();
 #endif
+#elif defined(__aarch64__)
+    /* Explicit DDR/PL/OCM attributes and 1 GB blocks in place of the
+     * BSP table (mmu.h); the BSP map stays if it cannot be changed */
+    (void)Mmu_MapPlatform();
+    Xil_ICacheEnable();
+    Xil_DCacheEnable();
 #endif
 }
 
@@ -77,6 +96,10 @@ init_platform()
     /* psu_init();*/
     enable_caches();
     init_uart();
+#ifdef PSU_PERIPH_LAZY
+    /* Before any of their drivers is initialized */
+    (void)PSU_PERIPH_REQUIRE(PSU_PERIPH_APP_UNITS);
+#endif
 }
 
 void
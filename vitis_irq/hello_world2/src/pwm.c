@@ -0,0 +1,114 @@
+/******************************************************************************
+ * Hardware PWM on the AXI timer (PWM0) - see pwm.h
+ ******************************************************************************/
+
+#include "pwm.h"
+#include "xtmrctr.h"
+#include "xstatus.h"
+
+/* Counter 0 and 1 setup, ENALL then starts both on the same cycle */
+#define PWM_CSR     (XTC_CSR_ENABLE_PWM_MASK | XTC_CSR_EXT_GENERATE_MASK | \
+                     XTC_CSR_AUTO_RELOAD_MASK | XTC_CSR_DOWN_COUNT_MASK)
+
+/* Register value for an interval of Cycles, counting down */
+#define PWM_TLR(Cycles)     ((Cycles) - 2U)
+
+void Pwm_Initialize(Pwm *InstancePtr, UINTPTR BaseAddress, u32 ClockHz)
+{
+    InstancePtr->BaseAddress = BaseAddress;
+    InstancePtr->ClockHz = ClockHz;
+    InstancePtr->Period = 0;
+    InstancePtr->High = 0;
+    InstancePtr->IsRunning = FALSE;
+}
+
+/* ------------------------------------------------------------
+ * Drive PWM0 at FreqHz with Duty / PWM_DUTY_SCALE high time, both
+ * rounded to the nearest timer cycle. The high time is kept between
+ * 2 cycles and one cycle short of the period; Duty 0 stops the output
+ * low. A running PWM changes at its next period boundary.
+ * ------------------------------------------------------------ */
+int Pwm_Set(Pwm *InstancePtr, u32 FreqHz, u32 Duty)
+{
+    u32 Period;
+    u32 High;
+
+    if ((FreqHz == 0) || (Duty > PWM_DUTY_SCALE)) {
+        return XST_INVALID_PARAM;
+    }
+    Period = (InstancePtr->ClockHz + (FreqHz / 2U)) / FreqHz;
+    if (Period < PWM_MIN_PERIOD) {
+        return XST_INVALID_PARAM;
+    }
+    if (Duty == 0) {
+        Pwm_Stop(InstancePtr);
+        return XST_SUCCESS;
+    }
+
+    High = (u32)((((u64)Period * Duty) + (PWM_DUTY_SCALE / 2U)) /
+                 PWM_DUTY_SCALE);
+    if (High < 2U) {
+        High = 2U;
+    } else if (High >= Period) {
+        High = Period - 1U;
+    }
+
+    if (InstancePtr->IsRunning) {
+        if (Period != InstancePtr->Period) {
+            XTmrCtr_WriteReg(InstancePtr->BaseAddress, 0, XTC_TLR_OFFSET,
+                             PWM_TLR(Period));
+        }
+        XTmrCtr_WriteReg(InstancePtr->BaseAddress, 1, XTC_TLR_OFFSET,
+                         PWM_TLR(High));
+    } else {
+        XTmrCtr_WriteReg(InstancePtr->BaseAddress, 0, XTC_TCSR_OFFSET, 0);
+        XTmrCtr_WriteReg(InstancePtr->BaseAddress, 1, XTC_TCSR_OFFSET, 0);
+        XTmrCtr_WriteReg(InstancePtr->BaseAddress, 0, XTC_TLR_OFFSET,
+                         PWM_TLR(Period));
+        XTmrCtr_WriteReg(InstancePtr->BaseAddress, 1, XTC_TLR_OFFSET,
+                         PWM_TLR(High));
+        XTmrCtr_WriteReg(InstancePtr->BaseAddress, 0, XTC_TCSR_OFFSET,
+                         PWM_CSR | XTC_CSR_LOAD_MASK);
+        XTmrCtr_WriteReg(InstancePtr->BaseAddress, 1, XTC_TCSR_OFFSET,
+                         PWM_CSR | XTC_CSR_LOAD_MASK);
+        XTmrCtr_WriteReg(InstancePtr->BaseAddress, 1, XTC_TCSR_OFFSET,
+                         PWM_CSR);
+        XTmrCtr_WriteReg(InstancePtr->BaseAddress, 0, XTC_TCSR_OFFSET,
+                         PWM_CSR | XTC_CSR_ENABLE_ALL_MASK);
+        InstancePtr->IsRunning = TRUE;
+    }
+
+    InstancePtr->Period = Period;
+    InstancePtr->High = High;
+    return XST_SUCCESS;
+}
+
+/* ------------------------------------------------------------
+ * Stop both counters, PWM0 goes low
+ * ------------------------------------------------------------ */
+void Pwm_Stop(Pwm *InstancePtr)
+{
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, 0, XTC_TCSR_OFFSET, 0);
+    XTmrCtr_WriteReg(InstancePtr->BaseAddress, 1, XTC_TCSR_OFFSET, 0);
+    InstancePtr->IsRunning = FALSE;
+}
+
+/* ------------------------------------------------------------
+ * Frequency and duty actually programmed, after rounding
+ * ------------------------------------------------------------ */
+u32 Pwm_GetFreqHz(const Pwm *InstancePtr)
+{
+    if (InstancePtr->Period == 0) {
+        return 0;
+    }
+    return InstancePtr->ClockHz / InstancePtr->Period;
+}
+
+u32 Pwm_GetDuty(const Pwm *InstancePtr)
+{
+    if (!InstancePtr->IsRunning) {
+        return 0;
+    }
+    return (u32)((((u64)InstancePtr->High * PWM_DUTY_SCALE) +
+                  (InstancePtr->Period / 2U)) / InstancePtr->Period);
+}
@@ -0,0 +1,49 @@
+/******************************************************************************
+ * Hardware PWM on the AXI timer (PWM0)
+ *
+ * With both counters in generate mode and PWMA set, the AXI timer
+ * drives PWM0 by itself: counter 0 sets the period, counter 1 the high
+ * time (PG079). Counting down, the period is TLR0 + 2 timer clock
+ * cycles and the high time TLR1 + 2, so the register values are the
+ * cycle counts minus two. Needs the timer built with both counters
+ * (C_ONE_TIMER_ONLY = 0).
+ *
+ * Once started the CPU is not involved. A duty change only writes
+ * TLR1, which counter 1 picks up at its next reload, so the output
+ * never sees a partial period. PWM takes both counters: it cannot run
+ * together with the timer interrupt demos.
+ ******************************************************************************/
+
+#ifndef PWM_H_
+#define PWM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+/* Duty cycle unit: 10000 = 100 % */
+#define PWM_DUTY_SCALE      10000U
+
+/* Shortest period: 2-cycle high time, one cycle low */
+#define PWM_MIN_PERIOD      4U
+
+typedef struct {
+    UINTPTR BaseAddress;
+    u32 ClockHz;            /* AXI timer clock */
+    u32 Period;             /* Timer cycles */
+    u32 High;               /* Timer cycles */
+    u8 IsRunning;
+} Pwm;
+
+void Pwm_Initialize(Pwm *InstancePtr, UINTPTR BaseAddress, u32 ClockHz);
+int Pwm_Set(Pwm *InstancePtr, u32 FreqHz, u32 Duty);
+void Pwm_Stop(Pwm *InstancePtr);
+u32 Pwm_GetFreqHz(const Pwm *InstancePtr);
+u32 Pwm_GetDuty(const Pwm *InstancePtr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
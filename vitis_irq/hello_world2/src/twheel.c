@@ -0,0 +1,535 @@
+/******************************************************************************
+ * Software timer wheel on the single AXI timer counter - see twheel.h
+ ******************************************************************************/
+
+#include "twheel.h"
+#include "xtmrctr.h"
+#include "xil_exception.h"
+
+#define TWHEEL_SLOT_MASK    (TWHEEL_SLOTS - 1U)
+
+/* Longest interval the 32-bit counter can be loaded with, in ticks */
+#define TWHEEL_MAX_HW_TICKS (0xFFFFFFFFU / TWHEEL_TICK_CYCLES)
+
+/* Shortest load, so a late re-arm cannot turn the auto-reload into
+ * an interrupt storm
+ */
+#define TWHEEL_MIN_LOAD_CYCLES  (TWHEEL_TICK_CYCLES / 2U)
+
+/* Re-arms timed by HwCalibrate() */
+#define TWHEEL_CALIBRATE_RUNS   8U
+
+static u32 HwCalibrate(UINTPTR BaseAddress);
+
+/* ------------------------------------------------------------
+ * Intrusive list helpers
+ * ------------------------------------------------------------ */
+static inline void ListInit(TWheelLink *HeadPtr)
+{
+    HeadPtr->Next = HeadPtr;
+    HeadPtr->Prev = HeadPtr;
+}
+
+static inline int ListIsEmpty(const TWheelLink *HeadPtr)
+{
+    return HeadPtr->Next == HeadPtr;
+}
+
+static inline void ListAddTail(TWheelLink *HeadPtr, TWheelLink *LinkPtr)
+{
+    LinkPtr->Prev = HeadPtr->Prev;
+    LinkPtr->Next = HeadPtr;
+    HeadPtr->Prev->Next = LinkPtr;
+    HeadPtr->Prev = LinkPtr;
+}
+
+static inline void ListRemove(TWheelLink *LinkPtr)
+{
+    LinkPtr->Prev->Next = LinkPtr->Next;
+    LinkPtr->Next->Prev = LinkPtr->Prev;
+    LinkPtr->Next = LinkPtr;
+    LinkPtr->Prev = LinkPtr;
+}
+
+/* Move every entry of From onto the (empty) list To */
+static inline void ListSplice(TWheelLink *FromPtr, TWheelLink *ToPtr)
+{
+    if (ListIsEmpty(FromPtr)) {
+        ListInit(ToPtr);
+        return;
+    }
+    ToPtr->Next = FromPtr->Next;
+    ToPtr->Prev = FromPtr->Prev;
+    ToPtr->Next->Prev = ToPtr;
+    ToPtr->Prev->Next = ToPtr;
+    ListInit(FromPtr);
+}
+
+/* ------------------------------------------------------------
+ * Distance, in slots, from slot Current to the first occupied slot
+ * after it (1..64, 64 meaning Current itself one rotation later).
+ * Returns 0 when the level is empty.
+ * ------------------------------------------------------------ */
+static u32 NextOccupied(u64 Occupied, u32 Current)
+{
+    u64 Rotated;
+
+    if (Occupied == 0) {
+        return 0;
+    }
+
+    /* Bit k of Rotated is slot (Current + k) mod 64 */
+    Rotated = (Current == 0) ? Occupied :
+              ((Occupied >> Current) | (Occupied << (TWHEEL_SLOTS - Current)));
+    if ((Rotated & ~(u64)1U) == 0) {
+        return TWHEEL_SLOTS;
+    }
+    return (u32)__builtin_ctzll(Rotated & ~(u64)1U);
+}
+
+/* ------------------------------------------------------------
+ * Put a timer in the slot matching its expiry relative to Now.
+ * Expires may equal Now during a cascade; it then lands in the
+ * level 0 slot that is fired right after.
+ * ------------------------------------------------------------ */
+static void Place(TWheel *WheelPtr, TWheelTimer *TimerPtr)
+{
+    u64 Expires = TimerPtr->Expires;
+    u64 Delta = Expires - WheelPtr->Now;
+    u32 Level = 0;
+    u32 Slot;
+
+    if (Delta >= TWHEEL_RANGE) {
+        /* Park at the far end of the wheel, re-placed on cascade */
+        Delta = TWHEEL_RANGE - 1U;
+        Expires = WheelPtr->Now + Delta;
+    }
+
+    while ((Level < (TWHEEL_LEVELS - 1U)) &&
+           (Delta >= ((u64)1U << (TWHEEL_LEVEL_BITS * (Level + 1U))))) {
+        Level++;
+    }
+
+    Slot = (u32)(Expires >> (TWHEEL_LEVEL_BITS * Level)) & TWHEEL_SLOT_MASK;
+
+    TimerPtr->Level = (u8)Level;
+    TimerPtr->Slot = (u8)Slot;
+    ListAddTail(&WheelPtr->Slot[Level][Slot], &TimerPtr->Link);
+    WheelPtr->Occupied[Level] |= ((u64)1U << Slot);
+}
+
+/* ------------------------------------------------------------
+ * Initialize an empty wheel bound to the AXI timer at BaseAddress
+ * ------------------------------------------------------------ */
+void TWheel_Init(TWheel *WheelPtr, UINTPTR BaseAddress)
+{
+    u32 Level;
+    u32 Slot;
+
+    for (Level = 0; Level < TWHEEL_LEVELS; Level++) {
+        for (Slot = 0; Slot < TWHEEL_SLOTS; Slot++) {
+            ListInit(&WheelPtr->Slot[Level][Slot]);
+        }
+        WheelPtr->Occupied[Level] = 0;
+    }
+    WheelPtr->Now = 0;
+    WheelPtr->BaseAddress = BaseAddress;
+    WheelPtr->Armed = TWHEEL_NO_EVENT;
+    WheelPtr->LoadedCycles = 0;
+    WheelPtr->Late = 0;
+    WheelPtr->ReloadCycles = 0;
+    if (BaseAddress != 0) {
+        WheelPtr->ReloadCycles = HwCalibrate(BaseAddress);
+    }
+    WheelPtr->Fired = 0;
+    WheelPtr->Wakeups = 0;
+}
+
+void TWheel_TimerInit(TWheelTimer *TimerPtr, TWheel_Handler Handler,
+                      void *CallBackRef)
+{
+    ListInit(&TimerPtr->Link);
+    TimerPtr->Expires = 0;
+    TimerPtr->Period = 0;
+    TimerPtr->Level = 0;
+    TimerPtr->Slot = 0;
+    TimerPtr->IsActive = FALSE;
+    TimerPtr->Handler = Handler;
+    TimerPtr->CallBackRef = CallBackRef;
+}
+
+/* ------------------------------------------------------------
+ * Arm a timer Delay ticks from Now (at least 1), repeating every
+ * Period ticks if Period is not 0. Re-adding an active timer moves it.
+ * ------------------------------------------------------------ */
+void TWheel_Add(TWheel *WheelPtr, TWheelTimer *TimerPtr, u32 Delay,
+                u32 Period)
+{
+    if (TimerPtr->IsActive) {
+        TWheel_Cancel(WheelPtr, TimerPtr);
+    }
+
+    TimerPtr->Expires = WheelPtr->Now + ((Delay != 0) ? Delay : 1U);
+    TimerPtr->Period = Period;
+    TimerPtr->IsActive = TRUE;
+    Place(WheelPtr, TimerPtr);
+}
+
+void TWheel_Cancel(TWheel *WheelPtr, TWheelTimer *TimerPtr)
+{
+    TWheelLink *HeadPtr;
+
+    if (!TimerPtr->IsActive) {
+        return;
+    }
+
+    ListRemove(&TimerPtr->Link);
+    TimerPtr->IsActive = FALSE;
+
+    HeadPtr = &WheelPtr->Slot[TimerPtr->Level][TimerPtr->Slot];
+    if (ListIsEmpty(HeadPtr)) {
+        WheelPtr->Occupied[TimerPtr->Level] &= ~((u64)1U << TimerPtr->Slot);
+    }
+}
+
+/* ------------------------------------------------------------
+ * Earliest tick at which the wheel has work: a level 0 slot to fire
+ * or a higher level slot to cascade. Cascade points are not real
+ * deadlines, they only cost a wakeup that fires nothing.
+ * ------------------------------------------------------------ */
+u64 TWheel_NextEvent(const TWheel *WheelPtr)
+{
+    u64 Next = TWHEEL_NO_EVENT;
+    u64 Now = WheelPtr->Now;
+    u32 Level;
+    u32 Distance;
+
+    /* Level 0 slots hold timers due within 63 ticks, the current slot
+     * only transiently while a cascade drops timers due right now
+     */
+    if ((WheelPtr->Occupied[0] & ((u64)1U << (Now & TWHEEL_SLOT_MASK))) != 0) {
+        return Now;
+    }
+    Distance = NextOccupied(WheelPtr->Occupied[0], (u32)Now & TWHEEL_SLOT_MASK);
+    if (Distance != 0) {
+        Next = Now + Distance;
+    }
+
+    for (Level = 1; Level < TWHEEL_LEVELS; Level++) {
+        u32 Shift = TWHEEL_LEVEL_BITS * Level;
+        u64 Base = Now >> Shift;
+        u64 Event;
+
+        Distance = NextOccupied(WheelPtr->Occupied[Level],
+                                (u32)Base & TWHEEL_SLOT_MASK);
+        if (Distance == 0) {
+            continue;
+        }
+        Event = (Base + Distance) << Shift;
+        if (Event < Next) {
+            Next = Event;
+        }
+    }
+
+    return Next;
+}
+
+/* ------------------------------------------------------------
+ * Move every timer of one higher level slot down the wheel
+ * ------------------------------------------------------------ */
+static void Cascade(TWheel *WheelPtr, u32 Level, u32 Slot)
+{
+    TWheelLink Pending;
+
+    ListSplice(&WheelPtr->Slot[Level][Slot], &Pending);
+    WheelPtr->Occupied[Level] &= ~((u64)1U << Slot);
+
+    while (!ListIsEmpty(&Pending)) {
+        TWheelTimer *TimerPtr = (TWheelTimer *)Pending.Next;
+
+        ListRemove(&TimerPtr->Link);
+        Place(WheelPtr, TimerPtr);
+    }
+}
+
+/* ------------------------------------------------------------
+ * Run the wheel forward to Target, firing every timer due on the
+ * way. Empty stretches are skipped using the occupancy bitmaps.
+ * Returns the number of callbacks run.
+ * ------------------------------------------------------------ */
+u32 TWheel_Advance(TWheel *WheelPtr, u64 Target)
+{
+    u32 Fired = 0;
+
+    while (1) {
+        u64 Next = TWheel_NextEvent(WheelPtr);
+        TWheelLink Due;
+        u32 Level;
+
+        if ((Next == TWHEEL_NO_EVENT) || (Next > Target)) {
+            if (Target > WheelPtr->Now) {
+                WheelPtr->Now = Target;
+            }
+            break;
+        }
+        WheelPtr->Now = Next;
+
+        /* Higher levels first, so their timers can reach level 0 */
+        for (Level = TWHEEL_LEVELS - 1U; Level > 0; Level--) {
+            u32 Shift = TWHEEL_LEVEL_BITS * Level;
+
+            if ((Next & (((u64)1U << Shift) - 1U)) == 0) {
+                Cascade(WheelPtr, Level, (u32)(Next >> Shift) & TWHEEL_SLOT_MASK);
+            }
+        }
+
+        /* Detach the due slot so callbacks can safely re-arm */
+        ListSplice(&WheelPtr->Slot[0][Next & TWHEEL_SLOT_MASK], &Due);
+        WheelPtr->Occupied[0] &= ~((u64)1U << (Next & TWHEEL_SLOT_MASK));
+
+        while (!ListIsEmpty(&Due)) {
+            TWheelTimer *TimerPtr = (TWheelTimer *)Due.Next;
+
+            ListRemove(&TimerPtr->Link);
+            TimerPtr->IsActive = FALSE;
+
+            if (TimerPtr->Period != 0) {
+                /* Periodic timers keep their phase */
+                TimerPtr->Expires += TimerPtr->Period;
+                if (TimerPtr->Expires <= WheelPtr->Now) {
+                    TimerPtr->Expires = WheelPtr->Now + 1U;
+                }
+                TimerPtr->IsActive = TRUE;
+                Place(WheelPtr, TimerPtr);
+            }
+
+            TimerPtr->Handler(TimerPtr, TimerPtr->CallBackRef);
+            Fired++;
+        }
+    }
+
+    WheelPtr->Fired += Fired;
+    return Fired;
+}
+
+/* ------------------------------------------------------------
+ * AXI timer binding
+ * ------------------------------------------------------------ */
+
+/* Cycles real time is past tick Now. Expired: called from the
+ * interrupt after Now was advanced to Armed, with the counter already
+ * running its auto-reload.
+ */
+static u32 HwLag(const TWheel *WheelPtr, int Expired)
+{
+    u32 Tcr;
+    u32 Csr;
+    u64 Lag;
+
+    if (WheelPtr->Armed == TWHEEL_NO_EVENT) {
+        return 0;
+    }
+
+    if (Expired) {
+        /* Handler outlasted a whole reload period, count it once */
+        Csr = XTmrCtr_ReadReg(WheelPtr->BaseAddress, 0, XTC_TCSR_OFFSET);
+        Tcr = XTmrCtr_ReadReg(WheelPtr->BaseAddress, 0, XTC_TCR_OFFSET);
+
+        /* Counting restarted from LoadedCycles one cycle after expiry */
+        Lag = (u64)WheelPtr->Late + (WheelPtr->LoadedCycles - Tcr) + 1U;
+        if ((Csr & XTC_CSR_INT_OCCURED_MASK) != 0) {
+            Lag += (u64)WheelPtr->LoadedCycles + 2U;
+        }
+        return (u32)Lag;
+    }
+
+    Tcr = XTmrCtr_ReadReg(WheelPtr->BaseAddress, 0, XTC_TCR_OFFSET);
+
+    /* Tcr + 1 cycles are left until the expiry */
+    Lag = (WheelPtr->Armed - WheelPtr->Now) * TWHEEL_TICK_CYCLES +
+          WheelPtr->Late;
+    return (Lag > (u64)Tcr + 1U) ? (u32)(Lag - Tcr - 1U) : 0U;
+}
+
+/* Cycles from sampling TCR to the counter running again on a re-arm,
+ * timed on the counter itself. The re-arm's TLR and TCSR writes
+ * between two TCR reads take Total cycles when they leave the count
+ * running; after a real reload the second read shows how long the
+ * counter has been running again. The rest went before the restart.
+ * Leaves the counter stopped.
+ */
+static u32 HwCalibrate(UINTPTR BaseAddress)
+{
+    u32 Total = 0;
+    u32 Running = 0;
+    u32 Before;
+    u32 After;
+    u32 i;
+
+    XTmrCtr_WriteReg(BaseAddress, 0, XTC_TLR_OFFSET, 0xFFFFFFFFU);
+    XTmrCtr_WriteReg(BaseAddress, 0, XTC_TCSR_OFFSET,
+                     XTC_CSR_INT_OCCURED_MASK | XTC_CSR_LOAD_MASK);
+    XTmrCtr_WriteReg(BaseAddress, 0, XTC_TCSR_OFFSET,
+                     XTC_CSR_ENABLE_TMR_MASK | XTC_CSR_DOWN_COUNT_MASK);
+
+    for (i = 0; i < TWHEEL_CALIBRATE_RUNS; i++) {
+        Before = XTmrCtr_ReadReg(BaseAddress, 0, XTC_TCR_OFFSET);
+        XTmrCtr_WriteReg(BaseAddress, 0, XTC_TLR_OFFSET, 0xFFFFFFFFU);
+        XTmrCtr_WriteReg(BaseAddress, 0, XTC_TCSR_OFFSET,
+                         XTC_CSR_ENABLE_TMR_MASK | XTC_CSR_DOWN_COUNT_MASK);
+        XTmrCtr_WriteReg(BaseAddress, 0, XTC_TCSR_OFFSET,
+                         XTC_CSR_ENABLE_TMR_MASK | XTC_CSR_DOWN_COUNT_MASK);
+        After = XTmrCtr_ReadReg(BaseAddress, 0, XTC_TCR_OFFSET);
+        Total += Before - After;
+
+        XTmrCtr_WriteReg(BaseAddress, 0, XTC_TLR_OFFSET, 0xFFFFFFFFU);
+        XTmrCtr_WriteReg(BaseAddress, 0, XTC_TCSR_OFFSET,
+                         XTC_CSR_INT_OCCURED_MASK | XTC_CSR_LOAD_MASK);
+        XTmrCtr_WriteReg(BaseAddress, 0, XTC_TCSR_OFFSET,
+                         XTC_CSR_ENABLE_TMR_MASK | XTC_CSR_DOWN_COUNT_MASK);
+        After = XTmrCtr_ReadReg(BaseAddress, 0, XTC_TCR_OFFSET);
+        Running += 0xFFFFFFFFU - After;
+    }
+    XTmrCtr_WriteReg(BaseAddress, 0, XTC_TCSR_OFFSET, 0);
+
+    return (Total > Running) ?
+           (Total - Running + TWHEEL_CALIBRATE_RUNS / 2U) /
+           TWHEEL_CALIBRATE_RUNS : 0U;
+}
+
+/* Load the counter to expire on the next event's tick boundary, or
+ * stop it if idle
+ */
+static void HwProgram(TWheel *WheelPtr, int Expired)
+{
+    u64 Next = TWheel_NextEvent(WheelPtr);
+    u64 Delta;
+    u64 Target;
+    u64 Overhead;
+
+    if (Next == TWHEEL_NO_EVENT) {
+        XTmrCtr_WriteReg(WheelPtr->BaseAddress, 0, XTC_TCSR_OFFSET, 0);
+        WheelPtr->Armed = TWHEEL_NO_EVENT;
+        WheelPtr->Late = 0;
+        return;
+    }
+
+    Delta = (Next > WheelPtr->Now) ? (Next - WheelPtr->Now) : 1U;
+    if (Delta > TWHEEL_MAX_HW_TICKS) {
+        /* Intermediate wakeup, fires nothing */
+        Delta = TWHEEL_MAX_HW_TICKS;
+    }
+
+    /* The count starts ReloadCycles after the lag sample and expires
+     * LoadedCycles + 1 cycles later
+     */
+    Target = Delta * TWHEEL_TICK_CYCLES;
+    Overhead = (u64)HwLag(WheelPtr, Expired) + WheelPtr->ReloadCycles + 1U;
+    if (Target >= Overhead + TWHEEL_MIN_LOAD_CYCLES) {
+        WheelPtr->LoadedCycles = (u32)(Target - Overhead);
+        WheelPtr->Late = 0;
+    } else {
+        /* Already past the event, expire as soon as allowed */
+        WheelPtr->LoadedCycles = TWHEEL_MIN_LOAD_CYCLES;
+        WheelPtr->Late = (u32)(Overhead + TWHEEL_MIN_LOAD_CYCLES - Target);
+    }
+    WheelPtr->Armed = WheelPtr->Now + Delta;
+
+    XTmrCtr_WriteReg(WheelPtr->BaseAddress, 0, XTC_TLR_OFFSET,
+                     WheelPtr->LoadedCycles);
+    XTmrCtr_WriteReg(WheelPtr->BaseAddress, 0, XTC_TCSR_OFFSET,
+                     XTC_CSR_INT_OCCURED_MASK | XTC_CSR_LOAD_MASK);
+    XTmrCtr_WriteReg(WheelPtr->BaseAddress, 0, XTC_TCSR_OFFSET,
+                     XTC_CSR_ENABLE_TMR_MASK | XTC_CSR_ENABLE_INT_MASK |
+                     XTC_CSR_AUTO_RELOAD_MASK | XTC_CSR_DOWN_COUNT_MASK);
+}
+
+/* Bring Now up to the time already spent in the current interval,
+ * short of Armed so nothing fires outside the ISR
+ */
+static void HwSync(TWheel *WheelPtr)
+{
+    u32 Tcr;
+    u64 Before;
+    u64 HwNow;
+
+    if (WheelPtr->Armed == TWHEEL_NO_EVENT) {
+        return;
+    }
+
+    /* Tcr + 1 cycles to the expiry, which is Late cycles after Armed */
+    Tcr = XTmrCtr_ReadReg(WheelPtr->BaseAddress, 0, XTC_TCR_OFFSET);
+    Before = (u64)Tcr + 1U;
+    if (Before <= WheelPtr->Late) {
+        HwNow = WheelPtr->Armed;
+    } else {
+        Before -= WheelPtr->Late;
+        HwNow = WheelPtr->Armed -
+                (Before + TWHEEL_TICK_CYCLES - 1U) / TWHEEL_TICK_CYCLES;
+    }
+    if (HwNow >= WheelPtr->Armed) {
+        HwNow = WheelPtr->Armed - 1U;
+    }
+    if (HwNow > WheelPtr->Now) {
+        TWheel_Advance(WheelPtr, HwNow);
+    }
+}
+
+/* ------------------------------------------------------------
+ * Arm a timer from thread context. Re-arms the counter if the new
+ * timer is due before the current one-shot interval ends.
+ * ------------------------------------------------------------ */
+void TWheel_Schedule(TWheel *WheelPtr, TWheelTimer *TimerPtr, u32 Delay,
+                     u32 Period)
+{
+    Xil_ExceptionDisable();
+    TWheel_ScheduleFromIsr(WheelPtr, TimerPtr, Delay, Period);
+    Xil_ExceptionEnable();
+}
+
+/* ------------------------------------------------------------
+ * Same, from the handler of another interrupt, which already runs
+ * masked. Wheel callbacks use TWheel_Add(): the counter is re-armed
+ * when the wheel handler returns.
+ * ------------------------------------------------------------ */
+void TWheel_ScheduleFromIsr(TWheel *WheelPtr, TWheelTimer *TimerPtr,
+                            u32 Delay, u32 Period)
+{
+    HwSync(WheelPtr);
+    TWheel_Add(WheelPtr, TimerPtr, Delay, Period);
+    if (TimerPtr->Expires < WheelPtr->Armed) {
+        HwProgram(WheelPtr, FALSE);
+    }
+}
+
+/* ------------------------------------------------------------
+ * Cancel a timer from thread context. The counter is left alone;
+ * at worst it wakes once with nothing to fire.
+ * ------------------------------------------------------------ */
+void TWheel_Stop(TWheel *WheelPtr, TWheelTimer *TimerPtr)
+{
+    Xil_ExceptionDisable();
+    TWheel_Cancel(WheelPtr, TimerPtr);
+    Xil_ExceptionEnable();
+}
+
+/* ------------------------------------------------------------
+ * Interrupt handler to pass to XSetupInterruptSystem(). Acks T0INT,
+ * fires everything due at the armed tick and re-arms the counter.
+ * ------------------------------------------------------------ */
+void TWheel_InterruptHandler(void *CallBackRef)
+{
+    TWheel *WheelPtr = (TWheel *)CallBackRef;
+    u32 Csr = XTmrCtr_ReadReg(WheelPtr->BaseAddress, 0, XTC_TCSR_OFFSET);
+
+    if ((Csr & XTC_CSR_INT_OCCURED_MASK) == 0) {
+        return;
+    }
+    XTmrCtr_WriteReg(WheelPtr->BaseAddress, 0, XTC_TCSR_OFFSET, Csr);
+
+    WheelPtr->Wakeups++;
+    if (WheelPtr->Armed != TWHEEL_NO_EVENT) {
+        TWheel_Advance(WheelPtr, WheelPtr->Armed);
+    }
+    HwProgram(WheelPtr, TRUE);
+}
@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Software timer wheel on the single AXI timer counter
+ *
+ * The PL timer is built with one counter only, so any number of
+ * software timers are multiplexed onto it. Timers live in a
+ * hierarchical wheel of TWHEEL_LEVELS levels x 64 slots; level n holds
+ * timers due in less than 64^(n+1) ticks and is cascaded into the
+ * levels below when its slot comes up. Each level keeps a 64-bit
+ * occupancy bitmap, so the next event is found without walking empty
+ * slots, and insert/cancel are O(1) list operations.
+ *
+ * The counter is always loaded for the nearest event;
+ * TWheel_InterruptHandler() fires every timer due at that tick in one
+ * batch and re-arms the counter. The counter runs auto-reload, so after
+ * expiring it keeps counting and the re-arm can measure how late it is;
+ * the next interval is shortened by that much and wheel time stays
+ * locked to the timer clock however long the handler takes. The time
+ * the re-arm itself takes, from sampling TCR to the counter running
+ * again, is timed on the counter by TWheel_Init() and taken off too.
+ *
+ * Time unit is one wheel tick = TWHEEL_TICK_CYCLES timer clock cycles.
+ ******************************************************************************/
+
+#ifndef TWHEEL_H_
+#define TWHEEL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+/* 1,000 cycles = 10 us at 100 MHz */
+#ifndef TWHEEL_TICK_CYCLES
+#define TWHEEL_TICK_CYCLES  1000U
+#endif
+
+#define TWHEEL_LEVEL_BITS   6U
+#define TWHEEL_SLOTS        (1U << TWHEEL_LEVEL_BITS)
+#define TWHEEL_LEVELS       4U
+/* Largest delay held exactly, longer ones are re-cascaded */
+#define TWHEEL_RANGE        ((u64)1U << (TWHEEL_LEVEL_BITS * TWHEEL_LEVELS))
+
+#define TWHEEL_NO_EVENT     (~(u64)0)
+
+typedef struct TWheelLink {
+    struct TWheelLink *Next;
+    struct TWheelLink *Prev;
+} TWheelLink;
+
+typedef struct TWheelTimer TWheelTimer;
+
+typedef void (*TWheel_Handler)(TWheelTimer *TimerPtr, void *CallBackRef);
+
+struct TWheelTimer {
+    TWheelLink Link;        /* Must stay first */
+    u64 Expires;            /* Absolute tick */
+    u32 Period;             /* Ticks, 0 for one-shot */
+    u8 Level;
+    u8 Slot;
+    u8 IsActive;
+    TWheel_Handler Handler;
+    void *CallBackRef;
+};
+
+typedef struct {
+    TWheelLink Slot[TWHEEL_LEVELS][TWHEEL_SLOTS];
+    u64 Occupied[TWHEEL_LEVELS];    /* Bit n set: Slot[level][n] not empty */
+    u64 Now;                        /* Current tick */
+
+    /* AXI timer binding */
+    UINTPTR BaseAddress;
+    u64 Armed;                      /* Tick the counter expires at */
+    u32 LoadedCycles;               /* Value written to TLR */
+    u32 Late;                       /* Cycles the expiry falls after Armed */
+    u32 ReloadCycles;               /* TCR sample to counting again, timed */
+    u32 Fired;                      /* Callbacks run */
+    u32 Wakeups;                    /* Counter expiries */
+} TWheel;
+
+/* Core wheel, caller serializes access */
+void TWheel_Init(TWheel *WheelPtr, UINTPTR BaseAddress);
+void TWheel_TimerInit(TWheelTimer *TimerPtr, TWheel_Handler Handler,
+                      void *CallBackRef);
+void TWheel_Add(TWheel *WheelPtr, TWheelTimer *TimerPtr, u32 Delay,
+                u32 Period);
+void TWheel_Cancel(TWheel *WheelPtr, TWheelTimer *TimerPtr);
+u64 TWheel_NextEvent(const TWheel *WheelPtr);
+u32 TWheel_Advance(TWheel *WheelPtr, u64 Target);
+
+/* AXI timer binding, safe to call from thread context */
+void TWheel_Schedule(TWheel *WheelPtr, TWheelTimer *TimerPtr, u32 Delay,
+                     u32 Period);
+void TWheel_Stop(TWheel *WheelPtr, TWheelTimer *TimerPtr);
+/* From another device's interrupt handler */
+void TWheel_ScheduleFromIsr(TWheel *WheelPtr, TWheelTimer *TimerPtr,
+                            u32 Delay, u32 Period);
+void TWheel_InterruptHandler(void *CallBackRef);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
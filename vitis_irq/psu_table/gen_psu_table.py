@@ -0,0 +1,571 @@
+#!/usr/bin/env python3
+"""Generate psu_init_table.c from a Vivado generated psu_init.c.
+
+Every psu_*() function whose body is nothing but PSU_Mask_Write(),
+mask_poll(), mask_pollOnValue() and mask_delay() calls followed by
+"return 1;" is replaced by a const PsuOp table and a one line body that
+runs it through PsuTable_Run() (psu_table.h). Everything else in the file
+is copied unchanged, so the output is a drop-in replacement for
+psu_init.c with the same psu_init.h API.
+
+Unless --no-optimize is given the op lists are then optimized: a write
+immediately followed by a write to a different field of the same
+register is folded into one record (writes whose masks overlap are kept
+apart, they are usually assert/release pulses), and writes that cover
+all 32 bits are done without the read-back, both in PsuTable_Run() and
+in the PSU_Mask_Write() still called by the remaining C code. Polls and
+delays are barriers; nothing moves across them or across a write to
+another register. Registers where each write is a hardware step of its
+own - PLL control, resets, bypass selects (NO_FOLD) - are never folded:
+psu_init.c programs FBDIV, then sets BYPASS, then asserts RESET, and one
+write doing all three is not the same sequence. The APB transactions
+saved are reported on stdout. On the ZUBoard export nearly all of them
+come from the full-mask writes; only one pair of writes folds, outside
+psu_init().
+
+The open-coded register waits left in the C code (DDR PHY bring-up) are
+turned into PSU_WAIT() calls, which time out and fail the stage instead
+of hanging (psu_table.h), and each stage psu_init() runs is
+wrapped in PSU_PROF_STAGE(), so a PSU_PROF build can profile the whole
+boot (psu_prof.h). Both are no-ops for the generated code otherwise.
+psu_init() starts the generic counter before its first stage
+(PsuTable_StartCounter()): psu_init.c only starts it in
+psu_peripherals_init_data(), and until then the poll budgets and the
+profile timestamps would read a stopped counter.
+
+The DDR PHY training part of psu_ddr_phybringup_data() - from the first
+PIR write that starts a training step to the last wait on PGSR0 - is
+moved into psu_ddr_phybringup_train() and called through PSU_DDR_TRAIN(),
+so a PSU_DDR_CACHE build can restore a saved result instead
+(psu_ddr_cache.h). The writes after it, which hand the DRAM back to the
+controller (ZQCTL0, RFSHCTL3), go to psu_ddr_phybringup_post(), so the
+cache can check a restored result once refresh is running. PsuDdrConfigId, a CRC-32 of psu_ddr_init_data() and
+psu_ddr_phybringup_data() as found in psu_init.c, ties saved results to
+the configuration they were trained with.
+
+psu_peripherals_init_data() is also cut into per-peripheral units at the
+section headings Vivado puts in it (ENET, QSPI, USB RESET, SD, ...) and
+written to psu_periph_units.c/.h next to the output: one op table per
+unit, in source order and optimized within the unit only, plus the unit
+table with each unit's dependencies (UNIT_DEPS). A PSU_PERIPH_LAZY build
+runs only the units the boot needs and leaves the rest to
+PsuPeriph_Require() on first use (psu_periph.h); otherwise
+psu_peripherals_init_data() runs its original table as before.
+
+Usage:
+    gen_psu_table.py [--no-optimize] [psu_init.c] [psu_init_table.c]
+"""
+
+import os
+import re
+import sys
+import zlib
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_IN = os.path.join(HERE, "..", "platform2", "hw", "sdt", "psu_init.c")
+DEFAULT_OUT = os.path.join(HERE, "psu_init_table.c")
+
+NUM = r"(?:0[xX][0-9A-Fa-f]+|\d+)[uUlL]*"
+ARG = r"(?:\w+|" + NUM + r")"
+
+STATEMENTS = [
+    ("PSU_WRITE", re.compile(r"PSU_Mask_Write\((%s),(%s),(%s)\)$" % (ARG, NUM, NUM))),
+    ("PSU_POLL", re.compile(r"mask_poll\((%s),(%s)\)$" % (ARG, NUM))),
+    ("PSU_POLL_VALUE", re.compile(r"mask_pollOnValue\((%s),(%s),(%s)\)$" % (ARG, NUM, NUM))),
+    ("PSU_DELAY", re.compile(r"mask_delay\((%s)\)$" % NUM)),
+]
+
+FUNC_START = re.compile(r"^unsigned long (psu_\w+)\(void\)\n\{\n", re.M)
+
+HELPERS = ["mask_pollOnValue", "mask_poll", "mask_delay", "mask_read"]
+
+COMMENT = r"/\*(?:(?!\*/).)*\*/"
+SKIP = r"(?:\s|%s)*" % COMMENT
+
+# while ((Xil_In32(A) & M) != V) { }
+WAIT_LOOP = re.compile(
+    r"while \(\(Xil_In32\((%s)\) & (%s)\) != (%s)\) \{%s\}"
+    % (NUM, NUM, NUM, SKIP), re.S)
+
+# regval = Xil_In32(A); while ((regval & M) != V) { regval = Xil_In32(A); }
+WAIT_REGVAL = re.compile(
+    r"(\w+) = Xil_In32\((%s)\);([ \t]*%s)?(%s)"
+    r"while \((?:\(\1 & (%s)\)|\1) != (%s)\) \{%s"
+    r"\1 = Xil_In32\(\2\);%s\}" % (NUM, COMMENT, SKIP, NUM, NUM, SKIP, SKIP),
+    re.S)
+
+STAGE_FUNCS = [r"int\s+psu_init\(void\)", r"int psu_init_ddr_self_refresh\(void\)"]
+STAGE_CALL = re.compile(r"^(\s*)((?:status &=\s*)?)(\w+)\(\);$", re.M)
+
+FULL_MASK = 0xFFFFFFFF
+
+# Register names whose writes are never folded: PLL control (PS PLLs and
+# the DDR PHY PLLs), reset and bypass registers
+NO_FOLD = re.compile(r"(?:PLL_CTRL|PLLCR0)_OFFSET$|_RST_|BYPASS")
+
+PHY_FUNC = "psu_ddr_phybringup_data"
+PHY_CONFIG_FUNCS = ["psu_ddr_init_data", PHY_FUNC]
+# PIR steps that train: WL, QSGATE, WLADJ, RD/WRDSKW, RD/WREYE, VREF
+PIR_TRAIN = 0x0002FE00
+# A PIR write, with the PGCR1 write set up for it if there is one
+PIR_WRITE = re.compile(
+    r"^(?:[ \t]*prog_reg\(0xFD080014U?,[^\n]*\n)?"
+    r"[ \t]*Xil_Out32\(0xFD080004U?, (%s)\);" % NUM, re.M)
+PGSR0_WAIT = re.compile(r"^[ \t]*PSU_WAIT\(0xFD080030U?,[^\n]*\n", re.M)
+
+PERIPH_FUNC = "psu_peripherals_init_data"
+HEADING = re.compile(r"/\*[ \t]*\n[ \t]*\*[ \t]*([A-Z][A-Z0-9 _/]*?)[ \t]*\n[ \t]*\*/")
+
+# Section heading -> unit; other headings continue the unit before them
+UNIT_HEADINGS = {
+    "COHERENCY": "core", "FPD RESET": "core", "RESET BLOCKS": "core",
+    "ENET": "enet", "QSPI": "qspi", "QSPI TAP DELAY": "iou_tapdly",
+    "NAND": "nand", "USB RESET": "usb", "SD": "sd", "CAN": "can",
+    "I2C": "i2c", "SWDT": "swdt", "SPI": "spi", "TTC": "ttc",
+    "TTC SRC SELECT": "ttc", "UART": "uart", "GPIO": "gpio",
+    "GPIO POLARITY INITIALIZATION": "gpio", "ADMA TZ": "adma",
+    "CSU TAMPERING": "csu", "CPU QOS DEFAULT": "qos",
+    "ENABLES RTC SWITCH TO BATTERY WHEN VCC_PSAUX IS NOT AVAILABLE": "rtc",
+    "TIMESTAMP COUNTER": "timestamp",
+}
+
+# Units nothing before main() needs; the rest always run at boot.
+# The generic counter (timestamp), console UART and the security and
+# QoS setup are needed by the FSBL itself.
+LAZY_UNITS = ["enet", "qspi", "iou_tapdly", "nand", "usb", "sd", "can",
+              "i2c", "swdt", "spi", "ttc", "gpio"]
+
+# Units that must have run before a unit; the tap delay bypass is shared
+# by the QSPI and NAND controllers
+UNIT_DEPS = {
+    "qspi": ["iou_tapdly"],
+    "nand": ["iou_tapdly"],
+}
+
+TRAIN_FUNC = """/*
+ * DDR PHY training, split out of %s() by gen_psu_table.py
+ * so that PSU_DDR_CACHE builds can restore a saved result (psu_ddr_cache.h)
+ */
+const u32 PsuDdrConfigId = 0x%08XU;
+
+static unsigned long psu_ddr_phybringup_train(void)
+{
+\tunsigned int regval = 0;
+
+%s
+\treturn 1;
+}
+
+static unsigned long psu_ddr_phybringup_post(void)
+{
+%s
+\treturn 1;
+}
+
+"""
+
+TRAIN_CALL = """\tif (!PSU_DDR_TRAIN(psu_ddr_phybringup_train,
+\t\t\t   psu_ddr_phybringup_post))
+\t\treturn(0);
+"""
+
+MASK_WRITE_BODY = """\tunsigned long RegVal = 0x0;
+
+\tRegVal = Xil_In32(offset);
+\tRegVal &= ~(mask);
+\tRegVal |= (val & mask);
+\tXil_Out32(offset, RegVal);
+"""
+
+MASK_WRITE_FAST = """\tunsigned long RegVal = val;
+
+\tif ((mask & 0xFFFFFFFFUL) != 0xFFFFFFFFUL) {
+\t\tRegVal = Xil_In32(offset);
+\t\tRegVal &= ~(mask);
+\t\tRegVal |= (val & mask);
+\t}
+\tXil_Out32(offset, RegVal);
+"""
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", " ", text, flags=re.S)
+    return re.sub(r"//[^\n]*", " ", text)
+
+
+def parse_stmts(text):
+    """Return the op list for straight-line statements, or None."""
+    stmts = [re.sub(r"\s+", "", s) for s in strip_comments(text).split(";")]
+    return parse_list([s for s in stmts if s])
+
+
+def parse_ops(body):
+    """Return the op list for a straight-line body, or None."""
+    stmts = [re.sub(r"\s+", "", s) for s in strip_comments(body).split(";")]
+    stmts = [s for s in stmts if s]
+    if not stmts or stmts[-1] != "return1":
+        return None
+    return parse_list(stmts[:-1])
+
+
+def parse_list(stmts):
+    ops = []
+    for stmt in stmts:
+        for kind, pattern in STATEMENTS:
+            match = pattern.match(stmt)
+            if match:
+                ops.append((kind, match.groups()))
+                break
+        else:
+            return None
+    return ops
+
+
+def number(text):
+    return int(text.rstrip("uUlL"), 0)
+
+
+def apb_cost(op, optimized):
+    """APB transactions of one write record, None for polls/delays."""
+    kind, args = op
+    if kind != "PSU_WRITE":
+        return None
+    return 1 if optimized and number(args[1]) == FULL_MASK else 2
+
+
+def optimize(ops):
+    """Fold adjacent disjoint-field writes to the same register."""
+    out = []
+    for op in ops:
+        prev = out[-1] if out else None
+        if (prev is not None and op[0] == "PSU_WRITE" and
+                prev[0] == "PSU_WRITE" and prev[1][0] == op[1][0] and
+                NO_FOLD.search(op[1][0]) is None and
+                (number(prev[1][1]) & number(op[1][1])) == 0):
+            mask = number(prev[1][1]) | number(op[1][1])
+            value = ((number(prev[1][2]) & number(prev[1][1])) |
+                     (number(op[1][2]) & number(op[1][1])))
+            out[-1] = ("PSU_WRITE",
+                       (op[1][0], "0x%08XU" % mask, "0x%08XU" % value))
+            continue
+        out.append(op)
+    return out
+
+
+def write_stats(ops, optimized):
+    costs = [apb_cost(op, optimized) for op in ops]
+    costs = [c for c in costs if c is not None]
+    return len(costs), costs.count(1), sum(costs)
+
+
+def table_name(func):
+    # psu_pll_init_data -> PsuPllInitOps
+    words = [w for w in func.split("_") if w != "data"]
+    return "".join(w.capitalize() for w in words) + "Ops"
+
+
+def function_end(text, start):
+    """Index just past the closing brace of the function body at start."""
+    depth = 0
+    i = text.index("{", start)
+    while True:
+        if text.startswith("/*", i):
+            i = text.index("*/", i) + 2
+            continue
+        if text.startswith("//", i):
+            i = text.index("\n", i) + 1
+            continue
+        if text[i] == "{":
+            depth += 1
+        elif text[i] == "}":
+            depth -= 1
+            if depth == 0:
+                return i + 1
+        i += 1
+
+
+def emit_ops(name, ops):
+    lines = ["static const PsuOp %s[] = {" % name]
+    for kind, args in ops:
+        lines.append("\t%s(%s)," % (kind, ", ".join(args)))
+    lines.append("};")
+    return lines
+
+
+def emit_table(func, ops):
+    name = table_name(func)
+    lines = emit_ops(name, ops)
+    if func == PERIPH_FUNC:
+        lines = ["#ifndef PSU_PERIPH_LAZY"] + lines + ["#endif"]
+    lines.append("")
+    lines.append("unsigned long %s(void)" % func)
+    lines.append("{")
+    if func == PERIPH_FUNC:
+        lines.append("#ifdef PSU_PERIPH_LAZY")
+        lines.append("\treturn PsuPeriph_Boot();")
+        lines.append("#else")
+        lines.append("\treturn PSU_TABLE_RUN(%s);" % name)
+        lines.append("#endif")
+    else:
+        lines.append("\treturn PSU_TABLE_RUN(%s);" % name)
+    lines.append("}")
+    return "\n".join(lines)
+
+
+def split_units(body):
+    """Cut a function body into [unit, ops] at its section headings."""
+    units = {}
+    unit = "core"
+    pos = 0
+    marks = list(HEADING.finditer(body)) + [None]
+    for mark in marks:
+        chunk = body[pos:mark.start() if mark else len(body)]
+        if mark is None:
+            chunk = re.sub(r"\breturn\s+1\s*;", "", chunk)
+        ops = parse_stmts(chunk)
+        if ops is None:
+            return None
+        units.setdefault(unit, []).extend(ops)
+        if mark is not None:
+            unit = UNIT_HEADINGS.get(mark.group(1), unit)
+            pos = mark.end()
+    return [[u, ops] for u, ops in units.items() if ops]
+
+
+def unit_macro(unit):
+    return "PSU_PERIPH_" + unit.upper()
+
+
+def emit_units(units, optimized, src_name):
+    """psu_periph_units.h and .c for the units of psu_peripherals_init_data()."""
+    names = [u for u, _ in units]
+
+    def reaches(unit, target, seen=()):
+        return any(dep == target or (dep not in seen and
+                                     reaches(dep, target, seen + (dep,)))
+                   for dep in UNIT_DEPS.get(unit, []))
+    for unit in UNIT_DEPS:
+        if reaches(unit, unit):
+            raise SystemExit("unit dependency cycle through %s" % unit)
+    lazy = [u for u in names if u in LAZY_UNITS]
+
+    banner = ["/*", " * Generated by gen_psu_table.py from %s, do not edit" % src_name,
+              " */", ""]
+    h = banner + ["#ifndef PSU_PERIPH_UNITS_H_", "#define PSU_PERIPH_UNITS_H_", ""]
+    h.append("/* Units of %s(), in source order */" % PERIPH_FUNC)
+    for i, unit in enumerate(names):
+        h.append("#define %-28s (1U << %d)" % (unit_macro(unit), i))
+    h.append("")
+    h.append("#define %-28s %dU" % ("PSU_PERIPH_NUM_UNITS", len(names)))
+    h.append("/* Units no boot stage needs */")
+    h.append("#define %-28s (%s)" % ("PSU_PERIPH_LAZY_UNITS",
+             " | \\\n\t".join(unit_macro(u) for u in lazy) or "0U"))
+    h += ["", "#endif", ""]
+
+    c = banner + ['#include "psu_init.h"', '#include "psu_periph.h"', ""]
+    rows = []
+    for unit, ops in units:
+        if optimized:
+            ops = optimize(ops)
+        name = "PsuPeriph%sOps" % "".join(w.capitalize() for w in unit.split("_"))
+        c += emit_ops(name, ops) + [""]
+        deps = [d for d in UNIT_DEPS.get(unit, []) if d in names]
+        _, _, apb = write_stats(ops, optimized)
+        delay = sum(number(args[0]) for kind, args in ops if kind == "PSU_DELAY")
+        polls = sum(1 for kind, _ in ops if kind.startswith("PSU_POLL"))
+        rows.append('\t{ "%s", %s, %dU, %s, %dU, %dU },' % (
+            unit, name, len(ops), " | ".join(unit_macro(d) for d in deps) or "0U",
+            apb + polls, delay))
+    c.append("const PsuPeriphUnit PsuPeriphUnits[PSU_PERIPH_NUM_UNITS] = {")
+    c += rows
+    c += ["};", ""]
+    return "\n".join(h), "\n".join(c), lazy
+
+
+def rewrite_waits(text):
+    """Route the open-coded register waits through PSU_WAIT()."""
+    text, loops = WAIT_LOOP.subn(
+        lambda m: "PSU_WAIT(%s, %s, %s);" % m.groups(), text)
+
+    # The value left in the variable is never used after these loops
+    def regval(m):
+        var, addr, comment, gap, mask, value = m.groups()
+        return "PSU_WAIT(%s, %s, %s);%s" % (
+            addr, mask or "0xFFFFFFFFU", value, comment or "")
+    text, waits = WAIT_REGVAL.subn(regval, text)
+    return text, loops + waits
+
+
+def wrap_stages(text):
+    """Put every call made by psu_init() into PSU_PROF_STAGE(), after
+    starting the generic counter."""
+    for pattern in STAGE_FUNCS:
+        match = re.search(r"^%s\s*\{" % pattern, text, re.M)
+        if match is None:
+            continue
+        end = function_end(text, match.start())
+        body = STAGE_CALL.sub(
+            lambda m: '%sPSU_PROF_STAGE("%s", %s%s());' % (
+                m.group(1), m.group(3), re.sub(r"\s+", " ", m.group(2)),
+                m.group(3)), text[match.end():end])
+        first = body.find("PSU_PROF_STAGE(")
+        if first >= 0:
+            body = body[:first] + "PsuTable_StartCounter();\n\t" + body[first:]
+        text = text[:match.end()] + body + text[end:]
+    return text
+
+
+def function_source(text, func):
+    match = re.search(r"^unsigned long %s\(void\)\n\{" % func, text, re.M)
+    if match is None:
+        return None, None
+    return match, function_end(text, match.start())
+
+
+def config_id(src):
+    """CRC-32 of the functions the trained PHY state depends on."""
+    crc = 0
+    for func in PHY_CONFIG_FUNCS:
+        match, end = function_source(src, func)
+        if match is not None:
+            crc = zlib.crc32(src[match.start():end].encode(), crc)
+    return crc
+
+
+def split_training(text, config):
+    """Move the PHY training steps into psu_ddr_phybringup_train()."""
+    match, end = function_source(text, PHY_FUNC)
+    if match is None:
+        return text, None
+    body = text[match.end():end]
+    start = next((m for m in PIR_WRITE.finditer(body)
+                  if number(m.group(1)) & PIR_TRAIN), None)
+    waits = list(PGSR0_WAIT.finditer(body))
+    if start is None or not waits or waits[-1].end() <= start.start():
+        return text, None
+    train = body[start.start():waits[-1].end()]
+    ret = body.rfind("return 1;")
+    if ret < waits[-1].end():
+        return text, None
+    post = body[waits[-1].end():ret].strip("\n")
+    body = body[:start.start()] + TRAIN_CALL + "\n" + body[ret:]
+    # Only the dummy MRSTAT reads are left using regval
+    reads = re.compile(r"\bregval = (Xil_In32\([^;]*\);)")
+    if (len(re.findall(r"\bregval\b", body)) ==
+            len(reads.findall(body)) + 1):
+        body = reads.sub(r"(void)\1", body)
+        body = re.sub(r"\n\tunsigned int regval = 0;\n", "\n", body, 1)
+    return (text[:match.start()] + TRAIN_FUNC % (PHY_FUNC, config, train, post) +
+            text[match.start():match.end()] + body + text[end:]), train
+
+
+def drop_unused_helpers(text):
+    """Remove static poll/delay helpers no longer called."""
+    for helper in HELPERS:
+        calls = len(re.findall(r"\b%s\(" % helper, strip_comments(text)))
+        proto = re.search(r"static \w+ %s\([^)]*\);\n\n?" % helper, text)
+        defn = re.search(r"static \w+ %s\([^)]*\)\n\{" % helper, text)
+        if calls > 2 or proto is None or defn is None:
+            continue
+        end = function_end(text, defn.start())
+        text = text[:defn.start()] + text[end:].lstrip("\n")
+        text = text[:proto.start()] + text[proto.end():]
+    return text
+
+
+def generate(src, optimized=True):
+    out = []
+    pos = 0
+    stats = []
+    units = None
+    for match in FUNC_START.finditer(src):
+        end = function_end(src, match.start())
+        ops = parse_ops(src[match.end():end - 1])
+        if not ops:
+            continue
+        if match.group(1) == PERIPH_FUNC:
+            units = split_units(src[match.end():end - 1])
+        before = write_stats(ops, False)
+        if optimized:
+            ops = optimize(ops)
+        out.append(src[pos:match.start()])
+        out.append(emit_table(match.group(1), ops))
+        pos = end
+        stats.append((match.group(1), len(ops), before,
+                      write_stats(ops, optimized)))
+    out.append(src[pos:])
+    text = "".join(out)
+
+    text = text.replace(
+        "* This file is automatically generated\n",
+        "* This file is automatically generated by gen_psu_table.py from\n"
+        "* psu_init.c, do not edit\n", 1)
+    text = text.replace('#include "psu_init.h"\n',
+                        '#include "psu_init.h"\n#include "psu_table.h"\n'
+                        '#include "psu_prof.h"\n#include "psu_ddr_cache.h"\n'
+                        '#include "psu_periph.h"\n', 1)
+    text, waits = rewrite_waits(text)
+    config = config_id(src)
+    text, train = split_training(text, config)
+    text = wrap_stages(text)
+    if optimized:
+        text = text.replace(MASK_WRITE_BODY, MASK_WRITE_FAST, 1)
+    training = (config, train.count("\n")) if train else None
+    return drop_unused_helpers(text), stats, waits, training, units
+
+
+def main():
+    args = sys.argv[1:]
+    optimized = "--no-optimize" not in args
+    args = [a for a in args if a != "--no-optimize"]
+    src_path = args[0] if len(args) > 0 else DEFAULT_IN
+    out_path = args[1] if len(args) > 1 else DEFAULT_OUT
+
+    with open(src_path) as f:
+        src = f.read()
+    text, stats, waits, training, units = generate(src, optimized)
+    with open(out_path, "w") as f:
+        f.write(text)
+    if units:
+        header, body, lazy = emit_units(units, optimized,
+                                        os.path.basename(src_path))
+        base = os.path.join(os.path.dirname(out_path), "psu_periph_units")
+        with open(base + ".h", "w") as f:
+            f.write(header)
+        with open(base + ".c", "w") as f:
+            f.write(body)
+
+    print("  %-36s %5s %13s %8s %13s"
+          % ("function", "ops", "writes", "no-read", "APB"))
+    total = [0, 0, 0, 0, 0, 0]
+    for func, count, before, after in stats:
+        print("  %-36s %5d %5d -> %-5d %8d %5d -> %-5d"
+              % (func, count, before[0], after[0], after[1],
+                 before[2], after[2]))
+        for i, n in enumerate((count, before[0], after[0], after[1],
+                               before[2], after[2])):
+            total[i] += n
+    print("  %-36s %5d %5d -> %-5d %8d %5d -> %-5d"
+          % ("total", total[0], total[1], total[2], total[3],
+             total[4], total[5]))
+    print("%d functions, %d ops -> %s (%d bytes of tables)"
+          % (len(stats), total[0], os.path.relpath(out_path), total[0] * 12))
+    print("write APB transactions removed: %d of %d (polls and delays"
+          " unchanged)" % (total[4] - total[5], total[4]))
+    print("%d open-coded register waits routed through PSU_WAIT()"
+          % waits)
+    if training:
+        print("%d lines of PHY training moved to psu_ddr_phybringup_train()"
+              " (config id 0x%08X)" % (training[1], training[0]))
+    else:
+        print("no PHY training found in %s(), PSU_DDR_CACHE has no effect"
+              % PHY_FUNC)
+    if units:
+        print("%s() split into %d units, %d deferrable: %s"
+              % (PERIPH_FUNC, len(units), len(lazy), " ".join(lazy)))
+    else:
+        print("%s() not split, PSU_PERIPH_LAZY has no effect" % PERIPH_FUNC)
+
+
+if __name__ == "__main__":
+    main()
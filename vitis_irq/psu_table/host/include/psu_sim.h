@@ -0,0 +1,83 @@
+/******************************************************************************
+ * psu_init host replay - PS register model
+ *
+ * psu_init_table.c, psu_table.c and psu_prof.c are built unchanged
+ * against the shim headers in this directory. Every register access
+ * lands in a sparse register file that remembers what was written and
+ * costs PSU_SIM_MMIO_TICKS on a virtual clock; usleep() advances it.
+ * The generic counter behind XTime_GetTime() counts that clock only
+ * while IOU_SCNTRS COUNTER_CONTROL has EN set, and reads 0 from power-on
+ * until it is first enabled, as on the board.
+ *
+ * The status registers psu_init() waits on are modelled just far enough
+ * for a good boot to complete:
+ *  - CRL/CRF PLL_STATUS lock bits rise PSU_SIM_PLL_LOCK_US after the
+ *    PLL leaves reset (PLL_CTRL.RESET 1 -> 0);
+ *  - DDR PHY PGSR0 replays the status sequence of a successful ZUBoard
+ *    training run, one step per PIR write with INIT set (psu_sim.c);
+ *  - DDRC STAT reports normal mode and the DATX8 lane status registers
+ *    report their PLLs locked;
+ *  - a PIR write that starts a training step fills the trained delay,
+ *    gate and Vref registers of the four wired byte lanes, and DRAM
+ *    (below 0x80000000) reads back what was written only while all of
+ *    them still hold those values, whether trained or restored, and
+ *    DDRC RFSHCTL3 has auto-refresh on.
+ * WFE returns at the next edge of the generic timer event stream set up
+ * in CNTKCTL_EL1; a WFE with the stream off or the counter stopped has
+ * nothing to wake it and stops the replay.
+ * The latencies are plausible orders of magnitude, not measurements, so
+ * the replay checks the shape of a boot profile, not board timing.
+ ******************************************************************************/
+
+#ifndef PSU_SIM_H_
+#define PSU_SIM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+/* Virtual clock, equal to the generic counter frequency */
+#define PSU_SIM_CLOCK_HZ        100000000U
+
+#ifndef PSU_SIM_MMIO_TICKS
+#define PSU_SIM_MMIO_TICKS      15U     /* One APB register access */
+#endif
+#ifndef PSU_SIM_PLL_LOCK_US
+#define PSU_SIM_PLL_LOCK_US     50U
+#endif
+
+typedef void (*PsuSimWriteHook)(u32 Addr, u32 Value);
+typedef void (*PsuSimReadHook)(u32 Addr, u32 Value);
+typedef void (*PsuSimRegVisitor)(u32 Addr, u32 Value);
+
+u32 PsuSim_Read32(UINTPTR Addr);
+void PsuSim_Write32(UINTPTR Addr, u32 Value);
+void PsuSim_Sleep(u64 Ticks);
+u64 PsuSim_Now(void);
+u64 PsuSim_Counter(void);
+void PsuSim_WaitForEvent(void);
+u64 PsuSim_ReadSysReg(const char *Name);
+void PsuSim_WriteSysReg(const char *Name, u64 Value);
+
+/* Back to power-on state, e.g. between the boots of a warm boot replay */
+void PsuSim_Reset(void);
+/* The PLL controlled by PllCtrl never locks, across resets too; 0 heals it */
+void PsuSim_BreakPll(u32 PllCtrl);
+/* Called with every register write before it takes effect */
+void PsuSim_SetWriteHook(PsuSimWriteHook WriteHook);
+/* Called with every register read and the value it returns */
+void PsuSim_SetReadHook(PsuSimReadHook OnRead);
+/* Calls Visit for every register no longer at its power-on value */
+void PsuSim_ForEachReg(PsuSimRegVisitor Visit);
+
+/* Register accesses and WFE wake-ups so far */
+u32 PsuSim_Reads(void);
+u32 PsuSim_Writes(void);
+u32 PsuSim_Events(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
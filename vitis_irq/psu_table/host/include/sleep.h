@@ -0,0 +1,12 @@
+/******************************************************************************
+ * Host replay shim - sleeping advances the virtual clock
+ ******************************************************************************/
+
+#ifndef SLEEP_H
+#define SLEEP_H
+
+#include "psu_sim.h"
+
+#define usleep(Us)  PsuSim_Sleep((u64)(Us) * (PSU_SIM_CLOCK_HZ / 1000000U))
+
+#endif
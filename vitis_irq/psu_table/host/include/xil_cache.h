@@ -0,0 +1,13 @@
+/******************************************************************************
+ * Host replay shim - the register model has no data cache
+ ******************************************************************************/
+
+#ifndef XIL_CACHE_H
+#define XIL_CACHE_H
+
+#include "xil_types.h"
+
+#define Xil_DCacheFlushRange(Addr, Len)         ((void)(Addr), (void)(Len))
+#define Xil_DCacheInvalidateRange(Addr, Len)    ((void)(Addr), (void)(Len))
+
+#endif
@@ -0,0 +1,21 @@
+/******************************************************************************
+ * Host replay shim - register access goes to the PS register model
+ ******************************************************************************/
+
+#ifndef XIL_IO_H
+#define XIL_IO_H
+
+#include "xil_types.h"
+#include "psu_sim.h"
+
+static inline u32 Xil_In32(UINTPTR Addr)
+{
+    return PsuSim_Read32(Addr);
+}
+
+static inline void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+    PsuSim_Write32(Addr, Value);
+}
+
+#endif
@@ -0,0 +1,18 @@
+/******************************************************************************
+ * Host replay shim - barriers, WFE and the generic timer control register
+ ******************************************************************************/
+
+#ifndef XPSEUDO_ASM_H
+#define XPSEUDO_ASM_H
+
+#include "psu_sim.h"
+
+#define dsb()           __sync_synchronize()
+#define isb()           __sync_synchronize()
+#define wfe()           PsuSim_WaitForEvent()
+
+/* Only CNTKCTL_EL1, which carries the event stream, is modelled */
+#define mfcp(Reg)       PsuSim_ReadSysReg(#Reg)
+#define mtcp(Reg, Val)  PsuSim_WriteSysReg(#Reg, (Val))
+
+#endif
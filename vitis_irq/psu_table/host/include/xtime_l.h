@@ -0,0 +1,16 @@
+/******************************************************************************
+ * Host replay shim - generic counter runs on the virtual clock
+ ******************************************************************************/
+
+#ifndef XTIME_L_H
+#define XTIME_L_H
+
+#include "xil_types.h"
+
+typedef u64 XTime;
+
+#define COUNTS_PER_SECOND   100000000U
+
+void XTime_GetTime(XTime *Xtime_Global);
+
+#endif
@@ -0,0 +1,254 @@
+/******************************************************************************
+ * psu_init host replay - run psu_init() against the register model and
+ * print the boot profile
+ *
+ *   psu_init_host               one cold boot
+ *   psu_init_host warm          cold boot, then a boot from the saved PHY
+ *                               training; checks that the restore writes
+ *                               exactly the saved register set, trains
+ *                               nothing and leaves the DRAM its pattern
+ *                               test used as it was
+ *   psu_init_host bad-blob      as warm with the blob corrupted; must train
+ *   psu_init_host bad-training  as warm with one saved delay wrong but the
+ *                               blob intact; must fail the check, train and
+ *                               save the same result as the cold boot
+ *   psu_init_host periph        cold boot, then bring up every deferred
+ *                               peripheral and print what each one saved
+ *   psu_init_host pll-timeout   cold boot, then a boot whose RPLL never
+ *                               locks and one whose does; the poll must
+ *                               give up after PSU_POLL_BUDGET_US on the
+ *                               generic counter, sleeping in WFE rather
+ *                               than spinning to the read cap, and the
+ *                               boot carry on
+ *
+ * The blob "survives" the reset between boots in this file, standing in
+ * for PsuDdrCache_Load()/PsuDdrCache_Store() on the board.
+ ******************************************************************************/
+
+#include "psu_init.h"
+#include "psu_prof.h"
+#include "psu_ddr_cache.h"
+#include "psu_periph.h"
+#include "psu_sim.h"
+#include <stdio.h>
+#include <string.h>
+
+#define DDR_PHY_PIR         0xFD080004U
+#define PIR_TRAIN           0x0002FE00U
+#define DDR_PHY_DX0_BASE    0xFD080700U
+#define DDR_PHY_DX_END      0xFD081000U
+#define CRL_APB_RPLL_CTRL   0xFF5E0030U
+#define MAX_LOGGED          (2U * PSU_DDR_CACHE_MAX_REGS)
+/* Counter start: a read and two writes ahead of the first stage */
+#define COUNTER_START_TICKS (3U * PSU_SIM_MMIO_TICKS)
+
+static const char *const StatusNames[] = {
+    "off", "hit", "miss", "stale", "rejected"
+};
+
+static PsuDdrCacheBlob Stored;
+static int HaveStored;
+static int Loaded;
+
+/* Lane register writes from the blob load on, and training steps */
+static PsuDdrCacheReg Logged[MAX_LOGGED];
+static u32 NumLogged;
+static u32 TrainingSteps;
+
+int PsuDdrCache_Load(PsuDdrCacheBlob *Blob)
+{
+    Loaded = 1;
+    if (!HaveStored) {
+        return 0;
+    }
+    *Blob = Stored;
+    return 1;
+}
+
+void PsuDdrCache_Store(const PsuDdrCacheBlob *Blob)
+{
+    Stored = *Blob;
+    HaveStored = 1;
+}
+
+static void OnWrite(u32 Addr, u32 Value)
+{
+    if ((Addr == DDR_PHY_PIR) && ((Value & PIR_TRAIN) != 0U)) {
+        TrainingSteps++;
+    }
+    if (Loaded && (Addr >= DDR_PHY_DX0_BASE) && (Addr < DDR_PHY_DX_END)) {
+        if (NumLogged < MAX_LOGGED) {
+            Logged[NumLogged].Addr = Addr;
+            Logged[NumLogged].Value = Value;
+        }
+        NumLogged++;
+    }
+}
+
+static int Expect(int Cond, const char *What)
+{
+    if (!Cond) {
+        fprintf(stderr, "[sim] FAIL: %s\n", What);
+    }
+    return Cond;
+}
+
+static u64 Boot(const char *Name, int *Ok)
+{
+    int Status;
+    u64 Us;
+
+    PsuSim_Reset();
+    PsuProf_Reset();
+    PsuSim_SetWriteHook(OnWrite);
+    Loaded = 0;
+    NumLogged = 0;
+    TrainingSteps = 0;
+
+    Status = psu_init();
+    Us = PsuSim_Now() / (PSU_SIM_CLOCK_HZ / 1000000U);
+
+    PsuProf_Report();
+    fflush(stdout);
+    fprintf(stderr, "[sim] %s: psu_init() = %d, %u reads, %u writes, %u WFE "
+            "wake-ups, %llu us, PHY cache %s, %u training steps\n",
+            Name, Status, (unsigned)PsuSim_Reads(),
+            (unsigned)PsuSim_Writes(), (unsigned)PsuSim_Events(),
+            (unsigned long long)Us, StatusNames[PsuDdrCache_Status()],
+            (unsigned)TrainingSteps);
+    *Ok = (Status == 0);
+    *Ok &= Expect(PsuSim_Now() - PsuSim_Counter() <= COUNTER_START_TICKS,
+                  "generic counter not running from the first stage");
+    return Us;
+}
+
+/* The restore wrote the saved registers, in order, and nothing else */
+static int CheckRestore(void)
+{
+    u32 i;
+
+    if (NumLogged != Stored.Count) {
+        fprintf(stderr, "[sim] restore wrote %u lane registers, blob has %u\n",
+                (unsigned)NumLogged, (unsigned)Stored.Count);
+        return 0;
+    }
+    for (i = 0; i < Stored.Count; i++) {
+        if ((Logged[i].Addr != Stored.Regs[i].Addr) ||
+            (Logged[i].Value != Stored.Regs[i].Value)) {
+            fprintf(stderr, "[sim] restore write %u: 0x%08X = 0x%08X, "
+                    "saved 0x%08X = 0x%08X\n", (unsigned)i,
+                    (unsigned)Logged[i].Addr, (unsigned)Logged[i].Value,
+                    (unsigned)Stored.Regs[i].Addr,
+                    (unsigned)Stored.Regs[i].Value);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* The model's DRAM powers up zeroed */
+static int CheckTestWords(void)
+{
+    u32 i;
+
+    for (i = 0; i < PSU_DDR_CACHE_TEST_WORDS; i++) {
+        if (PsuSim_Read32(PSU_DDR_CACHE_TEST_ADDR + (i * 4U)) != 0U) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    const char *Mode = (argc > 1) ? argv[1] : "cold";
+    PsuDdrCacheBlob Cold;
+    u32 LateReads;
+    u64 ColdUs;
+    u64 LateUs;
+    u64 WarmUs;
+    int Ok;
+    int Pass;
+
+    ColdUs = Boot("cold boot", &Ok);
+    if (strcmp(Mode, "cold") == 0) {
+        return Ok ? 0 : 1;
+    }
+    if (strcmp(Mode, "periph") == 0) {
+        Pass = Expect(Ok, "cold boot failed");
+        Pass &= Expect(PsuPeriph_Ready() == PSU_PERIPH_EAGER_UNITS,
+                       "boot ran deferred units");
+        Pass &= Expect(PsuPeriph_Require(PSU_PERIPH_LAZY_UNITS) != 0U,
+                       "deferred units failed");
+        Pass &= Expect(PsuPeriph_Ready() ==
+                       ((1U << PSU_PERIPH_NUM_UNITS) - 1U),
+                       "units left uninitialized");
+        PsuPeriph_Report();
+        fflush(stdout);
+        fprintf(stderr, "[sim] periph: %s\n", Pass ? "PASS" : "FAIL");
+        return Pass ? 0 : 1;
+    }
+    if (strcmp(Mode, "pll-timeout") == 0) {
+        /* Both from the saved training, so they differ in the poll only */
+        PsuSim_BreakPll(CRL_APB_RPLL_CTRL);
+        LateUs = Boot("RPLL never locks", &Ok);
+        LateReads = PsuSim_Reads();
+        Pass = Expect(Ok, "timeout not ignored");
+        PsuSim_BreakPll(0);
+        WarmUs = Boot("RPLL locks", &Ok);
+        LateUs -= WarmUs;
+        LateReads -= PsuSim_Reads();
+        /* Less the lock time the second boot waited */
+        Pass &= Expect((LateUs + 2U * PSU_SIM_PLL_LOCK_US >=
+                        PSU_POLL_BUDGET_US) &&
+                       (LateUs < 2U * PSU_POLL_BUDGET_US),
+                       "poll budget not kept on the generic counter");
+        Pass &= Expect(LateReads < PSU_TABLE_POLL_TIME / 100U,
+                       "poll spun instead of sleeping in WFE");
+        fprintf(stderr, "[sim] pll-timeout: %llu us and %u reads more than "
+                "with the PLL locking: %s\n", (unsigned long long)LateUs,
+                (unsigned)LateReads, Pass ? "PASS" : "FAIL");
+        return Pass ? 0 : 1;
+    }
+
+    Pass = Expect(Ok, "cold boot failed");
+    Pass &= Expect(HaveStored && (Stored.Count != 0U),
+                   "cold boot saved no training result");
+    Cold = Stored;
+
+    if (strcmp(Mode, "warm") == 0) {
+        WarmUs = Boot("warm boot", &Ok);
+        Pass &= Expect(Ok, "warm boot failed");
+        Pass &= Expect(PsuDdrCache_Status() == PSU_DDR_CACHE_HIT,
+                       "saved training not used");
+        Pass &= Expect(TrainingSteps == 0U, "warm boot trained");
+        Pass &= Expect(CheckRestore(), "restore did not write the saved set");
+        Pass &= Expect(CheckTestWords(), "pattern test left DRAM changed");
+        fprintf(stderr, "[sim] %u registers restored, %llu us saved of "
+                "%llu us\n", (unsigned)Stored.Count,
+                (unsigned long long)(ColdUs - WarmUs),
+                (unsigned long long)ColdUs);
+    } else if ((strcmp(Mode, "bad-blob") == 0) ||
+               (strcmp(Mode, "bad-training") == 0)) {
+        Stored.Regs[Stored.Count / 2U].Value ^= 0x00000010U;
+        if (strcmp(Mode, "bad-training") == 0) {
+            PsuDdrCache_Seal(&Stored);
+        }
+        (void)Boot(Mode, &Ok);
+        Pass &= Expect(Ok, "boot failed");
+        Pass &= Expect(PsuDdrCache_Status() ==
+                       ((strcmp(Mode, "bad-blob") == 0) ?
+                        PSU_DDR_CACHE_STALE : PSU_DDR_CACHE_REJECTED),
+                       "bad blob not detected");
+        Pass &= Expect(TrainingSteps != 0U, "no fallback to training");
+        Pass &= Expect(memcmp(&Stored, &Cold, sizeof(Cold)) == 0,
+                       "retrained result differs from the cold boot");
+    } else {
+        fprintf(stderr, "usage: %s [warm|bad-blob|bad-training|periph|"
+                "pll-timeout]\n", argv[0]);
+        return 2;
+    }
+
+    fprintf(stderr, "[sim] %s: %s\n", Mode, Pass ? "PASS" : "FAIL");
+    return Pass ? 0 : 1;
+}
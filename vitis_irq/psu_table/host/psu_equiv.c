@@ -0,0 +1,289 @@
+/******************************************************************************
+ * psu_init host replay - compare the register traces of two psu_init()
+ * builds (trace.c)
+ *
+ * Both traces are cut into runs: back-to-back writes to one register
+ * with no barrier between them. The two runs must line up one for one,
+ * on the same registers, and the final register state must be the same.
+ * Within a run:
+ *   - by default the writes must be the same, value for value, so the
+ *     write order of the two builds is identical;
+ *   - with --folded the second trace may leave writes out, as the
+ *     generator does when it folds a write into the next one, but what
+ *     it writes must be values the reference wrote, in its order, and
+ *     the last one must be the same. PLL control, reset and bypass
+ *     registers (NoFold) must still match write for write: each of
+ *     those writes is a step of its own, see gen_psu_table.py.
+ * Writes to the generic counter control (Counter) are left out: the
+ * generated psu_init() starts the counter before its first stage, where
+ * psu_init.c waits for psu_peripherals_init_data(). The final state
+ * still has to match.
+ *
+ *   psu_equiv [--folded] <reference trace> <trace>
+ ******************************************************************************/
+
+#include "xil_types.h"
+#include "psu_init.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_WRITES          65536U
+#define MAX_RUNS            65536U
+#define MAX_STATE           4096U
+
+typedef struct {
+    u32 Addr;
+    u32 First;          /* Index of the first write in Values */
+    u32 Count;
+} EquivRun;
+
+typedef struct {
+    const char *Name;
+    u32 Values[MAX_WRITES];
+    u32 NumWrites;
+    EquivRun Runs[MAX_RUNS];
+    u32 NumRuns;
+    u32 StateAddr[MAX_STATE];
+    u32 StateValue[MAX_STATE];
+    u32 NumState;
+} EquivTrace;
+
+/* Registers the generator must not fold, as NO_FOLD in gen_psu_table.py */
+static const u32 NoFold[] = {
+    CRL_APB_IOPLL_CTRL_OFFSET, CRL_APB_RPLL_CTRL_OFFSET,
+    CRF_APB_APLL_CTRL_OFFSET, CRF_APB_DPLL_CTRL_OFFSET,
+    CRF_APB_VPLL_CTRL_OFFSET,
+    CRL_APB_RST_LPD_IOU0_OFFSET, CRL_APB_RST_LPD_IOU2_OFFSET,
+    CRL_APB_RST_LPD_TOP_OFFSET, CRF_APB_RST_FPD_TOP_OFFSET,
+    CRF_APB_RST_DDR_SS_OFFSET,
+    IOU_SLCR_IOU_TAPDLY_BYPASS_OFFSET,
+    DDR_PHY_PLLCR0_OFFSET, DDR_PHY_DX8SL0PLLCR0_OFFSET,
+    DDR_PHY_DX8SL1PLLCR0_OFFSET, DDR_PHY_DX8SL2PLLCR0_OFFSET,
+    DDR_PHY_DX8SL3PLLCR0_OFFSET, DDR_PHY_DX8SL4PLLCR0_OFFSET,
+};
+
+/* IOU_SCNTRS frequency and control, see PsuTable_StartCounter() */
+static const u32 Counter[] = {
+    IOU_SCNTRS_COUNTER_CONTROL_REGISTER_OFFSET,
+    IOU_SCNTRS_BASE_FREQUENCY_ID_REGISTER_OFFSET,
+};
+
+static EquivTrace Ref;
+static EquivTrace Got;
+
+static int IsCounter(u32 Addr)
+{
+    u32 i;
+
+    for (i = 0; i < sizeof(Counter) / sizeof(Counter[0]); i++) {
+        if (Counter[i] == Addr) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int Load(EquivTrace *Trace, const char *Name)
+{
+    FILE *In = fopen(Name, "r");
+    char Line[64];
+    unsigned Addr;
+    unsigned Value;
+    int Barrier = 1;
+    EquivRun *Run = NULL;
+
+    if (In == NULL) {
+        perror(Name);
+        return 0;
+    }
+    Trace->Name = Name;
+    while (fgets(Line, sizeof(Line), In) != NULL) {
+        if (Line[0] == 'B') {
+            Barrier = 1;
+        } else if (sscanf(Line, "W %x %x", &Addr, &Value) == 2) {
+            if (IsCounter(Addr)) {
+                continue;
+            }
+            if ((Trace->NumWrites >= MAX_WRITES) ||
+                (Trace->NumRuns >= MAX_RUNS)) {
+                fprintf(stderr, "%s: too many writes\n", Name);
+                fclose(In);
+                return 0;
+            }
+            if (Barrier || (Run->Addr != Addr)) {
+                Run = &Trace->Runs[Trace->NumRuns++];
+                Run->Addr = Addr;
+                Run->First = Trace->NumWrites;
+                Run->Count = 0;
+            }
+            Trace->Values[Trace->NumWrites++] = Value;
+            Run->Count++;
+            Barrier = 0;
+        } else if (sscanf(Line, "S %x %x", &Addr, &Value) == 2) {
+            if (Trace->NumState >= MAX_STATE) {
+                fprintf(stderr, "%s: too many registers\n", Name);
+                fclose(In);
+                return 0;
+            }
+            Trace->StateAddr[Trace->NumState] = Addr;
+            Trace->StateValue[Trace->NumState] = Value;
+            Trace->NumState++;
+        }
+    }
+    fclose(In);
+    return 1;
+}
+
+static int Foldable(u32 Addr)
+{
+    u32 i;
+
+    for (i = 0; i < sizeof(NoFold) / sizeof(NoFold[0]); i++) {
+        if (NoFold[i] == Addr) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* The writes of GotRun are values of RefRun, in order, ending with its last */
+static int Folds(const EquivRun *RefRun, const EquivRun *GotRun)
+{
+    const u32 *RefValues = &Ref.Values[RefRun->First];
+    const u32 *GotValues = &Got.Values[GotRun->First];
+    u32 i = 0;
+    u32 j;
+
+    if ((GotRun->Count != RefRun->Count) && !Foldable(RefRun->Addr)) {
+        return 0;
+    }
+    if (RefValues[RefRun->Count - 1U] != GotValues[GotRun->Count - 1U]) {
+        return 0;
+    }
+    for (j = 0; j < GotRun->Count; j++) {
+        while ((i < RefRun->Count) && (RefValues[i] != GotValues[j])) {
+            i++;
+        }
+        if (i == RefRun->Count) {
+            return 0;
+        }
+        i++;
+    }
+    return 1;
+}
+
+static void PrintRun(const EquivTrace *Trace, u32 Index)
+{
+    const EquivRun *Run = &Trace->Runs[Index];
+    u32 i;
+
+    fprintf(stderr, "  %s, run %u: 0x%08X =", Trace->Name, (unsigned)Index,
+            (unsigned)Run->Addr);
+    for (i = 0; i < Run->Count; i++) {
+        fprintf(stderr, " 0x%08X", (unsigned)Trace->Values[Run->First + i]);
+    }
+    fprintf(stderr, "\n");
+}
+
+static u32 CompareRuns(int Folded)
+{
+    const EquivRun *RefRun;
+    const EquivRun *GotRun;
+    u32 Errors = 0;
+    u32 i;
+    int Same;
+
+    for (i = 0; (i < Ref.NumRuns) && (i < Got.NumRuns); i++) {
+        RefRun = &Ref.Runs[i];
+        GotRun = &Got.Runs[i];
+        Same = (RefRun->Addr == GotRun->Addr);
+        if (Same && Folded) {
+            Same = Folds(RefRun, GotRun);
+        } else if (Same) {
+            Same = (RefRun->Count == GotRun->Count) &&
+                   (memcmp(&Ref.Values[RefRun->First],
+                           &Got.Values[GotRun->First],
+                           RefRun->Count * sizeof(u32)) == 0);
+        }
+        if (!Same) {
+            if (Errors < 10U) {
+                fprintf(stderr, "write run %u differs:\n", (unsigned)i);
+                PrintRun(&Ref, i);
+                PrintRun(&Got, i);
+            }
+            Errors++;
+        }
+    }
+    if (Ref.NumRuns != Got.NumRuns) {
+        fprintf(stderr, "%s has %u write runs, %s %u\n", Ref.Name,
+                (unsigned)Ref.NumRuns, Got.Name, (unsigned)Got.NumRuns);
+        Errors++;
+    }
+    return Errors;
+}
+
+static u32 CompareState(void)
+{
+    u32 Errors = 0;
+    u32 i = 0;
+    u32 j = 0;
+
+    while ((i < Ref.NumState) || (j < Got.NumState)) {
+        if ((j == Got.NumState) ||
+            ((i < Ref.NumState) && (Ref.StateAddr[i] < Got.StateAddr[j]))) {
+            fprintf(stderr, "0x%08X = 0x%08X only in %s\n",
+                    (unsigned)Ref.StateAddr[i], (unsigned)Ref.StateValue[i],
+                    Ref.Name);
+            Errors++;
+            i++;
+        } else if ((i == Ref.NumState) ||
+                   (Got.StateAddr[j] < Ref.StateAddr[i])) {
+            fprintf(stderr, "0x%08X = 0x%08X only in %s\n",
+                    (unsigned)Got.StateAddr[j], (unsigned)Got.StateValue[j],
+                    Got.Name);
+            Errors++;
+            j++;
+        } else {
+            if (Ref.StateValue[i] != Got.StateValue[j]) {
+                fprintf(stderr, "0x%08X ends as 0x%08X in %s, 0x%08X in %s\n",
+                        (unsigned)Ref.StateAddr[i],
+                        (unsigned)Ref.StateValue[i], Ref.Name,
+                        (unsigned)Got.StateValue[j], Got.Name);
+                Errors++;
+            }
+            i++;
+            j++;
+        }
+    }
+    return Errors;
+}
+
+int main(int argc, char **argv)
+{
+    int Folded = (argc > 1) && (strcmp(argv[1], "--folded") == 0);
+    u32 Errors;
+
+    if (argc != 3 + Folded) {
+        fprintf(stderr, "usage: %s [--folded] <reference trace> <trace>\n",
+                argv[0]);
+        return 2;
+    }
+    if (!Load(&Ref, argv[1 + Folded]) || !Load(&Got, argv[2 + Folded])) {
+        return 2;
+    }
+
+    Errors = CompareRuns(Folded) + CompareState();
+    printf("%s: %u writes, %s: %u writes (%u folded away), %u runs, "
+           "%u registers changed\n", Ref.Name, (unsigned)Ref.NumWrites,
+           Got.Name, (unsigned)Got.NumWrites,
+           (unsigned)(Ref.NumWrites - Got.NumWrites), (unsigned)Ref.NumRuns,
+           (unsigned)Ref.NumState);
+    if (Errors != 0U) {
+        fprintf(stderr, "FAILED: %u difference(s)\n", (unsigned)Errors);
+        return 1;
+    }
+    printf("same final register state, same write order%s\n",
+           Folded ? " up to folded writes" : "");
+    return 0;
+}
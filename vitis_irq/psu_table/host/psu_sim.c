@@ -0,0 +1,470 @@
+/******************************************************************************
+ * psu_init host replay - PS register model - see psu_sim.h
+ ******************************************************************************/
+
+#include "psu_sim.h"
+#include "xtime_l.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_REGS            4096U   /* Sparse register file slots */
+#define SIM_US              (PSU_SIM_CLOCK_HZ / 1000000U)
+
+/* Registers with behaviour */
+#define CRL_APB_PLL_STATUS  0xFF5E0040U
+#define CRF_APB_PLL_STATUS  0xFD1A0044U
+#define PLL_CTRL_RESET      0x00000001U
+
+#define DDRC_RFSHCTL3       0xFD070060U
+#define RFSHCTL3_DIS_AUTO_REFRESH 0x00000001U
+
+#define DDR_PHY_PIR         0xFD080004U
+#define DDR_PHY_PGSR0       0xFD080030U
+#define PIR_INIT            0x00000001U
+#define PIR_TRAIN           0x0002FE00U     /* WL .. WREYE, VREF */
+#define PGSR0_IDONE         0x00000001U
+
+/* DATX8 lanes wired on the board (x32 LPDDR4) and the registers their
+ * training result lands in: GCR5/6, BDLR0-6, LCDLR0-5, MDLR0, GTR0 */
+#define DDR_PHY_DX0_BASE    0xFD080700U
+#define DDR_PHY_DX_STRIDE   0x100U
+#define SIM_DDR_LANES       4U
+#define SIM_DRAM_END        0x80000000U
+
+#define SCNTRS_COUNTER_CONTROL  0xFF260000U
+#define SCNTRS_EN               0x00000001U
+
+#define CNTKCTL_EVNTEN      0x004U
+#define CNTKCTL_EVNTDIR     0x008U
+#define CNTKCTL_EVNTI(Ctl)  (((Ctl) >> 4) & 0xFU)
+
+typedef struct {
+    u32 Addr;
+    u32 Value;
+    u8 Used;
+} SimReg;
+
+typedef struct {
+    u32 Ctrl;
+    u32 Status;
+    u32 LockBit;
+    u64 ReleasedAt;
+} SimPll;
+
+/* PGSR0 after a PIR write with INIT set: up to two values, each
+ * reached Us microseconds after the write */
+typedef struct {
+    u32 Us[2];
+    u32 Pgsr0[2];
+} SimPhyStep;
+
+static const struct {
+    u32 Addr;
+    u32 Value;
+} ResetValues[] = {
+    { 0xFD070004U, 0x00000001U },   /* DDRC STAT: normal operating mode */
+    { 0xFD0807E0U, 0x00010000U },   /* DX0GSR0: lane PLL locked */
+    { 0xFD0809E0U, 0x00010000U },   /* DX2GSR0: lane PLL locked */
+};
+
+static SimPll Plls[] = {
+    { 0xFF5E0020U, CRL_APB_PLL_STATUS, 0x1U, 0 },  /* IOPLL */
+    { 0xFF5E0030U, CRL_APB_PLL_STATUS, 0x2U, 0 },  /* RPLL */
+    { 0xFD1A0020U, CRF_APB_PLL_STATUS, 0x1U, 0 },  /* APLL */
+    { 0xFD1A002CU, CRF_APB_PLL_STATUS, 0x2U, 0 },  /* DPLL */
+    { 0xFD1A0038U, CRF_APB_PLL_STATUS, 0x4U, 0 },  /* VPLL */
+};
+
+/* The PIR sequence of psu_ddr_phybringup_data() on a good board */
+static const SimPhyStep PhySteps[] = {
+    { {   10,    0 }, { 0x80000001U, 0 } },            /* PHY PLL init */
+    { {   50,    0 }, { 0x8000000FU, 0 } },            /* ZCAL, DCAL */
+    { {  200,    0 }, { 0x8000001FU, 0 } },            /* DRAM init */
+    { { 1500, 3000 }, { 0x8000007EU, 0x80008FFFU } },  /* WL, gate, eye */
+    { {  500,    0 }, { 0x8000CFFFU, 0 } },            /* Vref training */
+    { {  300,    0 }, { 0x8000CFFFU, 0 } },            /* Rd/wr deskew */
+};
+
+static const u16 TrainedOffsets[] = {
+    0x014U, 0x018U, 0x040U, 0x044U, 0x048U, 0x050U, 0x054U, 0x058U, 0x060U,
+    0x080U, 0x084U, 0x088U, 0x08CU, 0x090U, 0x094U, 0x0A0U, 0x0C0U,
+};
+
+#define NUM_PLLS        (sizeof(Plls) / sizeof(Plls[0]))
+#define NUM_PHY_STEPS   (sizeof(PhySteps) / sizeof(PhySteps[0]))
+#define NUM_TRAINED     (sizeof(TrainedOffsets) / sizeof(TrainedOffsets[0]))
+
+static SimReg Regs[SIM_REGS];
+static u64 Now;
+static u32 Reads;
+static u32 Writes;
+static u32 Events;
+static u64 Cntkctl;
+
+/* Generic counter: Counted ticks up to CountingSince, counting if set */
+static u64 Counted;
+static u64 CountingSince;
+static int Counting;
+
+static u32 PhyStep;         /* Steps started so far */
+static u64 PhyStepAt;
+static u32 PhyBase;         /* PGSR0 while the current step runs */
+static u32 BrokenPll;        /* PLL_CTRL of a PLL that never locks */
+static PsuSimWriteHook Hook;
+static PsuSimReadHook ReadHook;
+
+/* ------------------------------------------------------------
+ * Sparse register file
+ * ------------------------------------------------------------ */
+static u32 ResetValue(u32 Addr)
+{
+    u32 i;
+
+    for (i = 0; i < sizeof(ResetValues) / sizeof(ResetValues[0]); i++) {
+        if (ResetValues[i].Addr == Addr) {
+            return ResetValues[i].Value;
+        }
+    }
+    return 0;
+}
+
+static SimReg *Lookup(u32 Addr)
+{
+    u32 Slot = (Addr * 2654435761U) % SIM_REGS;
+    u32 i;
+
+    for (i = 0; i < SIM_REGS; i++) {
+        SimReg *R = &Regs[(Slot + i) % SIM_REGS];
+
+        if (!R->Used) {
+            R->Used = 1;
+            R->Addr = Addr;
+            R->Value = ResetValue(Addr);
+            return R;
+        }
+        if (R->Addr == Addr) {
+            return R;
+        }
+    }
+
+    fprintf(stderr, "[sim] register file full at 0x%08X\n", (unsigned)Addr);
+    exit(2);
+}
+
+/* ------------------------------------------------------------
+ * Status registers
+ * ------------------------------------------------------------ */
+static u32 PllStatus(u32 Addr, u32 Value)
+{
+    u32 i;
+
+    for (i = 0; i < NUM_PLLS; i++) {
+        if ((Plls[i].Status == Addr) && (Plls[i].Ctrl != BrokenPll) &&
+            ((Lookup(Plls[i].Ctrl)->Value & PLL_CTRL_RESET) == 0U) &&
+            (Now >= Plls[i].ReleasedAt + PSU_SIM_PLL_LOCK_US * SIM_US)) {
+            Value |= Plls[i].LockBit;
+        }
+    }
+    return Value;
+}
+
+static void PllCtrl(u32 Addr, u32 Old, u32 Value)
+{
+    u32 i;
+
+    for (i = 0; i < NUM_PLLS; i++) {
+        if ((Plls[i].Ctrl == Addr) && ((Old & PLL_CTRL_RESET) != 0U) &&
+            ((Value & PLL_CTRL_RESET) == 0U)) {
+            Plls[i].ReleasedAt = Now;
+        }
+    }
+}
+
+static u32 PhyStatus(void)
+{
+    const SimPhyStep *Step;
+    u32 Value = PhyBase;
+    u32 i;
+
+    if (PhyStep == 0U) {
+        return Value;
+    }
+    Step = &PhySteps[PhyStep - 1U];
+    for (i = 0; (i < 2U) && (Step->Pgsr0[i] != 0U); i++) {
+        if (Now >= PhyStepAt + (u64)Step->Us[i] * SIM_US) {
+            Value = Step->Pgsr0[i];
+        }
+    }
+    return Value;
+}
+
+static void PhyTrigger(u32 Value)
+{
+    if (((Value & PIR_INIT) == 0U) || (PhyStep >= NUM_PHY_STEPS)) {
+        return;
+    }
+    PhyBase = PhyStatus() & ~PGSR0_IDONE;
+    PhyStepAt = Now;
+    PhyStep++;
+}
+
+/* ------------------------------------------------------------
+ * DRAM: data reads back only while refresh runs and every trained
+ * register holds what training put there, restored or not
+ * ------------------------------------------------------------ */
+static u32 TrainedValue(u32 Addr)
+{
+    return (Addr * 2654435761U) & 0x01FF01FFU;
+}
+
+static void PhyTrain(void)
+{
+    u32 Lane;
+    u32 i;
+    u32 Addr;
+
+    for (Lane = 0; Lane < SIM_DDR_LANES; Lane++) {
+        for (i = 0; i < NUM_TRAINED; i++) {
+            Addr = DDR_PHY_DX0_BASE + (Lane * DDR_PHY_DX_STRIDE) +
+                   TrainedOffsets[i];
+            Lookup(Addr)->Value = TrainedValue(Addr);
+        }
+    }
+}
+
+static int DataEyeOpen(void)
+{
+    u32 Lane;
+    u32 i;
+    u32 Addr;
+
+    for (Lane = 0; Lane < SIM_DDR_LANES; Lane++) {
+        for (i = 0; i < NUM_TRAINED; i++) {
+            Addr = DDR_PHY_DX0_BASE + (Lane * DDR_PHY_DX_STRIDE) +
+                   TrainedOffsets[i];
+            if (Lookup(Addr)->Value != TrainedValue(Addr)) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/* ------------------------------------------------------------
+ * Generic counter
+ * ------------------------------------------------------------ */
+static void CounterControl(u32 Value)
+{
+    int Enable = ((Value & SCNTRS_EN) != 0U);
+
+    if (Enable && !Counting) {
+        CountingSince = Now;
+    } else if (!Enable && Counting) {
+        Counted += Now - CountingSince;
+    }
+    Counting = Enable;
+}
+
+u64 PsuSim_Counter(void)
+{
+    return Counting ? (Counted + (Now - CountingSince)) : Counted;
+}
+
+/* ------------------------------------------------------------
+ * Register access
+ * ------------------------------------------------------------ */
+u32 PsuSim_Read32(UINTPTR Addr)
+{
+    u32 Value;
+
+    Now += PSU_SIM_MMIO_TICKS;
+    Reads++;
+
+    Value = Lookup((u32)Addr)->Value;
+    switch ((u32)Addr) {
+    case CRL_APB_PLL_STATUS:
+    case CRF_APB_PLL_STATUS:
+        Value = PllStatus((u32)Addr, Value);
+        break;
+    case DDR_PHY_PGSR0:
+        Value = PhyStatus();
+        break;
+    default:
+        if (((u32)Addr < SIM_DRAM_END) &&
+            (((Lookup(DDRC_RFSHCTL3)->Value &
+               RFSHCTL3_DIS_AUTO_REFRESH) != 0U) || !DataEyeOpen())) {
+            Value ^= 0x00FF00FFU;
+        }
+        break;
+    }
+
+    if (ReadHook != NULL) {
+        ReadHook((u32)Addr, Value);
+    }
+    return Value;
+}
+
+void PsuSim_Write32(UINTPTR Addr, u32 Value)
+{
+    SimReg *R = Lookup((u32)Addr);
+
+    Now += PSU_SIM_MMIO_TICKS;
+    Writes++;
+
+    if (Hook != NULL) {
+        Hook((u32)Addr, Value);
+    }
+    PllCtrl((u32)Addr, R->Value, Value);
+    R->Value = Value;
+    if ((u32)Addr == SCNTRS_COUNTER_CONTROL) {
+        CounterControl(Value);
+    }
+    if ((u32)Addr == DDR_PHY_PIR) {
+        PhyTrigger(Value);
+        if ((Value & PIR_TRAIN) != 0U) {
+            PhyTrain();
+        }
+    }
+}
+
+void PsuSim_SetWriteHook(PsuSimWriteHook WriteHook)
+{
+    Hook = WriteHook;
+}
+
+void PsuSim_SetReadHook(PsuSimReadHook OnRead)
+{
+    ReadHook = OnRead;
+}
+
+/* Registers only read so far hold their power-on value and are skipped */
+void PsuSim_ForEachReg(PsuSimRegVisitor Visit)
+{
+    u32 i;
+
+    for (i = 0; i < SIM_REGS; i++) {
+        if (Regs[i].Used && (Regs[i].Value != ResetValue(Regs[i].Addr))) {
+            Visit(Regs[i].Addr, Regs[i].Value);
+        }
+    }
+}
+
+/* Power-on state; the caller keeps whatever should survive */
+void PsuSim_Reset(void)
+{
+    u32 i;
+
+    memset(Regs, 0, sizeof(Regs));
+    for (i = 0; i < NUM_PLLS; i++) {
+        Plls[i].ReleasedAt = 0;
+    }
+    Now = 0;
+    Reads = 0;
+    Writes = 0;
+    Events = 0;
+    Cntkctl = 0;
+    Counted = 0;
+    CountingSince = 0;
+    Counting = 0;
+    PhyStep = 0;
+    PhyStepAt = 0;
+    PhyBase = 0;
+    Hook = NULL;
+    ReadHook = NULL;
+}
+
+void PsuSim_BreakPll(u32 PllCtrl)
+{
+    BrokenPll = PllCtrl;
+}
+
+void PsuSim_Sleep(u64 Ticks)
+{
+    Now += Ticks;
+}
+
+u64 PsuSim_Now(void)
+{
+    return Now;
+}
+
+/* ------------------------------------------------------------
+ * WFE: sleep to the next selected edge of counter bit EVNTI
+ * ------------------------------------------------------------ */
+void PsuSim_WaitForEvent(void)
+{
+    u64 Count = PsuSim_Counter();
+    u64 Half;
+    u64 Next;
+    u64 Level;
+
+    if ((Cntkctl & CNTKCTL_EVNTEN) == 0U) {
+        fprintf(stderr, "[sim] wfe with no event stream\n");
+        exit(3);
+    }
+    if (!Counting) {
+        fprintf(stderr, "[sim] wfe with the generic counter stopped\n");
+        exit(3);
+    }
+
+    Half = (u64)1U << CNTKCTL_EVNTI(Cntkctl);
+    Next = (Count | (Half - 1U)) + 1U;
+    Level = ((Cntkctl & CNTKCTL_EVNTDIR) != 0U) ? 0U : Half;
+    if ((Next & Half) != Level) {
+        Next += Half;
+    }
+    Now += Next - Count;
+    Events++;
+}
+
+u64 PsuSim_ReadSysReg(const char *Name)
+{
+    if (strcmp(Name, "cntkctl_el1") != 0) {
+        fprintf(stderr, "[sim] read of unmodelled %s\n", Name);
+        exit(2);
+    }
+    return Cntkctl;
+}
+
+void PsuSim_WriteSysReg(const char *Name, u64 Value)
+{
+    if (strcmp(Name, "cntkctl_el1") != 0) {
+        fprintf(stderr, "[sim] write of unmodelled %s\n", Name);
+        exit(2);
+    }
+    Cntkctl = Value;
+}
+
+u32 PsuSim_Events(void)
+{
+    return Events;
+}
+
+u32 PsuSim_Reads(void)
+{
+    return Reads;
+}
+
+u32 PsuSim_Writes(void)
+{
+    return Writes;
+}
+
+/* ------------------------------------------------------------
+ * BSP services backed by the virtual clock
+ * ------------------------------------------------------------ */
+void XTime_GetTime(XTime *Xtime_Global)
+{
+    *Xtime_Global = PsuSim_Counter();
+}
+
+void xil_printf(const char *Format, ...)
+{
+    va_list Args;
+
+    va_start(Args, Format);
+    vprintf(Format, Args);
+    va_end(Args);
+}
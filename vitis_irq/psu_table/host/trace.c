@@ -0,0 +1,146 @@
+/******************************************************************************
+ * psu_init host replay - register trace of one psu_init() run
+ *
+ * Built once with the Vivado psu_init.c and once with each generated
+ * table (CMakeLists.txt), so every build runs its own psu_init() against
+ * the same register model and writes what it did to a file:
+ *
+ *   W <addr> <value>   a register write, in order
+ *   B                  a barrier: a read of another register or a delay
+ *                      since the last write
+ *   S <addr> <value>   final state, every register not at its power-on
+ *                      value, by address
+ *
+ * A read of the register just written is not a barrier, it is the next
+ * read-modify-write of it. Delays are seen as a gap of more than one
+ * access on the virtual clock. psu_equiv compares two traces.
+ *
+ *   psu_trace <file>
+ ******************************************************************************/
+
+#include "psu_init.h"
+#include "psu_sim.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MAX_EVENTS          65536U
+#define MAX_STATE           4096U
+#define EVENT_BARRIER       0xFFFFFFFFU     /* Addr of a barrier */
+
+typedef struct {
+    u32 Addr;
+    u32 Value;
+} TraceEvent;
+
+static TraceEvent Events[MAX_EVENTS];
+static u32 NumEvents;
+static TraceEvent State[MAX_STATE];
+static u32 NumState;
+
+static u32 LastWrite = EVENT_BARRIER;
+static u64 LastAt;
+static int Barrier;
+
+static void Record(u32 Addr, u32 Value)
+{
+    if (NumEvents >= MAX_EVENTS) {
+        fprintf(stderr, "[trace] more than %u events\n", MAX_EVENTS);
+        exit(2);
+    }
+    Events[NumEvents].Addr = Addr;
+    Events[NumEvents].Value = Value;
+    NumEvents++;
+}
+
+/* The hooks run after the access is charged to the clock */
+static void Gap(void)
+{
+    if (PsuSim_Now() - LastAt > PSU_SIM_MMIO_TICKS) {
+        Barrier = 1;
+    }
+    LastAt = PsuSim_Now();
+}
+
+static void OnRead(u32 Addr, u32 Value)
+{
+    (void)Value;
+    Gap();
+    if (Addr != LastWrite) {
+        Barrier = 1;
+    }
+}
+
+static void OnWrite(u32 Addr, u32 Value)
+{
+    Gap();
+    if (Barrier && (NumEvents != 0U)) {
+        Record(EVENT_BARRIER, 0);
+    }
+    Barrier = 0;
+    Record(Addr, Value);
+    LastWrite = Addr;
+}
+
+static void OnReg(u32 Addr, u32 Value)
+{
+    if (NumState >= MAX_STATE) {
+        fprintf(stderr, "[trace] more than %u registers\n", MAX_STATE);
+        exit(2);
+    }
+    State[NumState].Addr = Addr;
+    State[NumState].Value = Value;
+    NumState++;
+}
+
+static int CompareAddr(const void *A, const void *B)
+{
+    u32 X = ((const TraceEvent *)A)->Addr;
+    u32 Y = ((const TraceEvent *)B)->Addr;
+
+    return (X > Y) - (X < Y);
+}
+
+int main(int argc, char **argv)
+{
+    FILE *Out;
+    int Status;
+    u32 i;
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <file>\n", argv[0]);
+        return 2;
+    }
+
+    PsuSim_Reset();
+    PsuSim_SetReadHook(OnRead);
+    PsuSim_SetWriteHook(OnWrite);
+    Status = psu_init();
+    PsuSim_SetReadHook(NULL);
+    PsuSim_SetWriteHook(NULL);
+    PsuSim_ForEachReg(OnReg);
+    qsort(State, NumState, sizeof(State[0]), CompareAddr);
+
+    Out = fopen(argv[1], "w");
+    if (Out == NULL) {
+        perror(argv[1]);
+        return 2;
+    }
+    for (i = 0; i < NumEvents; i++) {
+        if (Events[i].Addr == EVENT_BARRIER) {
+            fprintf(Out, "B\n");
+        } else {
+            fprintf(Out, "W %08X %08X\n", (unsigned)Events[i].Addr,
+                    (unsigned)Events[i].Value);
+        }
+    }
+    for (i = 0; i < NumState; i++) {
+        fprintf(Out, "S %08X %08X\n", (unsigned)State[i].Addr,
+                (unsigned)State[i].Value);
+    }
+    fclose(Out);
+
+    fprintf(stderr, "[trace] psu_init() = %d, %u writes, %u registers "
+            "changed -> %s\n", Status, (unsigned)PsuSim_Writes(),
+            (unsigned)NumState, argv[1]);
+    return (Status == 0) ? 0 : 1;
+}
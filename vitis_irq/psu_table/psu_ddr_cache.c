@@ -0,0 +1,259 @@
+/******************************************************************************
+ * DDR PHY training cache - see psu_ddr_cache.h
+ ******************************************************************************/
+
+#include "psu_ddr_cache.h"
+
+#ifdef PSU_DDR_CACHE
+
+#include "xil_io.h"
+#include "xil_cache.h"
+#include <stddef.h>
+#include <string.h>
+
+#define DDRC_RFSHCTL3       0xFD070060U
+#define DDRC_ZQCTL0         0xFD070180U
+#define DDR_PHY_PGCR1       0xFD080014U
+#define DDR_PHY_PGCR6       0xFD080028U
+#define DDR_PHY_PGSR0       0xFD080030U
+#define DDR_PHY_DX0_BASE    0xFD080700U
+#define DDR_PHY_DX_STRIDE   0x100U
+
+#define PGCR6_INHVT         0x00000001U     /* Hold VT compensation */
+#define PGSR0_ERRORS        0x1FFC0000U     /* As checked by the bring-up */
+#define DXGCR0_CALBYP       0x80000000U     /* Lane not in use */
+
+/* Per DATX8 lane: the registers training leaves its result in */
+static const u16 LaneRegs[PSU_DDR_CACHE_LANE_REGS] = {
+    0x014U, 0x018U,                 /* GCR5, GCR6: host and DRAM Vref */
+    0x040U, 0x044U, 0x048U,         /* BDLR0-2: write DQ/DM/DQS deskew */
+    0x050U, 0x054U, 0x058U,         /* BDLR3-5: read DQ/DM/DQS deskew */
+    0x060U,                         /* BDLR6: read DQSN deskew */
+    0x080U, 0x084U, 0x088U,         /* LCDLR0-2: WL, WDQ, DQS gate */
+    0x08CU, 0x090U, 0x094U,         /* LCDLR3-5: read DQS/DQSN, gate status */
+    0x0A0U,                         /* MDLR0: period the delays are for */
+    0x0C0U,                         /* GTR0: DQS gate system latency */
+};
+
+/* Written by the post-training step, put back in reverse order if the
+ * restored result is rejected */
+static const u32 PostRegs[] = {
+    DDRC_ZQCTL0, DDRC_RFSHCTL3, DDR_PHY_PGCR1,
+};
+
+#define NUM_POST_REGS   (sizeof(PostRegs) / sizeof(PostRegs[0]))
+
+static PsuDdrCacheBlob Blob;        /* 1.2 KB, kept off the FSBL stack */
+static u32 Before[PSU_DDR_CACHE_MAX_REGS];
+static u32 PostBefore[NUM_POST_REGS];
+static u32 TestSaved[PSU_DDR_CACHE_TEST_WORDS];
+static PsuDdrCacheStatus LastStatus;
+
+/* ------------------------------------------------------------
+ * Trained register set of the lanes psu_ddr_init_data() enabled
+ * ------------------------------------------------------------ */
+static u32 TrainedRegs(u32 *Addrs)
+{
+    u32 Count = 0;
+    u32 Base;
+    u32 Lane;
+    u32 i;
+
+    for (Lane = 0; Lane < PSU_DDR_CACHE_LANES; Lane++) {
+        Base = DDR_PHY_DX0_BASE + (Lane * DDR_PHY_DX_STRIDE);
+        if ((Xil_In32(Base) & DXGCR0_CALBYP) != 0U) {
+            continue;
+        }
+        for (i = 0; i < PSU_DDR_CACHE_LANE_REGS; i++) {
+            Addrs[Count++] = Base + LaneRegs[i];
+        }
+    }
+    return Count;
+}
+
+static u32 Crc32(const u8 *Data, u32 Len)
+{
+    u32 Crc = 0xFFFFFFFFU;
+    u32 i;
+
+    while (Len-- > 0U) {
+        Crc ^= *Data++;
+        for (i = 0; i < 8U; i++) {
+            Crc = (Crc >> 1) ^ (0xEDB88320U & (0U - (Crc & 1U)));
+        }
+    }
+    return ~Crc;
+}
+
+void PsuDdrCache_Seal(PsuDdrCacheBlob *Blob)
+{
+    Blob->Magic = PSU_DDR_CACHE_MAGIC;
+    Blob->Version = PSU_DDR_CACHE_VERSION;
+    Blob->Crc = Crc32((const u8 *)Blob, offsetof(PsuDdrCacheBlob, Crc));
+}
+
+u32 PsuDdrCache_Capture(PsuDdrCacheBlob *Blob)
+{
+    u32 Addrs[PSU_DDR_CACHE_MAX_REGS];
+    u32 i;
+
+    memset(Blob, 0, sizeof(*Blob));
+    Blob->ConfigId = PsuDdrConfigId;
+    Blob->Count = TrainedRegs(Addrs);
+    for (i = 0; i < Blob->Count; i++) {
+        Blob->Regs[i].Addr = Addrs[i];
+        Blob->Regs[i].Value = Xil_In32(Addrs[i]);
+    }
+    PsuDdrCache_Seal(Blob);
+    return Blob->Count;
+}
+
+/* Intact, for this configuration and for exactly the lanes in use */
+int PsuDdrCache_Check(const PsuDdrCacheBlob *Blob)
+{
+    u32 Addrs[PSU_DDR_CACHE_MAX_REGS];
+    u32 i;
+
+    if ((Blob->Magic != PSU_DDR_CACHE_MAGIC) ||
+        (Blob->Version != PSU_DDR_CACHE_VERSION) ||
+        (Blob->ConfigId != PsuDdrConfigId) ||
+        (Blob->Count > PSU_DDR_CACHE_MAX_REGS) ||
+        (Blob->Crc != Crc32((const u8 *)Blob,
+                            offsetof(PsuDdrCacheBlob, Crc)))) {
+        return 0;
+    }
+    if (TrainedRegs(Addrs) != Blob->Count) {
+        return 0;
+    }
+    for (i = 0; i < Blob->Count; i++) {
+        if (Blob->Regs[i].Addr != Addrs[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* ------------------------------------------------------------
+ * Restore with VT compensation held, so the PHY does not
+ * rescale the delays while they are half written
+ * ------------------------------------------------------------ */
+static void WriteRegs(const PsuDdrCacheBlob *Blob, const u32 *Values)
+{
+    u32 Pgcr6 = Xil_In32(DDR_PHY_PGCR6);
+    u32 i;
+
+    Xil_Out32(DDR_PHY_PGCR6, Pgcr6 | PGCR6_INHVT);
+    for (i = 0; i < Blob->Count; i++) {
+        Xil_Out32(Blob->Regs[i].Addr,
+                  (Values != NULL) ? Values[i] : Blob->Regs[i].Value);
+    }
+    Xil_Out32(DDR_PHY_PGCR6, Pgcr6);
+}
+
+static u32 Pattern(u32 i)
+{
+    u32 Walk = 1U << (i & 31U);
+
+    return ((i & 32U) != 0U) ? ~Walk : Walk;
+}
+
+/* Walking ones and zeros across every DQ of the lanes in use, leaving
+ * the test words as they were */
+static int Verify(void)
+{
+    UINTPTR Addr = PSU_DDR_CACHE_TEST_ADDR;
+    int Ok = 1;
+    u32 i;
+
+    if ((Xil_In32(DDR_PHY_PGSR0) & PGSR0_ERRORS) != 0U) {
+        return 0;
+    }
+
+    for (i = 0; i < PSU_DDR_CACHE_TEST_WORDS; i++) {
+        TestSaved[i] = Xil_In32(Addr + (i * 4U));
+        Xil_Out32(Addr + (i * 4U), Pattern(i));
+    }
+    Xil_DCacheFlushRange(Addr, PSU_DDR_CACHE_TEST_WORDS * 4U);
+    for (i = 0; i < PSU_DDR_CACHE_TEST_WORDS; i++) {
+        if (Xil_In32(Addr + (i * 4U)) != Pattern(i)) {
+            Ok = 0;
+        }
+        Xil_Out32(Addr + (i * 4U), TestSaved[i]);
+    }
+    Xil_DCacheFlushRange(Addr, PSU_DDR_CACHE_TEST_WORDS * 4U);
+    return Ok;
+}
+
+/* ------------------------------------------------------------
+ * Restore the last training result or train and keep the result,
+ * then hand the DRAM back to the controller (Post). A restored
+ * result is checked only after Post: the pattern test needs
+ * refresh running.
+ * ------------------------------------------------------------ */
+unsigned long PsuDdrCache_Train(unsigned long (*Train)(void),
+                                unsigned long (*Post)(void))
+{
+    u32 i;
+
+    LastStatus = PSU_DDR_CACHE_MISS;
+    if (PsuDdrCache_Load(&Blob)) {
+        LastStatus = PSU_DDR_CACHE_STALE;
+        if (PsuDdrCache_Check(&Blob)) {
+            for (i = 0; i < Blob.Count; i++) {
+                Before[i] = Xil_In32(Blob.Regs[i].Addr);
+            }
+            for (i = 0; i < NUM_POST_REGS; i++) {
+                PostBefore[i] = Xil_In32(PostRegs[i]);
+            }
+            WriteRegs(&Blob, NULL);
+            if (Post() && Verify()) {
+                LastStatus = PSU_DDR_CACHE_HIT;
+                return 1;
+            }
+            /* Train from where a cold boot would */
+            for (i = NUM_POST_REGS; i-- > 0U; ) {
+                Xil_Out32(PostRegs[i], PostBefore[i]);
+            }
+            WriteRegs(&Blob, Before);
+            LastStatus = PSU_DDR_CACHE_REJECTED;
+        }
+    }
+
+    if (!Train()) {
+        return 0;
+    }
+    (void)PsuDdrCache_Capture(&Blob);
+    PsuDdrCache_Store(&Blob);
+    return Post();
+}
+
+PsuDdrCacheStatus PsuDdrCache_Status(void)
+{
+    return LastStatus;
+}
+
+/* ------------------------------------------------------------
+ * Default storage
+ * ------------------------------------------------------------ */
+__attribute__((weak)) int PsuDdrCache_Load(PsuDdrCacheBlob *Blob)
+{
+#ifdef PSU_DDR_CACHE_ADDR
+    memcpy(Blob, (const void *)(UINTPTR)PSU_DDR_CACHE_ADDR, sizeof(*Blob));
+    return 1;
+#else
+    (void)Blob;
+    return 0;
+#endif
+}
+
+__attribute__((weak)) void PsuDdrCache_Store(const PsuDdrCacheBlob *Blob)
+{
+#ifdef PSU_DDR_CACHE_ADDR
+    memcpy((void *)(UINTPTR)PSU_DDR_CACHE_ADDR, Blob, sizeof(*Blob));
+    Xil_DCacheFlushRange((UINTPTR)PSU_DDR_CACHE_ADDR, sizeof(*Blob));
+#else
+    (void)Blob;
+#endif
+}
+
+#endif /* PSU_DDR_CACHE */
@@ -0,0 +1,109 @@
+/******************************************************************************
+ * DDR PHY training cache
+ *
+ * psu_ddr_phybringup_data() trains the DDR PHY (write leveling, DQS gate,
+ * read/write deskew and eye, Vref) on every boot, which is most of
+ * psu_init(). gen_psu_table.py splits that training out into its own
+ * function, and the writes that follow it (ZQ calibration and refresh
+ * back on, PUB mode off) into another, and calls both through
+ * PSU_DDR_TRAIN(); built with PSU_DDR_CACHE defined, PsuDdrCache_Train()
+ * runs them in its place:
+ *
+ *  - if PsuDdrCache_Load() returns a blob that is intact (magic, version,
+ *    CRC), was trained for this DDR configuration (PsuDdrConfigId, a hash
+ *    of psu_ddr_init_data() and the bring-up sequence) and covers exactly
+ *    the byte lanes in use, the trained delay, DQS gate and Vref registers
+ *    are written back and training is skipped;
+ *  - the post-training writes run, then the restored result is checked:
+ *    PGSR0 must show no errors and a short pattern test at
+ *    PSU_DDR_CACHE_TEST_ADDR must read back with refresh running. The
+ *    test puts back what the DRAM held there. If it fails, the trained
+ *    registers and the post-training ones are put back as they were and
+ *    the PHY is trained as on a cold boot;
+ *  - after every successful training the result is captured and handed
+ *    to PsuDdrCache_Store().
+ *
+ * PsuDdrCache_Load()/PsuDdrCache_Store() are weak. The defaults keep the
+ * blob in memory at PSU_DDR_CACHE_ADDR, which survives the resets that
+ * leave that memory alone (e.g. a reserved OCM window across a system
+ * reset); without PSU_DDR_CACHE_ADDR nothing is kept and every boot
+ * trains. Override both to keep the blob in flash for cold boots.
+ *
+ * Without PSU_DDR_CACHE, PSU_DDR_TRAIN() just calls the training.
+ ******************************************************************************/
+
+#ifndef PSU_DDR_CACHE_H_
+#define PSU_DDR_CACHE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+#define PSU_DDR_CACHE_MAGIC     0x44445243U     /* "DDRC" */
+#define PSU_DDR_CACHE_VERSION   1U
+
+/* DATX8 byte lanes DX0..DX8 (DX8 is the ECC lane) */
+#define PSU_DDR_CACHE_LANES     9U
+/* Trained registers kept per lane, see psu_ddr_cache.c */
+#define PSU_DDR_CACHE_LANE_REGS 17U
+#define PSU_DDR_CACHE_MAX_REGS  (PSU_DDR_CACHE_LANES * PSU_DDR_CACHE_LANE_REGS)
+
+/* DRAM used by the pattern test after a restore: the last 256 bytes of
+ * the 1 GB DDR, inside the top 1 MB that hello_world2's lscript.ld
+ * leaves out of psu_ddr_0_memory_0. Keep it out of every image. */
+#ifndef PSU_DDR_CACHE_TEST_ADDR
+#define PSU_DDR_CACHE_TEST_ADDR 0x3FFFFF00U
+#endif
+#ifndef PSU_DDR_CACHE_TEST_WORDS
+#define PSU_DDR_CACHE_TEST_WORDS 64U
+#endif
+
+typedef struct {
+    u32 Addr;
+    u32 Value;
+} PsuDdrCacheReg;
+
+typedef struct {
+    u32 Magic;
+    u32 Version;
+    u32 ConfigId;           /* PsuDdrConfigId it was trained for */
+    u32 Count;              /* Used entries of Regs */
+    PsuDdrCacheReg Regs[PSU_DDR_CACHE_MAX_REGS];
+    u32 Crc;                /* CRC-32 of everything above */
+} PsuDdrCacheBlob;
+
+typedef enum {
+    PSU_DDR_CACHE_OFF = 0,      /* Not run */
+    PSU_DDR_CACHE_HIT,          /* Restored, training skipped */
+    PSU_DDR_CACHE_MISS,         /* No blob, trained */
+    PSU_DDR_CACHE_STALE,        /* Blob corrupt or for another config, trained */
+    PSU_DDR_CACHE_REJECTED      /* Restored but failed the check, trained */
+} PsuDdrCacheStatus;
+
+/* Generated with psu_init_table.c */
+extern const u32 PsuDdrConfigId;
+
+unsigned long PsuDdrCache_Train(unsigned long (*Train)(void),
+                                unsigned long (*Post)(void));
+PsuDdrCacheStatus PsuDdrCache_Status(void);
+
+u32 PsuDdrCache_Capture(PsuDdrCacheBlob *Blob);
+void PsuDdrCache_Seal(PsuDdrCacheBlob *Blob);
+int PsuDdrCache_Check(const PsuDdrCacheBlob *Blob);
+
+/* Blob storage, weak; Load returns 1 if it filled Blob */
+int PsuDdrCache_Load(PsuDdrCacheBlob *Blob);
+void PsuDdrCache_Store(const PsuDdrCacheBlob *Blob);
+
+#ifdef PSU_DDR_CACHE
+#define PSU_DDR_TRAIN(Train, Post)  PsuDdrCache_Train(Train, Post)
+#else
+#define PSU_DDR_TRAIN(Train, Post)  ((Train)() && (Post)())
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif
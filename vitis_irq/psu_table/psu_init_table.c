@@ -0,0 +1,2509 @@
+/******************************************************************************
+*
+* Copyright (C) 2010-2020 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+/****************************************************************************/
+/**
+*
+* @file psu_init.c
+*
+* This file is automatically generated by gen_psu_table.py from
+* psu_init.c, do not edit
+*
+*****************************************************************************/
+
+#include <xil_io.h>
+#include <sleep.h>
+#include "psu_init.h"
+#include "psu_table.h"
+#include "psu_prof.h"
+#include "psu_ddr_cache.h"
+#include "psu_periph.h"
+#define    DPLL_CFG_LOCK_DLY        63
+#define    DPLL_CFG_LOCK_CNT        600
+#define    DPLL_CFG_LFHF            3
+#define    DPLL_CFG_CP              3
+#define    DPLL_CFG_RES             2
+
+#define    DPLL_CFG_FBDIV           64
+#define    DPLL_CFG_DIV2            1
+
+
+#define    DPLL_CFG_LOCK_DLY_SLOW_BOOT        63
+#define    DPLL_CFG_LOCK_CNT_SLOW_BOOT        750
+#define    DPLL_CFG_LFHF_SLOW_BOOT            3
+#define    DPLL_CFG_CP_SLOW_BOOT              3
+#define    DPLL_CFG_RES_SLOW_BOOT             12
+
+static
+void PSU_Mask_Write(unsigned long offset, unsigned long mask,
+	unsigned long val)
+{
+	unsigned long RegVal = val;
+
+	if ((mask & 0xFFFFFFFFUL) != 0xFFFFFFFFUL) {
+		RegVal = Xil_In32(offset);
+		RegVal &= ~(mask);
+		RegVal |= (val & mask);
+	}
+	Xil_Out32(offset, RegVal);
+}
+
+	void prog_reg(unsigned long addr, unsigned long mask,
+	unsigned long shift, unsigned long value) {
+	    int rdata = 0;
+
+	    rdata  = Xil_In32(addr);
+	    rdata  = rdata & (~mask);
+	    rdata  = rdata | (value << shift);
+	    Xil_Out32(addr, rdata);
+	    }
+
+static const PsuOp PsuPllInitOps[] = {
+	PSU_WRITE(CRL_APB_RPLL_CFG_OFFSET, 0xFE7FEDEFU, 0x7E4B0C62U),
+	PSU_WRITE(CRL_APB_RPLL_CTRL_OFFSET, 0x00717F00U, 0x00014600U),
+	PSU_WRITE(CRL_APB_RPLL_CTRL_OFFSET, 0x00000008U, 0x00000008U),
+	PSU_WRITE(CRL_APB_RPLL_CTRL_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(CRL_APB_RPLL_CTRL_OFFSET, 0x00000001U, 0x00000000U),
+	PSU_POLL(CRL_APB_PLL_STATUS_OFFSET, 0x00000002U),
+	PSU_WRITE(CRL_APB_RPLL_CTRL_OFFSET, 0x00000008U, 0x00000000U),
+	PSU_WRITE(CRL_APB_RPLL_TO_FPD_CTRL_OFFSET, 0x00003F00U, 0x00000300U),
+	PSU_WRITE(CRL_APB_RPLL_FRAC_CFG_OFFSET, 0x8000FFFFU, 0x00000000U),
+	PSU_WRITE(CRL_APB_AMS_REF_CTRL_OFFSET, 0x013F3F07U, 0x01012300U),
+	PSU_WRITE(CRL_APB_IOPLL_CFG_OFFSET, 0xFE7FEDEFU, 0x7E672C6CU),
+	PSU_WRITE(CRL_APB_IOPLL_CTRL_OFFSET, 0x00717F00U, 0x00002D00U),
+	PSU_WRITE(CRL_APB_IOPLL_CTRL_OFFSET, 0x00000008U, 0x00000008U),
+	PSU_WRITE(CRL_APB_IOPLL_CTRL_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(CRL_APB_IOPLL_CTRL_OFFSET, 0x00000001U, 0x00000000U),
+	PSU_POLL(CRL_APB_PLL_STATUS_OFFSET, 0x00000001U),
+	PSU_WRITE(CRL_APB_IOPLL_CTRL_OFFSET, 0x00000008U, 0x00000000U),
+	PSU_WRITE(CRL_APB_IOPLL_TO_FPD_CTRL_OFFSET, 0x00003F00U, 0x00000300U),
+	PSU_WRITE(CRL_APB_IOPLL_FRAC_CFG_OFFSET, 0x8000FFFFU, 0x00000000U),
+	PSU_WRITE(CRF_APB_APLL_CFG_OFFSET, 0xFE7FEDEFU, 0x7E4B0C62U),
+	PSU_WRITE(CRF_APB_APLL_CTRL_OFFSET, 0x00717F00U, 0x00014800U),
+	PSU_WRITE(CRF_APB_APLL_CTRL_OFFSET, 0x00000008U, 0x00000008U),
+	PSU_WRITE(CRF_APB_APLL_CTRL_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(CRF_APB_APLL_CTRL_OFFSET, 0x00000001U, 0x00000000U),
+	PSU_POLL(CRF_APB_PLL_STATUS_OFFSET, 0x00000001U),
+	PSU_WRITE(CRF_APB_APLL_CTRL_OFFSET, 0x00000008U, 0x00000000U),
+	PSU_WRITE(CRF_APB_APLL_TO_LPD_CTRL_OFFSET, 0x00003F00U, 0x00000300U),
+	PSU_WRITE(CRF_APB_APLL_FRAC_CFG_OFFSET, 0x8000FFFFU, 0x00000000U),
+	PSU_WRITE(CRF_APB_DPLL_CFG_OFFSET, 0xFE7FEDEFU, 0x7E4B0C62U),
+	PSU_WRITE(CRF_APB_DPLL_CTRL_OFFSET, 0x00717F00U, 0x00014000U),
+	PSU_WRITE(CRF_APB_DPLL_CTRL_OFFSET, 0x00000008U, 0x00000008U),
+	PSU_WRITE(CRF_APB_DPLL_CTRL_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(CRF_APB_DPLL_CTRL_OFFSET, 0x00000001U, 0x00000000U),
+	PSU_POLL(CRF_APB_PLL_STATUS_OFFSET, 0x00000002U),
+	PSU_WRITE(CRF_APB_DPLL_CTRL_OFFSET, 0x00000008U, 0x00000000U),
+	PSU_WRITE(CRF_APB_DPLL_TO_LPD_CTRL_OFFSET, 0x00003F00U, 0x00000300U),
+	PSU_WRITE(CRF_APB_DPLL_FRAC_CFG_OFFSET, 0x8000FFFFU, 0x00000000U),
+	PSU_WRITE(CRF_APB_VPLL_CFG_OFFSET, 0xFE7FEDEFU, 0x7E4B0C62U),
+	PSU_WRITE(CRF_APB_VPLL_CTRL_OFFSET, 0x00717F00U, 0x00014700U),
+	PSU_WRITE(CRF_APB_VPLL_CTRL_OFFSET, 0x00000008U, 0x00000008U),
+	PSU_WRITE(CRF_APB_VPLL_CTRL_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(CRF_APB_VPLL_CTRL_OFFSET, 0x00000001U, 0x00000000U),
+	PSU_POLL(CRF_APB_PLL_STATUS_OFFSET, 0x00000004U),
+	PSU_WRITE(CRF_APB_VPLL_CTRL_OFFSET, 0x00000008U, 0x00000000U),
+	PSU_WRITE(CRF_APB_VPLL_TO_LPD_CTRL_OFFSET, 0x00003F00U, 0x00000300U),
+	PSU_WRITE(CRF_APB_VPLL_FRAC_CFG_OFFSET, 0x8000FFFFU, 0x00000000U),
+};
+
+unsigned long psu_pll_init_data(void)
+{
+	return PSU_TABLE_RUN(PsuPllInitOps);
+}
+static const PsuOp PsuClockInitOps[] = {
+	PSU_WRITE(CRL_APB_GEM2_REF_CTRL_OFFSET, 0x063F3F07U, 0x06010C00U),
+	PSU_WRITE(CRL_APB_GEM_TSU_REF_CTRL_OFFSET, 0x013F3F07U, 0x01010600U),
+	PSU_WRITE(CRL_APB_USB1_BUS_REF_CTRL_OFFSET, 0x023F3F07U, 0x02010600U),
+	PSU_WRITE(CRL_APB_USB3_DUAL_REF_CTRL_OFFSET, 0x023F3F07U, 0x020F0500U),
+	PSU_WRITE(CRL_APB_QSPI_REF_CTRL_OFFSET, 0x013F3F07U, 0x01010500U),
+	PSU_WRITE(CRL_APB_SDIO1_REF_CTRL_OFFSET, 0x013F3F07U, 0x01010800U),
+	PSU_WRITE(IOU_SLCR_SDIO_CLK_CTRL_OFFSET, 0x00020000U, 0x00000000U),
+	PSU_WRITE(CRL_APB_UART0_REF_CTRL_OFFSET, 0x013F3F07U, 0x01010F00U),
+	PSU_WRITE(CRL_APB_I2C1_REF_CTRL_OFFSET, 0x013F3F07U, 0x01010F00U),
+	PSU_WRITE(CRL_APB_SPI0_REF_CTRL_OFFSET, 0x013F3F07U, 0x01010800U),
+	PSU_WRITE(CRL_APB_CPU_R5_CTRL_OFFSET, 0x01003F07U, 0x01000302U),
+	PSU_WRITE(CRL_APB_IOU_SWITCH_CTRL_OFFSET, 0x01003F07U, 0x01000602U),
+	PSU_WRITE(CRL_APB_PCAP_CTRL_OFFSET, 0x01003F07U, 0x01000800U),
+	PSU_WRITE(CRL_APB_LPD_SWITCH_CTRL_OFFSET, 0x01003F07U, 0x01000302U),
+	PSU_WRITE(CRL_APB_LPD_LSBUS_CTRL_OFFSET, 0x01003F07U, 0x01000F02U),
+	PSU_WRITE(CRL_APB_DBG_LPD_CTRL_OFFSET, 0x01003F07U, 0x01000602U),
+	PSU_WRITE(CRL_APB_ADMA_REF_CTRL_OFFSET, 0x01003F07U, 0x01000302U),
+	PSU_WRITE(CRL_APB_PL0_REF_CTRL_OFFSET, 0x013F3F07U, 0x01010F00U),
+	PSU_WRITE(CRL_APB_AMS_REF_CTRL_OFFSET, 0x013F3F07U, 0x01011E02U),
+	PSU_WRITE(CRL_APB_DLL_REF_CTRL_OFFSET, 0x00000007U, 0x00000000U),
+	PSU_WRITE(CRL_APB_TIMESTAMP_REF_CTRL_OFFSET, 0x01003F07U, 0x01000F00U),
+	PSU_WRITE(CRF_APB_ACPU_CTRL_OFFSET, 0x03003F07U, 0x03000100U),
+	PSU_WRITE(CRF_APB_DBG_FPD_CTRL_OFFSET, 0x01003F07U, 0x01000200U),
+	PSU_WRITE(CRF_APB_DDR_CTRL_OFFSET, 0x00003F07U, 0x00000400U),
+	PSU_WRITE(CRF_APB_GDMA_REF_CTRL_OFFSET, 0x01003F07U, 0x01000200U),
+	PSU_WRITE(CRF_APB_DPDMA_REF_CTRL_OFFSET, 0x01003F07U, 0x01000200U),
+	PSU_WRITE(CRF_APB_TOPSW_MAIN_CTRL_OFFSET, 0x01003F07U, 0x01000203U),
+	PSU_WRITE(CRF_APB_TOPSW_LSBUS_CTRL_OFFSET, 0x01003F07U, 0x01000502U),
+	PSU_WRITE(CRF_APB_DBG_TSTMP_CTRL_OFFSET, 0x00003F07U, 0x00000200U),
+	PSU_WRITE(IOU_SLCR_IOU_TTC_APB_CLK_OFFSET, 0x000000FFU, 0x00000000U),
+	PSU_WRITE(FPD_SLCR_WDT_CLK_SEL_OFFSET, 0x00000001U, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_WDT_CLK_SEL_OFFSET, 0x00000001U, 0x00000000U),
+	PSU_WRITE(LPD_SLCR_CSUPMU_WDT_CLK_SEL_OFFSET, 0x00000001U, 0x00000000U),
+};
+
+unsigned long psu_clock_init_data(void)
+{
+	return PSU_TABLE_RUN(PsuClockInitOps);
+}
+static const PsuOp PsuDdrInitOps[] = {
+	PSU_WRITE(CRF_APB_RST_DDR_SS_OFFSET, 0x00000008U, 0x00000008U),
+	PSU_WRITE(DDRC_MSTR_OFFSET, 0xE30FBE3DU, 0xC1081020U),
+	PSU_WRITE(DDRC_MRCTRL0_OFFSET, 0x8000F03FU, 0x00000030U),
+	PSU_WRITE(DDRC_DERATEEN_OFFSET, 0x000003F3U, 0x00000102U),
+	PSU_WRITE(DDRC_DERATEINT_OFFSET, 0xFFFFFFFFU, 0x0028B0AAU),
+	PSU_WRITE(DDRC_PWRCTL_OFFSET, 0x0000007FU, 0x00000000U),
+	PSU_WRITE(DDRC_PWRTMG_OFFSET, 0x00FFFF1FU, 0x00404310U),
+	PSU_WRITE(DDRC_RFSHCTL0_OFFSET, 0x00F1F1F4U, 0x00210000U),
+	PSU_WRITE(DDRC_RFSHCTL1_OFFSET, 0x0FFF0FFFU, 0x00000000U),
+	PSU_WRITE(DDRC_RFSHCTL3_OFFSET, 0x00000073U, 0x00000001U),
+	PSU_WRITE(DDRC_RFSHTMG_OFFSET, 0x0FFF83FFU, 0x00208030U),
+	PSU_WRITE(DDRC_ECCCFG0_OFFSET, 0x00000017U, 0x00000010U),
+	PSU_WRITE(DDRC_ECCCFG1_OFFSET, 0x00000003U, 0x00000000U),
+	PSU_WRITE(DDRC_CRCPARCTL1_OFFSET, 0x3F000391U, 0x10000200U),
+	PSU_WRITE(DDRC_CRCPARCTL2_OFFSET, 0x01FF1F3FU, 0x0030051FU),
+	PSU_WRITE(DDRC_INIT0_OFFSET, 0xC3FF0FFFU, 0x0002020AU),
+	PSU_WRITE(DDRC_INIT1_OFFSET, 0x01FF7F0FU, 0x00360000U),
+	PSU_WRITE(DDRC_INIT2_OFFSET, 0x0000FF0FU, 0x00001205U),
+	PSU_WRITE(DDRC_INIT3_OFFSET, 0xFFFFFFFFU, 0x00240052U),
+	PSU_WRITE(DDRC_INIT4_OFFSET, 0xFFFFFFFFU, 0x00310008U),
+	PSU_WRITE(DDRC_INIT5_OFFSET, 0x00FF03FFU, 0x00210004U),
+	PSU_WRITE(DDRC_INIT6_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDRC_INIT7_OFFSET, 0xFFFF0000U, 0x00000000U),
+	PSU_WRITE(DDRC_DIMMCTL_OFFSET, 0x0000003FU, 0x00000010U),
+	PSU_WRITE(DDRC_RANKCTL_OFFSET, 0x00000FFFU, 0x0000077FU),
+	PSU_WRITE(DDRC_DRAMTMG0_OFFSET, 0x7F3F7F3FU, 0x100B080CU),
+	PSU_WRITE(DDRC_DRAMTMG1_OFFSET, 0x001F1F7FU, 0x00030411U),
+	PSU_WRITE(DDRC_DRAMTMG2_OFFSET, 0x3F3F3F3FU, 0x0607150FU),
+	PSU_WRITE(DDRC_DRAMTMG3_OFFSET, 0x3FF3F3FFU, 0x00A05000U),
+	PSU_WRITE(DDRC_DRAMTMG4_OFFSET, 0x1F0F0F1FU, 0x05040306U),
+	PSU_WRITE(DDRC_DRAMTMG5_OFFSET, 0x0F0F3F1FU, 0x01020404U),
+	PSU_WRITE(DDRC_DRAMTMG6_OFFSET, 0x0F0F000FU, 0x01010004U),
+	PSU_WRITE(DDRC_DRAMTMG7_OFFSET, 0x00000F0FU, 0x00000201U),
+	PSU_WRITE(DDRC_DRAMTMG8_OFFSET, 0x7F7F7F7FU, 0x03030303U),
+	PSU_WRITE(DDRC_DRAMTMG9_OFFSET, 0x40070F3FU, 0x0004040DU),
+	PSU_WRITE(DDRC_DRAMTMG11_OFFSET, 0x7F1F031FU, 0x440C011CU),
+	PSU_WRITE(DDRC_DRAMTMG12_OFFSET, 0x00030F1FU, 0x00020608U),
+	PSU_WRITE(DDRC_ZQCTL0_OFFSET, 0xF7FF03FFU, 0x810B0008U),
+	PSU_WRITE(DDRC_ZQCTL1_OFFSET, 0x3FFFFFFFU, 0x00E32DCDU),
+	PSU_WRITE(DDRC_DFITMG0_OFFSET, 0x1FBFBF3FU, 0x048B820AU),
+	PSU_WRITE(DDRC_DFITMG1_OFFSET, 0xF31F0F0FU, 0x00030304U),
+	PSU_WRITE(DDRC_DFILPCFG0_OFFSET, 0x0FF1F1F1U, 0x07000101U),
+	PSU_WRITE(DDRC_DFILPCFG1_OFFSET, 0x000000F1U, 0x00000021U),
+	PSU_WRITE(DDRC_DFIUPD0_OFFSET, 0xC3FF03FFU, 0x00400003U),
+	PSU_WRITE(DDRC_DFIUPD1_OFFSET, 0x00FF00FFU, 0x00C800FFU),
+	PSU_WRITE(DDRC_DFIMISC_OFFSET, 0x00000007U, 0x00000004U),
+	PSU_WRITE(DDRC_DFITMG2_OFFSET, 0x00003F3FU, 0x00000908U),
+	PSU_WRITE(DDRC_DBICTL_OFFSET, 0x00000007U, 0x00000001U),
+	PSU_WRITE(DDRC_ADDRMAP0_OFFSET, 0x0000001FU, 0x0000001FU),
+	PSU_WRITE(DDRC_ADDRMAP1_OFFSET, 0x001F1F1FU, 0x00070707U),
+	PSU_WRITE(DDRC_ADDRMAP2_OFFSET, 0x0F0F0F0FU, 0x00000000U),
+	PSU_WRITE(DDRC_ADDRMAP3_OFFSET, 0x0F0F0F0FU, 0x0F000000U),
+	PSU_WRITE(DDRC_ADDRMAP4_OFFSET, 0x00000F0FU, 0x00000F0FU),
+	PSU_WRITE(DDRC_ADDRMAP5_OFFSET, 0x0F0F0F0FU, 0x060F0606U),
+	PSU_WRITE(DDRC_ADDRMAP6_OFFSET, 0x8F0F0F0FU, 0x0F060606U),
+	PSU_WRITE(DDRC_ADDRMAP7_OFFSET, 0x00000F0FU, 0x00000F0FU),
+	PSU_WRITE(DDRC_ADDRMAP8_OFFSET, 0x00001F1FU, 0x00000000U),
+	PSU_WRITE(DDRC_ADDRMAP9_OFFSET, 0x0F0F0F0FU, 0x06060606U),
+	PSU_WRITE(DDRC_ADDRMAP10_OFFSET, 0x0F0F0F0FU, 0x06060606U),
+	PSU_WRITE(DDRC_ADDRMAP11_OFFSET, 0x0000000FU, 0x00000006U),
+	PSU_WRITE(DDRC_ODTCFG_OFFSET, 0x0F1F0F7CU, 0x04000400U),
+	PSU_WRITE(DDRC_ODTMAP_OFFSET, 0x00003333U, 0x00000000U),
+	PSU_WRITE(DDRC_SCHED_OFFSET, 0x7FFF3F07U, 0x01002001U),
+	PSU_WRITE(DDRC_PERFLPR1_OFFSET, 0xFF00FFFFU, 0x08000040U),
+	PSU_WRITE(DDRC_PERFWR1_OFFSET, 0xFF00FFFFU, 0x08000040U),
+	PSU_WRITE(DDRC_DQMAP0_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDRC_DQMAP1_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDRC_DQMAP2_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDRC_DQMAP3_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDRC_DQMAP4_OFFSET, 0x0000FFFFU, 0x00000000U),
+	PSU_WRITE(DDRC_DQMAP5_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(DDRC_DBG0_OFFSET, 0x00000011U, 0x00000000U),
+	PSU_WRITE(DDRC_DBGCMD_OFFSET, 0x80000033U, 0x00000000U),
+	PSU_WRITE(DDRC_SWCTL_OFFSET, 0x00000001U, 0x00000000U),
+	PSU_WRITE(DDRC_PCCFG_OFFSET, 0x00000111U, 0x00000001U),
+	PSU_WRITE(DDRC_PCFGR_0_OFFSET, 0x000073FFU, 0x0000200FU),
+	PSU_WRITE(DDRC_PCFGW_0_OFFSET, 0x000073FFU, 0x0000200FU),
+	PSU_WRITE(DDRC_PCTRL_0_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(DDRC_PCFGQOS0_0_OFFSET, 0x0033000FU, 0x0020000BU),
+	PSU_WRITE(DDRC_PCFGQOS1_0_OFFSET, 0x07FF07FFU, 0x00000000U),
+	PSU_WRITE(DDRC_PCFGR_1_OFFSET, 0x000073FFU, 0x0000200FU),
+	PSU_WRITE(DDRC_PCFGW_1_OFFSET, 0x000073FFU, 0x0000200FU),
+	PSU_WRITE(DDRC_PCTRL_1_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(DDRC_PCFGQOS0_1_OFFSET, 0x03330F0FU, 0x02000B03U),
+	PSU_WRITE(DDRC_PCFGQOS1_1_OFFSET, 0x07FF07FFU, 0x00000000U),
+	PSU_WRITE(DDRC_PCFGR_2_OFFSET, 0x000073FFU, 0x0000200FU),
+	PSU_WRITE(DDRC_PCFGW_2_OFFSET, 0x000073FFU, 0x0000200FU),
+	PSU_WRITE(DDRC_PCTRL_2_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(DDRC_PCFGQOS0_2_OFFSET, 0x03330F0FU, 0x02000B03U),
+	PSU_WRITE(DDRC_PCFGQOS1_2_OFFSET, 0x07FF07FFU, 0x00000000U),
+	PSU_WRITE(DDRC_PCFGR_3_OFFSET, 0x000073FFU, 0x0000200FU),
+	PSU_WRITE(DDRC_PCFGW_3_OFFSET, 0x000073FFU, 0x0000200FU),
+	PSU_WRITE(DDRC_PCTRL_3_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(DDRC_PCFGQOS0_3_OFFSET, 0x0033000FU, 0x00100003U),
+	PSU_WRITE(DDRC_PCFGQOS1_3_OFFSET, 0x07FF07FFU, 0x0000004FU),
+	PSU_WRITE(DDRC_PCFGWQOS0_3_OFFSET, 0x0033000FU, 0x00100003U),
+	PSU_WRITE(DDRC_PCFGWQOS1_3_OFFSET, 0x000007FFU, 0x0000004FU),
+	PSU_WRITE(DDRC_PCFGR_4_OFFSET, 0x000073FFU, 0x0000200FU),
+	PSU_WRITE(DDRC_PCFGW_4_OFFSET, 0x000073FFU, 0x0000200FU),
+	PSU_WRITE(DDRC_PCTRL_4_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(DDRC_PCFGQOS0_4_OFFSET, 0x0033000FU, 0x00100003U),
+	PSU_WRITE(DDRC_PCFGQOS1_4_OFFSET, 0x07FF07FFU, 0x0000004FU),
+	PSU_WRITE(DDRC_PCFGWQOS0_4_OFFSET, 0x0033000FU, 0x00100003U),
+	PSU_WRITE(DDRC_PCFGWQOS1_4_OFFSET, 0x000007FFU, 0x0000004FU),
+	PSU_WRITE(DDRC_PCFGR_5_OFFSET, 0x000073FFU, 0x0000200FU),
+	PSU_WRITE(DDRC_PCFGW_5_OFFSET, 0x000073FFU, 0x0000200FU),
+	PSU_WRITE(DDRC_PCTRL_5_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(DDRC_PCFGQOS0_5_OFFSET, 0x0033000FU, 0x00100003U),
+	PSU_WRITE(DDRC_PCFGQOS1_5_OFFSET, 0x07FF07FFU, 0x0000004FU),
+	PSU_WRITE(DDRC_PCFGWQOS0_5_OFFSET, 0x0033000FU, 0x00100003U),
+	PSU_WRITE(DDRC_PCFGWQOS1_5_OFFSET, 0x000007FFU, 0x0000004FU),
+	PSU_WRITE(DDRC_SARBASE0_OFFSET, 0x000001FFU, 0x00000000U),
+	PSU_WRITE(DDRC_SARSIZE0_OFFSET, 0x000000FFU, 0x00000000U),
+	PSU_WRITE(DDRC_SARBASE1_OFFSET, 0x000001FFU, 0x00000010U),
+	PSU_WRITE(DDRC_SARSIZE1_OFFSET, 0x000000FFU, 0x0000000FU),
+	PSU_WRITE(DDRC_DFITMG0_SHADOW_OFFSET, 0x1FBFBF3FU, 0x07828002U),
+	PSU_WRITE(CRF_APB_RST_DDR_SS_OFFSET, 0x0000000CU, 0x00000000U),
+	PSU_WRITE(DDR_PHY_PGCR0_OFFSET, 0xFFFFFFFFU, 0x87001E00U),
+	PSU_WRITE(DDR_PHY_PGCR2_OFFSET, 0xFFFFFFFFU, 0x00F03D28U),
+	PSU_WRITE(DDR_PHY_PGCR3_OFFSET, 0xFFFFFFFFU, 0x55AA5480U),
+	PSU_WRITE(DDR_PHY_PGCR5_OFFSET, 0xFFFFFFFFU, 0x010100F4U),
+	PSU_WRITE(DDR_PHY_PTR0_OFFSET, 0xFFFFFFFFU, 0x21610AD0U),
+	PSU_WRITE(DDR_PHY_PTR1_OFFSET, 0xFFFFFFFFU, 0x682B0960U),
+	PSU_WRITE(DDR_PHY_PLLCR0_OFFSET, 0xFFFFFFFFU, 0x05102000U),
+	PSU_WRITE(DDR_PHY_DSGCR_OFFSET, 0xFFFFFFFFU, 0x02A040A1U),
+	PSU_WRITE(DDR_PHY_GPR0_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDR_PHY_GPR1_OFFSET, 0xFFFFFFFFU, 0x000000E5U),
+	PSU_WRITE(DDR_PHY_DCR_OFFSET, 0xFFFFFFFFU, 0x0000040DU),
+	PSU_WRITE(DDR_PHY_DTPR0_OFFSET, 0xFFFFFFFFU, 0x06180C08U),
+	PSU_WRITE(DDR_PHY_DTPR1_OFFSET, 0xFFFFFFFFU, 0x2816070BU),
+	PSU_WRITE(DDR_PHY_DTPR2_OFFSET, 0xFFFFFFFFU, 0x000F0064U),
+	PSU_WRITE(DDR_PHY_DTPR3_OFFSET, 0xFFFFFFFFU, 0x82000501U),
+	PSU_WRITE(DDR_PHY_DTPR4_OFFSET, 0xFFFFFFFFU, 0x00602B08U),
+	PSU_WRITE(DDR_PHY_DTPR5_OFFSET, 0xFFFFFFFFU, 0x00221008U),
+	PSU_WRITE(DDR_PHY_DTPR6_OFFSET, 0xFFFFFFFFU, 0x00000C0EU),
+	PSU_WRITE(DDR_PHY_RDIMMGCR0_OFFSET, 0xFFFFFFFFU, 0x08400020U),
+	PSU_WRITE(DDR_PHY_RDIMMGCR1_OFFSET, 0xFFFFFFFFU, 0x00000C80U),
+	PSU_WRITE(DDR_PHY_RDIMMCR0_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDR_PHY_RDIMMCR1_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDR_PHY_MR0_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDR_PHY_MR1_OFFSET, 0xFFFFFFFFU, 0x00000024U),
+	PSU_WRITE(DDR_PHY_MR2_OFFSET, 0xFFFFFFFFU, 0x00000052U),
+	PSU_WRITE(DDR_PHY_MR3_OFFSET, 0xFFFFFFFFU, 0x00000031U),
+	PSU_WRITE(DDR_PHY_MR4_OFFSET, 0xFFFFFFFFU, 0x00000008U),
+	PSU_WRITE(DDR_PHY_MR5_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDR_PHY_MR6_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDR_PHY_MR11_OFFSET, 0xFFFFFFFFU, 0x00000056U),
+	PSU_WRITE(DDR_PHY_MR12_OFFSET, 0xFFFFFFFFU, 0x00000056U),
+	PSU_WRITE(DDR_PHY_MR13_OFFSET, 0xFFFFFFFFU, 0x00000008U),
+	PSU_WRITE(DDR_PHY_MR14_OFFSET, 0xFFFFFFFFU, 0x00000019U),
+	PSU_WRITE(DDR_PHY_MR22_OFFSET, 0xFFFFFFFFU, 0x00000016U),
+	PSU_WRITE(DDR_PHY_DTCR0_OFFSET, 0xFFFFFFFFU, 0x800091C7U),
+	PSU_WRITE(DDR_PHY_DTCR1_OFFSET, 0xFFFFFFFFU, 0x00010236U),
+	PSU_WRITE(DDR_PHY_CATR0_OFFSET, 0xFFFFFFFFU, 0x00141054U),
+	PSU_WRITE(DDR_PHY_DQSDR0_OFFSET, 0xFFFFFFFFU, 0x00088000U),
+	PSU_WRITE(DDR_PHY_BISTLSR_OFFSET, 0xFFFFFFFFU, 0x12340400U),
+	PSU_WRITE(DDR_PHY_RIOCR5_OFFSET, 0xFFFFFFFFU, 0x0000000AU),
+	PSU_WRITE(DDR_PHY_ACIOCR0_OFFSET, 0xFFFFFFFFU, 0x30000028U),
+	PSU_WRITE(DDR_PHY_ACIOCR2_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDR_PHY_ACIOCR3_OFFSET, 0xFFFFFFFFU, 0x00000005U),
+	PSU_WRITE(DDR_PHY_ACIOCR4_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDR_PHY_IOVCR0_OFFSET, 0xFFFFFFFFU, 0x0300BD99U),
+	PSU_WRITE(DDR_PHY_VTCR0_OFFSET, 0xFFFFFFFFU, 0xF1032019U),
+	PSU_WRITE(DDR_PHY_VTCR1_OFFSET, 0xFFFFFFFFU, 0x07F001E3U),
+	PSU_WRITE(DDR_PHY_ACBDLR1_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDR_PHY_ACBDLR2_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDR_PHY_ACBDLR6_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDR_PHY_ACBDLR7_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDR_PHY_ACBDLR8_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDR_PHY_ACBDLR9_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_WRITE(DDR_PHY_ZQCR_OFFSET, 0xFFFFFFFFU, 0x00894C58U),
+	PSU_WRITE(DDR_PHY_ZQ0PR0_OFFSET, 0xFFFFFFFFU, 0x0001B39BU),
+	PSU_WRITE(DDR_PHY_ZQ0OR0_OFFSET, 0xFFFFFFFFU, 0x01E10210U),
+	PSU_WRITE(DDR_PHY_ZQ0OR1_OFFSET, 0xFFFFFFFFU, 0x01E10000U),
+	PSU_WRITE(DDR_PHY_ZQ1PR0_OFFSET, 0xFFFFFFFFU, 0x0001BB9BU),
+	PSU_WRITE(DDR_PHY_DX0GCR0_OFFSET, 0xFFFFFFFFU, 0x40800604U),
+	PSU_WRITE(DDR_PHY_DX0GCR1_OFFSET, 0xFFFFFFFFU, 0x00007FFFU),
+	PSU_WRITE(DDR_PHY_DX0GCR3_OFFSET, 0xFFFFFFFFU, 0x3F000008U),
+	PSU_WRITE(DDR_PHY_DX0GCR4_OFFSET, 0xFFFFFFFFU, 0x0E00F504U),
+	PSU_WRITE(DDR_PHY_DX0GCR5_OFFSET, 0xFFFFFFFFU, 0x09091616U),
+	PSU_WRITE(DDR_PHY_DX0GCR6_OFFSET, 0xFFFFFFFFU, 0x09092B2BU),
+	PSU_WRITE(DDR_PHY_DX1GCR0_OFFSET, 0xFFFFFFFFU, 0x40800604U),
+	PSU_WRITE(DDR_PHY_DX1GCR1_OFFSET, 0xFFFFFFFFU, 0x00007FFFU),
+	PSU_WRITE(DDR_PHY_DX1GCR3_OFFSET, 0xFFFFFFFFU, 0x3F000008U),
+	PSU_WRITE(DDR_PHY_DX1GCR4_OFFSET, 0xFFFFFFFFU, 0x0E00F504U),
+	PSU_WRITE(DDR_PHY_DX1GCR5_OFFSET, 0xFFFFFFFFU, 0x09091616U),
+	PSU_WRITE(DDR_PHY_DX1GCR6_OFFSET, 0xFFFFFFFFU, 0x09092B2BU),
+	PSU_WRITE(DDR_PHY_DX2GCR0_OFFSET, 0xFFFFFFFFU, 0x40800604U),
+	PSU_WRITE(DDR_PHY_DX2GCR1_OFFSET, 0xFFFFFFFFU, 0x00007FFFU),
+	PSU_WRITE(DDR_PHY_DX2GCR3_OFFSET, 0xFFFFFFFFU, 0x3F000008U),
+	PSU_WRITE(DDR_PHY_DX2GCR4_OFFSET, 0xFFFFFFFFU, 0x0E00F504U),
+	PSU_WRITE(DDR_PHY_DX2GCR5_OFFSET, 0xFFFFFFFFU, 0x09091616U),
+	PSU_WRITE(DDR_PHY_DX2GCR6_OFFSET, 0xFFFFFFFFU, 0x09092B2BU),
+	PSU_WRITE(DDR_PHY_DX3GCR0_OFFSET, 0xFFFFFFFFU, 0x40800604U),
+	PSU_WRITE(DDR_PHY_DX3GCR1_OFFSET, 0xFFFFFFFFU, 0x00007FFFU),
+	PSU_WRITE(DDR_PHY_DX3GCR3_OFFSET, 0xFFFFFFFFU, 0x3F000008U),
+	PSU_WRITE(DDR_PHY_DX3GCR4_OFFSET, 0xFFFFFFFFU, 0x0E00F504U),
+	PSU_WRITE(DDR_PHY_DX3GCR5_OFFSET, 0xFFFFFFFFU, 0x09091616U),
+	PSU_WRITE(DDR_PHY_DX3GCR6_OFFSET, 0xFFFFFFFFU, 0x09092B2BU),
+	PSU_WRITE(DDR_PHY_DX4GCR0_OFFSET, 0xFFFFFFFFU, 0x80803660U),
+	PSU_WRITE(DDR_PHY_DX4GCR1_OFFSET, 0xFFFFFFFFU, 0x55556000U),
+	PSU_WRITE(DDR_PHY_DX4GCR2_OFFSET, 0xFFFFFFFFU, 0xAAAAAAAAU),
+	PSU_WRITE(DDR_PHY_DX4GCR3_OFFSET, 0xFFFFFFFFU, 0x0029A4A4U),
+	PSU_WRITE(DDR_PHY_DX4GCR4_OFFSET, 0xFFFFFFFFU, 0x0C00BD00U),
+	PSU_WRITE(DDR_PHY_DX4GCR5_OFFSET, 0xFFFFFFFFU, 0x09091616U),
+	PSU_WRITE(DDR_PHY_DX4GCR6_OFFSET, 0xFFFFFFFFU, 0x09092B2BU),
+	PSU_WRITE(DDR_PHY_DX5GCR0_OFFSET, 0xFFFFFFFFU, 0x80803660U),
+	PSU_WRITE(DDR_PHY_DX5GCR1_OFFSET, 0xFFFFFFFFU, 0x55556000U),
+	PSU_WRITE(DDR_PHY_DX5GCR2_OFFSET, 0xFFFFFFFFU, 0xAAAAAAAAU),
+	PSU_WRITE(DDR_PHY_DX5GCR3_OFFSET, 0xFFFFFFFFU, 0x0029A4A4U),
+	PSU_WRITE(DDR_PHY_DX5GCR4_OFFSET, 0xFFFFFFFFU, 0x0C00BD00U),
+	PSU_WRITE(DDR_PHY_DX5GCR5_OFFSET, 0xFFFFFFFFU, 0x09091616U),
+	PSU_WRITE(DDR_PHY_DX5GCR6_OFFSET, 0xFFFFFFFFU, 0x09092B2BU),
+	PSU_WRITE(DDR_PHY_DX6GCR0_OFFSET, 0xFFFFFFFFU, 0x80803660U),
+	PSU_WRITE(DDR_PHY_DX6GCR1_OFFSET, 0xFFFFFFFFU, 0x55556000U),
+	PSU_WRITE(DDR_PHY_DX6GCR2_OFFSET, 0xFFFFFFFFU, 0xAAAAAAAAU),
+	PSU_WRITE(DDR_PHY_DX6GCR3_OFFSET, 0xFFFFFFFFU, 0x0029A4A4U),
+	PSU_WRITE(DDR_PHY_DX6GCR4_OFFSET, 0xFFFFFFFFU, 0x0C00BD00U),
+	PSU_WRITE(DDR_PHY_DX6GCR5_OFFSET, 0xFFFFFFFFU, 0x09091616U),
+	PSU_WRITE(DDR_PHY_DX6GCR6_OFFSET, 0xFFFFFFFFU, 0x09092B2BU),
+	PSU_WRITE(DDR_PHY_DX7GCR0_OFFSET, 0xFFFFFFFFU, 0x80803660U),
+	PSU_WRITE(DDR_PHY_DX7GCR1_OFFSET, 0xFFFFFFFFU, 0x55556000U),
+	PSU_WRITE(DDR_PHY_DX7GCR2_OFFSET, 0xFFFFFFFFU, 0xAAAAAAAAU),
+	PSU_WRITE(DDR_PHY_DX7GCR3_OFFSET, 0xFFFFFFFFU, 0x0029A4A4U),
+	PSU_WRITE(DDR_PHY_DX7GCR4_OFFSET, 0xFFFFFFFFU, 0x0C00BD00U),
+	PSU_WRITE(DDR_PHY_DX7GCR5_OFFSET, 0xFFFFFFFFU, 0x09091616U),
+	PSU_WRITE(DDR_PHY_DX7GCR6_OFFSET, 0xFFFFFFFFU, 0x09092B2BU),
+	PSU_WRITE(DDR_PHY_DX8GCR0_OFFSET, 0xFFFFFFFFU, 0x80803660U),
+	PSU_WRITE(DDR_PHY_DX8GCR1_OFFSET, 0xFFFFFFFFU, 0x55556000U),
+	PSU_WRITE(DDR_PHY_DX8GCR2_OFFSET, 0xFFFFFFFFU, 0xAAAAAAAAU),
+	PSU_WRITE(DDR_PHY_DX8GCR3_OFFSET, 0xFFFFFFFFU, 0x0029A4A4U),
+	PSU_WRITE(DDR_PHY_DX8GCR4_OFFSET, 0xFFFFFFFFU, 0x0C00BD00U),
+	PSU_WRITE(DDR_PHY_DX8GCR5_OFFSET, 0xFFFFFFFFU, 0x09091616U),
+	PSU_WRITE(DDR_PHY_DX8GCR6_OFFSET, 0xFFFFFFFFU, 0x09092B2BU),
+	PSU_WRITE(DDR_PHY_DX8SL0OSC_OFFSET, 0xFFFFFFFFU, 0x2A019FFEU),
+	PSU_WRITE(DDR_PHY_DX8SL0PLLCR0_OFFSET, 0xFFFFFFFFU, 0x05102000U),
+	PSU_WRITE(DDR_PHY_DX8SL0DQSCTL_OFFSET, 0xFFFFFFFFU, 0x01264300U),
+	PSU_WRITE(DDR_PHY_DX8SL0DXCTL2_OFFSET, 0xFFFFFFFFU, 0x000C1800U),
+	PSU_WRITE(DDR_PHY_DX8SL0IOCR_OFFSET, 0xFFFFFFFFU, 0x71000000U),
+	PSU_WRITE(DDR_PHY_DX8SL1OSC_OFFSET, 0xFFFFFFFFU, 0x2A019FFEU),
+	PSU_WRITE(DDR_PHY_DX8SL1PLLCR0_OFFSET, 0xFFFFFFFFU, 0x05102000U),
+	PSU_WRITE(DDR_PHY_DX8SL1DQSCTL_OFFSET, 0xFFFFFFFFU, 0x01264300U),
+	PSU_WRITE(DDR_PHY_DX8SL1DXCTL2_OFFSET, 0xFFFFFFFFU, 0x000C1800U),
+	PSU_WRITE(DDR_PHY_DX8SL1IOCR_OFFSET, 0xFFFFFFFFU, 0x71000000U),
+	PSU_WRITE(DDR_PHY_DX8SL2OSC_OFFSET, 0xFFFFFFFFU, 0x15019FFEU),
+	PSU_WRITE(DDR_PHY_DX8SL2PLLCR0_OFFSET, 0xFFFFFFFFU, 0x25102000U),
+	PSU_WRITE(DDR_PHY_DX8SL2DQSCTL_OFFSET, 0xFFFFFFFFU, 0x01266300U),
+	PSU_WRITE(DDR_PHY_DX8SL2DXCTL2_OFFSET, 0xFFFFFFFFU, 0x000C1800U),
+	PSU_WRITE(DDR_PHY_DX8SL2IOCR_OFFSET, 0xFFFFFFFFU, 0x70400000U),
+	PSU_WRITE(DDR_PHY_DX8SL3OSC_OFFSET, 0xFFFFFFFFU, 0x15019FFEU),
+	PSU_WRITE(DDR_PHY_DX8SL3PLLCR0_OFFSET, 0xFFFFFFFFU, 0x25102000U),
+	PSU_WRITE(DDR_PHY_DX8SL3DQSCTL_OFFSET, 0xFFFFFFFFU, 0x01266300U),
+	PSU_WRITE(DDR_PHY_DX8SL3DXCTL2_OFFSET, 0xFFFFFFFFU, 0x000C1800U),
+	PSU_WRITE(DDR_PHY_DX8SL3IOCR_OFFSET, 0xFFFFFFFFU, 0x70400000U),
+	PSU_WRITE(DDR_PHY_DX8SL4OSC_OFFSET, 0xFFFFFFFFU, 0x15019FFEU),
+	PSU_WRITE(DDR_PHY_DX8SL4PLLCR0_OFFSET, 0xFFFFFFFFU, 0x25102000U),
+	PSU_WRITE(DDR_PHY_DX8SL4DQSCTL_OFFSET, 0xFFFFFFFFU, 0x01266300U),
+	PSU_WRITE(DDR_PHY_DX8SL4DXCTL2_OFFSET, 0xFFFFFFFFU, 0x000C1800U),
+	PSU_WRITE(DDR_PHY_DX8SL4IOCR_OFFSET, 0xFFFFFFFFU, 0x70400000U),
+	PSU_WRITE(DDR_PHY_DX8SLBDQSCTL_OFFSET, 0xFFFFFFFFU, 0x012643C4U),
+};
+
+unsigned long psu_ddr_init_data(void)
+{
+	return PSU_TABLE_RUN(PsuDdrInitOps);
+}
+static const PsuOp PsuDdrQosInitOps[] = {
+	PSU_WRITE(AFIFM0_AFIFM_RDQOS_OFFSET, 0x0000000FU, 0x00000000U),
+	PSU_WRITE(AFIFM0_AFIFM_WRQOS_OFFSET, 0x0000000FU, 0x00000000U),
+	PSU_WRITE(AFIFM1_AFIFM_RDQOS_OFFSET, 0x0000000FU, 0x00000000U),
+	PSU_WRITE(AFIFM1_AFIFM_WRQOS_OFFSET, 0x0000000FU, 0x00000000U),
+	PSU_WRITE(AFIFM2_AFIFM_RDQOS_OFFSET, 0x0000000FU, 0x00000000U),
+	PSU_WRITE(AFIFM2_AFIFM_WRQOS_OFFSET, 0x0000000FU, 0x00000000U),
+	PSU_WRITE(AFIFM3_AFIFM_RDQOS_OFFSET, 0x0000000FU, 0x00000000U),
+	PSU_WRITE(AFIFM3_AFIFM_WRQOS_OFFSET, 0x0000000FU, 0x00000000U),
+	PSU_WRITE(AFIFM4_AFIFM_RDQOS_OFFSET, 0x0000000FU, 0x00000000U),
+	PSU_WRITE(AFIFM4_AFIFM_WRQOS_OFFSET, 0x0000000FU, 0x00000000U),
+	PSU_WRITE(AFIFM5_AFIFM_RDQOS_OFFSET, 0x0000000FU, 0x00000000U),
+	PSU_WRITE(AFIFM5_AFIFM_WRQOS_OFFSET, 0x0000000FU, 0x00000000U),
+	PSU_WRITE(AFIFM6_AFIFM_RDQOS_OFFSET, 0x0000000FU, 0x00000000U),
+	PSU_WRITE(AFIFM6_AFIFM_WRQOS_OFFSET, 0x0000000FU, 0x00000000U),
+};
+
+unsigned long psu_ddr_qos_init_data(void)
+{
+	return PSU_TABLE_RUN(PsuDdrQosInitOps);
+}
+static const PsuOp PsuMioInitOps[] = {
+	PSU_WRITE(IOU_SLCR_MIO_PIN_0_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_1_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_2_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_3_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_4_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_5_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_6_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_7_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_8_OFFSET, 0x000000FEU, 0x00000040U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_9_OFFSET, 0x000000FEU, 0x00000040U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_10_OFFSET, 0x000000FEU, 0x000000C0U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_11_OFFSET, 0x000000FEU, 0x000000C0U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_12_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_13_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_14_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_15_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_16_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_17_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_18_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_19_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_20_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_21_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_22_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_23_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_24_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_25_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_26_OFFSET, 0x000000FEU, 0x00000008U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_27_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_28_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_29_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_30_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_31_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_32_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_33_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_35_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_36_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_37_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_38_OFFSET, 0x000000FEU, 0x00000080U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_39_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_40_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_41_OFFSET, 0x000000FEU, 0x00000080U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_42_OFFSET, 0x000000FEU, 0x00000080U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_43_OFFSET, 0x000000FEU, 0x00000080U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_44_OFFSET, 0x000000FEU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_45_OFFSET, 0x000000FEU, 0x00000010U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_46_OFFSET, 0x000000FEU, 0x00000010U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_47_OFFSET, 0x000000FEU, 0x00000010U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_48_OFFSET, 0x000000FEU, 0x00000010U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_49_OFFSET, 0x000000FEU, 0x00000010U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_50_OFFSET, 0x000000FEU, 0x00000010U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_51_OFFSET, 0x000000FEU, 0x00000010U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_52_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_53_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_54_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_55_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_56_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_57_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_58_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_59_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_60_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_61_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_62_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_63_OFFSET, 0x000000FEU, 0x00000002U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_64_OFFSET, 0x000000FEU, 0x00000004U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_65_OFFSET, 0x000000FEU, 0x00000004U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_66_OFFSET, 0x000000FEU, 0x00000004U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_67_OFFSET, 0x000000FEU, 0x00000004U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_68_OFFSET, 0x000000FEU, 0x00000004U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_69_OFFSET, 0x000000FEU, 0x00000004U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_70_OFFSET, 0x000000FEU, 0x00000004U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_71_OFFSET, 0x000000FEU, 0x00000004U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_72_OFFSET, 0x000000FEU, 0x00000004U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_73_OFFSET, 0x000000FEU, 0x00000004U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_74_OFFSET, 0x000000FEU, 0x00000004U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_75_OFFSET, 0x000000FEU, 0x00000004U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_76_OFFSET, 0x000000FEU, 0x000000A0U),
+	PSU_WRITE(IOU_SLCR_MIO_PIN_77_OFFSET, 0x000000FEU, 0x000000A0U),
+	PSU_WRITE(IOU_SLCR_MIO_MST_TRI0_OFFSET, 0xFFFFFFFFU, 0x04000400U),
+	PSU_WRITE(IOU_SLCR_MIO_MST_TRI1_OFFSET, 0xFFFFFFFFU, 0xFC002000U),
+	PSU_WRITE(IOU_SLCR_MIO_MST_TRI2_OFFSET, 0x00003FFFU, 0x0000000BU),
+	PSU_WRITE(IOU_SLCR_BANK0_CTRL0_OFFSET, 0x03FFFFFFU, 0x03FFFFFFU),
+	PSU_WRITE(IOU_SLCR_BANK0_CTRL1_OFFSET, 0x03FFFFFFU, 0x03FFFFFFU),
+	PSU_WRITE(IOU_SLCR_BANK0_CTRL3_OFFSET, 0x03FFFFFFU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_BANK0_CTRL4_OFFSET, 0x03FFFFFFU, 0x00FFFF7FU),
+	PSU_WRITE(IOU_SLCR_BANK0_CTRL5_OFFSET, 0x03FFFFFFU, 0x03FFFFFFU),
+	PSU_WRITE(IOU_SLCR_BANK0_CTRL6_OFFSET, 0x03FFFFFFU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_BANK1_CTRL0_OFFSET, 0x03FFFFFFU, 0x000FFFFFU),
+	PSU_WRITE(IOU_SLCR_BANK1_CTRL1_OFFSET, 0x03FFFFFFU, 0x03FFFFFFU),
+	PSU_WRITE(IOU_SLCR_BANK1_CTRL3_OFFSET, 0x03FFFFFFU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_BANK1_CTRL4_OFFSET, 0x03FFFFFFU, 0x03FFFF7FU),
+	PSU_WRITE(IOU_SLCR_BANK1_CTRL5_OFFSET, 0x03FFFFFFU, 0x03FFFFFFU),
+	PSU_WRITE(IOU_SLCR_BANK1_CTRL6_OFFSET, 0x03FFFFFFU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_BANK2_CTRL0_OFFSET, 0x03FFFFFFU, 0x03FFFFFFU),
+	PSU_WRITE(IOU_SLCR_BANK2_CTRL1_OFFSET, 0x03FFFFFFU, 0x03FFFFFFU),
+	PSU_WRITE(IOU_SLCR_BANK2_CTRL3_OFFSET, 0x03FFFFFFU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_BANK2_CTRL4_OFFSET, 0x03FFFFFFU, 0x03FFFFFFU),
+	PSU_WRITE(IOU_SLCR_BANK2_CTRL5_OFFSET, 0x03FFFFFFU, 0x03FFFFFFU),
+	PSU_WRITE(IOU_SLCR_BANK2_CTRL6_OFFSET, 0x03FFFFFFU, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_MIO_LOOPBACK_OFFSET, 0x0000000FU, 0x00000000U),
+};
+
+unsigned long psu_mio_init_data(void)
+{
+	return PSU_TABLE_RUN(PsuMioInitOps);
+}
+static const PsuOp PsuPeripheralsPreInitOps[] = {
+	PSU_WRITE(CRL_APB_AMS_REF_CTRL_OFFSET, 0x013F3F07U, 0x01012302U),
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x00000001U, 0x00000001U),
+};
+
+unsigned long psu_peripherals_pre_init_data(void)
+{
+	return PSU_TABLE_RUN(PsuPeripheralsPreInitOps);
+}
+#ifndef PSU_PERIPH_LAZY
+static const PsuOp PsuPeripheralsInitOps[] = {
+	PSU_WRITE(CRF_APB_RST_FPD_TOP_OFFSET, 0x00008044U, 0x00000000U),
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x001A0000U, 0x00000000U),
+	PSU_WRITE(CRL_APB_RST_LPD_TOP_OFFSET, 0x0093C018U, 0x00000000U),
+	PSU_WRITE(CRL_APB_RST_LPD_IOU0_OFFSET, 0x00000004U, 0x00000000U),
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x00000001U, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_IOU_TAPDLY_BYPASS_OFFSET, 0x00000004U, 0x00000000U),
+	PSU_WRITE(CRL_APB_RST_LPD_TOP_OFFSET, 0x00000800U, 0x00000000U),
+	PSU_WRITE(CRL_APB_RST_LPD_TOP_OFFSET, 0x00000280U, 0x00000280U),
+	PSU_WRITE(USB3_1_FPD_POWER_PRSNT_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(USB3_1_FPD_PIPE_CLK_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(CRL_APB_RST_LPD_TOP_OFFSET, 0x00000280U, 0x00000000U),
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x00000040U, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_CTRL_REG_SD_OFFSET, 0x00008000U, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_SD_CONFIG_REG2_OFFSET, 0x33840000U, 0x00800000U),
+	PSU_WRITE(IOU_SLCR_SD_CONFIG_REG1_OFFSET, 0x7FFE0000U, 0x64500000U),
+	PSU_WRITE(IOU_SLCR_SD_DLL_CTRL_OFFSET, 0x00000008U, 0x00000008U),
+	PSU_WRITE(IOU_SLCR_SD_CONFIG_REG3_OFFSET, 0x03C00000U, 0x00000000U),
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x00000400U, 0x00000000U),
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x00008000U, 0x00000000U),
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x00000008U, 0x00000000U),
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x00007800U, 0x00000000U),
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x00000002U, 0x00000000U),
+	PSU_WRITE(UART0_BAUD_RATE_DIVIDER_REG0_OFFSET, 0x000000FFU, 0x00000006U),
+	PSU_WRITE(UART0_BAUD_RATE_GEN_REG0_OFFSET, 0x0000FFFFU, 0x0000007CU),
+	PSU_WRITE(UART0_CONTROL_REG0_OFFSET, 0x000001FFU, 0x00000017U),
+	PSU_WRITE(UART0_MODE_REG0_OFFSET, 0x000003FFU, 0x00000020U),
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x00040000U, 0x00000000U),
+	PSU_WRITE(LPD_SLCR_SECURE_SLCR_ADMA_OFFSET, 0x000000FFU, 0x000000FFU),
+	PSU_WRITE(CSU_TAMPER_STATUS_OFFSET, 0x00001FFFU, 0x00000000U),
+	PSU_WRITE(APU_ACE_CTRL_OFFSET, 0x000F000FU, 0x00000000U),
+	PSU_WRITE(RTC_CONTROL_OFFSET, 0x80000000U, 0x80000000U),
+	PSU_WRITE(IOU_SCNTRS_BASE_FREQUENCY_ID_REGISTER_OFFSET, 0xFFFFFFFFU, 0x05F5E100U),
+	PSU_WRITE(IOU_SCNTRS_COUNTER_CONTROL_REGISTER_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(CRL_APB_BOOT_PIN_CTRL_OFFSET, 0x00000F0FU, 0x00000202U),
+	PSU_DELAY(1),
+	PSU_WRITE(CRL_APB_BOOT_PIN_CTRL_OFFSET, 0x00000F0FU, 0x00000002U),
+	PSU_DELAY(5),
+	PSU_WRITE(CRL_APB_BOOT_PIN_CTRL_OFFSET, 0x00000F0FU, 0x00000202U),
+};
+#endif
+
+unsigned long psu_peripherals_init_data(void)
+{
+#ifdef PSU_PERIPH_LAZY
+	return PsuPeriph_Boot();
+#else
+	return PSU_TABLE_RUN(PsuPeripheralsInitOps);
+#endif
+}
+unsigned long psu_post_config_data(void)
+{
+    /*
+    * POST_CONFIG
+    */
+
+	return 1;
+}
+static const PsuOp PsuPeripheralsPowerdwnOps[] = {
+	PSU_WRITE(PMU_GLOBAL_REQ_PWRDWN_INT_EN_OFFSET, 0x0000003CU, 0x0000003CU),
+	PSU_WRITE(PMU_GLOBAL_REQ_PWRDWN_TRIG_OFFSET, 0x0000003CU, 0x0000003CU),
+};
+
+unsigned long psu_peripherals_powerdwn_data(void)
+{
+	return PSU_TABLE_RUN(PsuPeripheralsPowerdwnOps);
+}
+unsigned long psu_lpd_xppu_data(void)
+{
+    /*
+    * MASTER ID LIST
+    */
+    /*
+    * APERTURE PERMISIION LIST
+    */
+    /*
+    * APERTURE NAME: UART0, START ADDRESS: FF000000, END ADDRESS: FF00FFFF
+    */
+    /*
+    * APERTURE NAME: UART1, START ADDRESS: FF010000, END ADDRESS: FF01FFFF
+    */
+    /*
+    * APERTURE NAME: I2C0, START ADDRESS: FF020000, END ADDRESS: FF02FFFF
+    */
+    /*
+    * APERTURE NAME: I2C1, START ADDRESS: FF030000, END ADDRESS: FF03FFFF
+    */
+    /*
+    * APERTURE NAME: SPI0, START ADDRESS: FF040000, END ADDRESS: FF04FFFF
+    */
+    /*
+    * APERTURE NAME: SPI1, START ADDRESS: FF050000, END ADDRESS: FF05FFFF
+    */
+    /*
+    * APERTURE NAME: CAN0, START ADDRESS: FF060000, END ADDRESS: FF06FFFF
+    */
+    /*
+    * APERTURE NAME: CAN1, START ADDRESS: FF070000, END ADDRESS: FF07FFFF
+    */
+    /*
+    * APERTURE NAME: RPU_UNUSED_12, START ADDRESS: FF080000, END ADDRESS: FF09
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: RPU_UNUSED_12, START ADDRESS: FF080000, END ADDRESS: FF09
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: GPIO, START ADDRESS: FF0A0000, END ADDRESS: FF0AFFFF
+    */
+    /*
+    * APERTURE NAME: GEM0, START ADDRESS: FF0B0000, END ADDRESS: FF0BFFFF
+    */
+    /*
+    * APERTURE NAME: GEM1, START ADDRESS: FF0C0000, END ADDRESS: FF0CFFFF
+    */
+    /*
+    * APERTURE NAME: GEM2, START ADDRESS: FF0D0000, END ADDRESS: FF0DFFFF
+    */
+    /*
+    * APERTURE NAME: GEM3, START ADDRESS: FF0E0000, END ADDRESS: FF0EFFFF
+    */
+    /*
+    * APERTURE NAME: QSPI, START ADDRESS: FF0F0000, END ADDRESS: FF0FFFFF
+    */
+    /*
+    * APERTURE NAME: NAND, START ADDRESS: FF100000, END ADDRESS: FF10FFFF
+    */
+    /*
+    * APERTURE NAME: TTC0, START ADDRESS: FF110000, END ADDRESS: FF11FFFF
+    */
+    /*
+    * APERTURE NAME: TTC1, START ADDRESS: FF120000, END ADDRESS: FF12FFFF
+    */
+    /*
+    * APERTURE NAME: TTC2, START ADDRESS: FF130000, END ADDRESS: FF13FFFF
+    */
+    /*
+    * APERTURE NAME: TTC3, START ADDRESS: FF140000, END ADDRESS: FF14FFFF
+    */
+    /*
+    * APERTURE NAME: SWDT, START ADDRESS: FF150000, END ADDRESS: FF15FFFF
+    */
+    /*
+    * APERTURE NAME: SD0, START ADDRESS: FF160000, END ADDRESS: FF16FFFF
+    */
+    /*
+    * APERTURE NAME: SD1, START ADDRESS: FF170000, END ADDRESS: FF17FFFF
+    */
+    /*
+    * APERTURE NAME: IOU_SLCR, START ADDRESS: FF180000, END ADDRESS: FF23FFFF
+    */
+    /*
+    * APERTURE NAME: IOU_SLCR, START ADDRESS: FF180000, END ADDRESS: FF23FFFF
+    */
+    /*
+    * APERTURE NAME: IOU_SLCR, START ADDRESS: FF180000, END ADDRESS: FF23FFFF
+    */
+    /*
+    * APERTURE NAME: IOU_SLCR, START ADDRESS: FF180000, END ADDRESS: FF23FFFF
+    */
+    /*
+    * APERTURE NAME: IOU_SLCR, START ADDRESS: FF180000, END ADDRESS: FF23FFFF
+    */
+    /*
+    * APERTURE NAME: IOU_SLCR, START ADDRESS: FF180000, END ADDRESS: FF23FFFF
+    */
+    /*
+    * APERTURE NAME: IOU_SLCR, START ADDRESS: FF180000, END ADDRESS: FF23FFFF
+    */
+    /*
+    * APERTURE NAME: IOU_SLCR, START ADDRESS: FF180000, END ADDRESS: FF23FFFF
+    */
+    /*
+    * APERTURE NAME: IOU_SLCR, START ADDRESS: FF180000, END ADDRESS: FF23FFFF
+    */
+    /*
+    * APERTURE NAME: IOU_SLCR, START ADDRESS: FF180000, END ADDRESS: FF23FFFF
+    */
+    /*
+    * APERTURE NAME: IOU_SLCR, START ADDRESS: FF180000, END ADDRESS: FF23FFFF
+    */
+    /*
+    * APERTURE NAME: IOU_SLCR, START ADDRESS: FF180000, END ADDRESS: FF23FFFF
+    */
+    /*
+    * APERTURE NAME: IOU_SECURE_SLCR, START ADDRESS: FF240000, END ADDRESS: FF
+    * 24FFFF
+    */
+    /*
+    * APERTURE NAME: IOU_SCNTR, START ADDRESS: FF250000, END ADDRESS: FF25FFFF
+    */
+    /*
+    * APERTURE NAME: IOU_SCNTRS, START ADDRESS: FF260000, END ADDRESS: FF26FFF
+    * F
+    */
+    /*
+    * APERTURE NAME: RPU_UNUSED_11, START ADDRESS: FF270000, END ADDRESS: FF2A
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: RPU_UNUSED_11, START ADDRESS: FF270000, END ADDRESS: FF2A
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: RPU_UNUSED_11, START ADDRESS: FF270000, END ADDRESS: FF2A
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: RPU_UNUSED_11, START ADDRESS: FF270000, END ADDRESS: FF2A
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_14, START ADDRESS: FF2B0000, END ADDRESS: FF2F
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_14, START ADDRESS: FF2B0000, END ADDRESS: FF2F
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_14, START ADDRESS: FF2B0000, END ADDRESS: FF2F
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_14, START ADDRESS: FF2B0000, END ADDRESS: FF2F
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_14, START ADDRESS: FF2B0000, END ADDRESS: FF2F
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_CTRL, START ADDRESS: FF380000, END ADDRESS: FF3FFFFF
+    */
+    /*
+    * APERTURE NAME: IPI_CTRL, START ADDRESS: FF380000, END ADDRESS: FF3FFFFF
+    */
+    /*
+    * APERTURE NAME: IPI_CTRL, START ADDRESS: FF380000, END ADDRESS: FF3FFFFF
+    */
+    /*
+    * APERTURE NAME: IPI_CTRL, START ADDRESS: FF380000, END ADDRESS: FF3FFFFF
+    */
+    /*
+    * APERTURE NAME: IPI_CTRL, START ADDRESS: FF380000, END ADDRESS: FF3FFFFF
+    */
+    /*
+    * APERTURE NAME: IPI_CTRL, START ADDRESS: FF380000, END ADDRESS: FF3FFFFF
+    */
+    /*
+    * APERTURE NAME: IPI_CTRL, START ADDRESS: FF380000, END ADDRESS: FF3FFFFF
+    */
+    /*
+    * APERTURE NAME: IPI_CTRL, START ADDRESS: FF380000, END ADDRESS: FF3FFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_1, START ADDRESS: FF400000, END ADDRESS: FF40F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_SLCR, START ADDRESS: FF410000, END ADDRESS: FF4AFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_SLCR, START ADDRESS: FF410000, END ADDRESS: FF4AFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_SLCR, START ADDRESS: FF410000, END ADDRESS: FF4AFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_SLCR, START ADDRESS: FF410000, END ADDRESS: FF4AFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_SLCR, START ADDRESS: FF410000, END ADDRESS: FF4AFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_SLCR, START ADDRESS: FF410000, END ADDRESS: FF4AFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_SLCR, START ADDRESS: FF410000, END ADDRESS: FF4AFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_SLCR, START ADDRESS: FF410000, END ADDRESS: FF4AFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_SLCR, START ADDRESS: FF410000, END ADDRESS: FF4AFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_SLCR, START ADDRESS: FF410000, END ADDRESS: FF4AFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_SLCR_SECURE, START ADDRESS: FF4B0000, END ADDRESS: FF
+    * 4DFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_SLCR_SECURE, START ADDRESS: FF4B0000, END ADDRESS: FF
+    * 4DFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_SLCR_SECURE, START ADDRESS: FF4B0000, END ADDRESS: FF
+    * 4DFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_2, START ADDRESS: FF4E0000, END ADDRESS: FF5DF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_2, START ADDRESS: FF4E0000, END ADDRESS: FF5DF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_2, START ADDRESS: FF4E0000, END ADDRESS: FF5DF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_2, START ADDRESS: FF4E0000, END ADDRESS: FF5DF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_2, START ADDRESS: FF4E0000, END ADDRESS: FF5DF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_2, START ADDRESS: FF4E0000, END ADDRESS: FF5DF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_2, START ADDRESS: FF4E0000, END ADDRESS: FF5DF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_2, START ADDRESS: FF4E0000, END ADDRESS: FF5DF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_2, START ADDRESS: FF4E0000, END ADDRESS: FF5DF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_2, START ADDRESS: FF4E0000, END ADDRESS: FF5DF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_2, START ADDRESS: FF4E0000, END ADDRESS: FF5DF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_2, START ADDRESS: FF4E0000, END ADDRESS: FF5DF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_2, START ADDRESS: FF4E0000, END ADDRESS: FF5DF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_2, START ADDRESS: FF4E0000, END ADDRESS: FF5DF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_2, START ADDRESS: FF4E0000, END ADDRESS: FF5DF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_2, START ADDRESS: FF4E0000, END ADDRESS: FF5DF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: CRL_APB, START ADDRESS: FF5E0000, END ADDRESS: FF85FFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_3, START ADDRESS: FF860000, END ADDRESS: FF95F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_3, START ADDRESS: FF860000, END ADDRESS: FF95F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_3, START ADDRESS: FF860000, END ADDRESS: FF95F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_3, START ADDRESS: FF860000, END ADDRESS: FF95F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_3, START ADDRESS: FF860000, END ADDRESS: FF95F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_3, START ADDRESS: FF860000, END ADDRESS: FF95F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_3, START ADDRESS: FF860000, END ADDRESS: FF95F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_3, START ADDRESS: FF860000, END ADDRESS: FF95F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_3, START ADDRESS: FF860000, END ADDRESS: FF95F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_3, START ADDRESS: FF860000, END ADDRESS: FF95F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_3, START ADDRESS: FF860000, END ADDRESS: FF95F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_3, START ADDRESS: FF860000, END ADDRESS: FF95F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_3, START ADDRESS: FF860000, END ADDRESS: FF95F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_3, START ADDRESS: FF860000, END ADDRESS: FF95F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_3, START ADDRESS: FF860000, END ADDRESS: FF95F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_3, START ADDRESS: FF860000, END ADDRESS: FF95F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: OCM_SLCR, START ADDRESS: FF960000, END ADDRESS: FF96FFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_4, START ADDRESS: FF970000, END ADDRESS: FF97F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_XPPU, START ADDRESS: FF980000, END ADDRESS: FF99FFFF
+    */
+    /*
+    * APERTURE NAME: RPU, START ADDRESS: FF9A0000, END ADDRESS: FF9AFFFF
+    */
+    /*
+    * APERTURE NAME: AFIFM6, START ADDRESS: FF9B0000, END ADDRESS: FF9BFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_XPPU_SINK, START ADDRESS: FF9C0000, END ADDRESS: FF9C
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: USB3_0, START ADDRESS: FF9D0000, END ADDRESS: FF9DFFFF
+    */
+    /*
+    * APERTURE NAME: USB3_1, START ADDRESS: FF9E0000, END ADDRESS: FF9EFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_5, START ADDRESS: FF9F0000, END ADDRESS: FF9FF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: APM0, START ADDRESS: FFA00000, END ADDRESS: FFA0FFFF
+    */
+    /*
+    * APERTURE NAME: APM1, START ADDRESS: FFA10000, END ADDRESS: FFA1FFFF
+    */
+    /*
+    * APERTURE NAME: APM_INTC_IOU, START ADDRESS: FFA20000, END ADDRESS: FFA2F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: APM_FPD_LPD, START ADDRESS: FFA30000, END ADDRESS: FFA3FF
+    * FF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_6, START ADDRESS: FFA40000, END ADDRESS: FFA4F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: AMS, START ADDRESS: FFA50000, END ADDRESS: FFA5FFFF
+    */
+    /*
+    * APERTURE NAME: RTC, START ADDRESS: FFA60000, END ADDRESS: FFA6FFFF
+    */
+    /*
+    * APERTURE NAME: OCM_XMPU_CFG, START ADDRESS: FFA70000, END ADDRESS: FFA7F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: ADMA_0, START ADDRESS: FFA80000, END ADDRESS: FFA8FFFF
+    */
+    /*
+    * APERTURE NAME: ADMA_1, START ADDRESS: FFA90000, END ADDRESS: FFA9FFFF
+    */
+    /*
+    * APERTURE NAME: ADMA_2, START ADDRESS: FFAA0000, END ADDRESS: FFAAFFFF
+    */
+    /*
+    * APERTURE NAME: ADMA_3, START ADDRESS: FFAB0000, END ADDRESS: FFABFFFF
+    */
+    /*
+    * APERTURE NAME: ADMA_4, START ADDRESS: FFAC0000, END ADDRESS: FFACFFFF
+    */
+    /*
+    * APERTURE NAME: ADMA_5, START ADDRESS: FFAD0000, END ADDRESS: FFADFFFF
+    */
+    /*
+    * APERTURE NAME: ADMA_6, START ADDRESS: FFAE0000, END ADDRESS: FFAEFFFF
+    */
+    /*
+    * APERTURE NAME: ADMA_7, START ADDRESS: FFAF0000, END ADDRESS: FFAFFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_7, START ADDRESS: FFB00000, END ADDRESS: FFBFF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_7, START ADDRESS: FFB00000, END ADDRESS: FFBFF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_7, START ADDRESS: FFB00000, END ADDRESS: FFBFF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_7, START ADDRESS: FFB00000, END ADDRESS: FFBFF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_7, START ADDRESS: FFB00000, END ADDRESS: FFBFF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_7, START ADDRESS: FFB00000, END ADDRESS: FFBFF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_7, START ADDRESS: FFB00000, END ADDRESS: FFBFF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_7, START ADDRESS: FFB00000, END ADDRESS: FFBFF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_7, START ADDRESS: FFB00000, END ADDRESS: FFBFF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_7, START ADDRESS: FFB00000, END ADDRESS: FFBFF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_7, START ADDRESS: FFB00000, END ADDRESS: FFBFF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_7, START ADDRESS: FFB00000, END ADDRESS: FFBFF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_7, START ADDRESS: FFB00000, END ADDRESS: FFBFF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_7, START ADDRESS: FFB00000, END ADDRESS: FFBFF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_7, START ADDRESS: FFB00000, END ADDRESS: FFBFF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_7, START ADDRESS: FFB00000, END ADDRESS: FFBFF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: CSU_ROM, START ADDRESS: FFC00000, END ADDRESS: FFC1FFFF
+    */
+    /*
+    * APERTURE NAME: CSU_ROM, START ADDRESS: FFC00000, END ADDRESS: FFC1FFFF
+    */
+    /*
+    * APERTURE NAME: CSU_LOCAL, START ADDRESS: FFC20000, END ADDRESS: FFC2FFFF
+    */
+    /*
+    * APERTURE NAME: PUF, START ADDRESS: FFC30000, END ADDRESS: FFC3FFFF
+    */
+    /*
+    * APERTURE NAME: CSU_RAM, START ADDRESS: FFC40000, END ADDRESS: FFC5FFFF
+    */
+    /*
+    * APERTURE NAME: CSU_RAM, START ADDRESS: FFC40000, END ADDRESS: FFC5FFFF
+    */
+    /*
+    * APERTURE NAME: CSU_IOMODULE, START ADDRESS: FFC60000, END ADDRESS: FFC7F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: CSU_IOMODULE, START ADDRESS: FFC60000, END ADDRESS: FFC7F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: CSUDMA, START ADDRESS: FFC80000, END ADDRESS: FFC9FFFF
+    */
+    /*
+    * APERTURE NAME: CSUDMA, START ADDRESS: FFC80000, END ADDRESS: FFC9FFFF
+    */
+    /*
+    * APERTURE NAME: CSU, START ADDRESS: FFCA0000, END ADDRESS: FFCAFFFF
+    */
+    /*
+    * APERTURE NAME: CSU_WDT, START ADDRESS: FFCB0000, END ADDRESS: FFCBFFFF
+    */
+    /*
+    * APERTURE NAME: EFUSE, START ADDRESS: FFCC0000, END ADDRESS: FFCCFFFF
+    */
+    /*
+    * APERTURE NAME: BBRAM, START ADDRESS: FFCD0000, END ADDRESS: FFCDFFFF
+    */
+    /*
+    * APERTURE NAME: RSA_CORE, START ADDRESS: FFCE0000, END ADDRESS: FFCEFFFF
+    */
+    /*
+    * APERTURE NAME: MBISTJTAG, START ADDRESS: FFCF0000, END ADDRESS: FFCFFFFF
+    */
+    /*
+    * APERTURE NAME: PMU_ROM, START ADDRESS: FFD00000, END ADDRESS: FFD3FFFF
+    */
+    /*
+    * APERTURE NAME: PMU_ROM, START ADDRESS: FFD00000, END ADDRESS: FFD3FFFF
+    */
+    /*
+    * APERTURE NAME: PMU_ROM, START ADDRESS: FFD00000, END ADDRESS: FFD3FFFF
+    */
+    /*
+    * APERTURE NAME: PMU_ROM, START ADDRESS: FFD00000, END ADDRESS: FFD3FFFF
+    */
+    /*
+    * APERTURE NAME: PMU_IOMODULE, START ADDRESS: FFD40000, END ADDRESS: FFD5F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: PMU_IOMODULE, START ADDRESS: FFD40000, END ADDRESS: FFD5F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: PMU_LOCAL, START ADDRESS: FFD60000, END ADDRESS: FFD7FFFF
+    */
+    /*
+    * APERTURE NAME: PMU_LOCAL, START ADDRESS: FFD60000, END ADDRESS: FFD7FFFF
+    */
+    /*
+    * APERTURE NAME: PMU_GLOBAL, START ADDRESS: FFD80000, END ADDRESS: FFDBFFF
+    * F
+    */
+    /*
+    * APERTURE NAME: PMU_GLOBAL, START ADDRESS: FFD80000, END ADDRESS: FFDBFFF
+    * F
+    */
+    /*
+    * APERTURE NAME: PMU_GLOBAL, START ADDRESS: FFD80000, END ADDRESS: FFDBFFF
+    * F
+    */
+    /*
+    * APERTURE NAME: PMU_GLOBAL, START ADDRESS: FFD80000, END ADDRESS: FFDBFFF
+    * F
+    */
+    /*
+    * APERTURE NAME: PMU_RAM, START ADDRESS: FFDC0000, END ADDRESS: FFDFFFFF
+    */
+    /*
+    * APERTURE NAME: PMU_RAM, START ADDRESS: FFDC0000, END ADDRESS: FFDFFFFF
+    */
+    /*
+    * APERTURE NAME: PMU_RAM, START ADDRESS: FFDC0000, END ADDRESS: FFDFFFFF
+    */
+    /*
+    * APERTURE NAME: PMU_RAM, START ADDRESS: FFDC0000, END ADDRESS: FFDFFFFF
+    */
+    /*
+    * APERTURE NAME: R5_0_ATCM, START ADDRESS: FFE00000, END ADDRESS: FFE0FFFF
+    */
+    /*
+    * APERTURE NAME: R5_0_ATCM_LOCKSTEP, START ADDRESS: FFE10000, END ADDRESS:
+    *  FFE1FFFF
+    */
+    /*
+    * APERTURE NAME: R5_0_BTCM, START ADDRESS: FFE20000, END ADDRESS: FFE2FFFF
+    */
+    /*
+    * APERTURE NAME: R5_0_BTCM_LOCKSTEP, START ADDRESS: FFE30000, END ADDRESS:
+    *  FFE3FFFF
+    */
+    /*
+    * APERTURE NAME: R5_0_INSTRUCTION_CACHE, START ADDRESS: FFE40000, END ADDR
+    * ESS: FFE4FFFF
+    */
+    /*
+    * APERTURE NAME: R5_0_DATA_CACHE, START ADDRESS: FFE50000, END ADDRESS: FF
+    * E5FFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_8, START ADDRESS: FFE60000, END ADDRESS: FFE8F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_8, START ADDRESS: FFE60000, END ADDRESS: FFE8F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_8, START ADDRESS: FFE60000, END ADDRESS: FFE8F
+    * FFF
+    */
+    /*
+    * APERTURE NAME: R5_1_ATCM_, START ADDRESS: FFE90000, END ADDRESS: FFE9FFF
+    * F
+    */
+    /*
+    * APERTURE NAME: RPU_UNUSED_10, START ADDRESS: FFEA0000, END ADDRESS: FFEA
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: R5_1_BTCM_, START ADDRESS: FFEB0000, END ADDRESS: FFEBFFF
+    * F
+    */
+    /*
+    * APERTURE NAME: R5_1_INSTRUCTION_CACHE, START ADDRESS: FFEC0000, END ADDR
+    * ESS: FFECFFFF
+    */
+    /*
+    * APERTURE NAME: R5_1_DATA_CACHE, START ADDRESS: FFED0000, END ADDRESS: FF
+    * EDFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_15, START ADDRESS: FFFD0000, END ADDRESS: FFFF
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_15, START ADDRESS: FFFD0000, END ADDRESS: FFFF
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_15, START ADDRESS: FFFD0000, END ADDRESS: FFFF
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    */
+    /*
+    * APERTURE NAME: IOU_GPV, START ADDRESS: FE000000, END ADDRESS: FE0FFFFF
+    */
+    /*
+    * APERTURE NAME: LPD_GPV, START ADDRESS: FE100000, END ADDRESS: FE1FFFFF
+    */
+    /*
+    * APERTURE NAME: USB3_0_XHCI, START ADDRESS: FE200000, END ADDRESS: FE2FFF
+    * FF
+    */
+    /*
+    * APERTURE NAME: USB3_1_XHCI, START ADDRESS: FE300000, END ADDRESS: FE3FFF
+    * FF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_13, START ADDRESS: FE400000, END ADDRESS: FE7F
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_13, START ADDRESS: FE400000, END ADDRESS: FE7F
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_13, START ADDRESS: FE400000, END ADDRESS: FE7F
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_13, START ADDRESS: FE400000, END ADDRESS: FE7F
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
+    */
+    /*
+    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
+    */
+    /*
+    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
+    */
+    /*
+    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
+    */
+    /*
+    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
+    */
+    /*
+    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
+    */
+    /*
+    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
+    */
+    /*
+    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
+    */
+    /*
+    * APERTURE NAME: QSPI_LINEAR_ADDRESS, START ADDRESS: C0000000, END ADDRESS
+    * : DFFFFFFF
+    */
+    /*
+    * XPPU CONTROL
+    */
+
+	return 1;
+}
+unsigned long psu_ddr_xmpu0_data(void)
+{
+    /*
+    * DDR XMPU0
+    */
+
+	return 1;
+}
+unsigned long psu_ddr_xmpu1_data(void)
+{
+    /*
+    * DDR XMPU1
+    */
+
+	return 1;
+}
+unsigned long psu_ddr_xmpu2_data(void)
+{
+    /*
+    * DDR XMPU2
+    */
+
+	return 1;
+}
+unsigned long psu_ddr_xmpu3_data(void)
+{
+    /*
+    * DDR XMPU3
+    */
+
+	return 1;
+}
+unsigned long psu_ddr_xmpu4_data(void)
+{
+    /*
+    * DDR XMPU4
+    */
+
+	return 1;
+}
+unsigned long psu_ddr_xmpu5_data(void)
+{
+    /*
+    * DDR XMPU5
+    */
+
+	return 1;
+}
+unsigned long psu_ocm_xmpu_data(void)
+{
+    /*
+    * OCM XMPU
+    */
+
+	return 1;
+}
+unsigned long psu_fpd_xmpu_data(void)
+{
+    /*
+    * FPD XMPU
+    */
+
+	return 1;
+}
+unsigned long psu_protection_lock_data(void)
+{
+    /*
+    * LOCKING PROTECTION MODULE
+    */
+    /*
+    * XPPU LOCK
+    */
+    /*
+    * APERTURE NAME: LPD_XPPU, START ADDRESS: FF980000, END ADDRESS: FF99FFFF
+    */
+    /*
+    * XMPU LOCK
+    */
+    /*
+    * LOCK OCM XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
+    */
+    /*
+    * LOCK FPD XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
+    */
+    /*
+    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
+    */
+    /*
+    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
+    */
+    /*
+    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
+    */
+    /*
+    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
+    */
+    /*
+    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
+    */
+    /*
+    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
+    */
+
+	return 1;
+}
+static const PsuOp PsuApplyMasterTzOps[] = {
+	PSU_WRITE(FPD_SLCR_SECURE_SLCR_DPDMA_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(FPD_SLCR_SECURE_SLCR_PCIE_OFFSET, 0x01FFFFFFU, 0x01FFFFFFU),
+	PSU_WRITE(LPD_SLCR_SECURE_SLCR_USB_OFFSET, 0x00000003U, 0x00000003U),
+	PSU_WRITE(IOU_SECURE_SLCR_IOU_AXI_RPRTCN_OFFSET, 0x003F0000U, 0x00120000U),
+	PSU_WRITE(IOU_SECURE_SLCR_IOU_AXI_WPRTCN_OFFSET, 0x003F0000U, 0x00120000U),
+	PSU_WRITE(IOU_SECURE_SLCR_IOU_AXI_RPRTCN_OFFSET, 0x00000FFFU, 0x00000492U),
+	PSU_WRITE(IOU_SECURE_SLCR_IOU_AXI_WPRTCN_OFFSET, 0x0E000FFFU, 0x04000492U),
+	PSU_WRITE(IOU_SECURE_SLCR_IOU_AXI_RPRTCN_OFFSET, 0x01C00000U, 0x00800000U),
+	PSU_WRITE(IOU_SECURE_SLCR_IOU_AXI_WPRTCN_OFFSET, 0x01C00000U, 0x00800000U),
+	PSU_WRITE(LPD_SLCR_SECURE_SLCR_ADMA_OFFSET, 0x000000FFU, 0x000000FFU),
+	PSU_WRITE(FPD_SLCR_SECURE_SLCR_GDMA_OFFSET, 0x000000FFU, 0x000000FFU),
+};
+
+unsigned long psu_apply_master_tz(void)
+{
+	return PSU_TABLE_RUN(PsuApplyMasterTzOps);
+}
+unsigned long psu_serdes_init_data(void)
+{
+    /*
+    * SERDES INITIALIZATION
+    */
+
+	return 1;
+}
+static const PsuOp PsuResetoutInitOps[] = {
+	PSU_WRITE(PCIE_ATTRIB_ATTR_25_OFFSET, 0x00000200U, 0x00000200U),
+};
+
+unsigned long psu_resetout_init_data(void)
+{
+	return PSU_TABLE_RUN(PsuResetoutInitOps);
+}
+unsigned long psu_resetin_init_data(void)
+{
+
+	return 1;
+}
+static const PsuOp PsuPsPlIsolationRemovalOps[] = {
+	PSU_WRITE(PMU_GLOBAL_REQ_PWRUP_INT_EN_OFFSET, 0x00800000U, 0x00800000U),
+	PSU_WRITE(PMU_GLOBAL_REQ_PWRUP_TRIG_OFFSET, 0x00800000U, 0x00800000U),
+	PSU_POLL_VALUE(PMU_GLOBAL_REQ_PWRUP_STATUS_OFFSET, 0x00800000U, 0x00000000U),
+};
+
+unsigned long psu_ps_pl_isolation_removal_data(void)
+{
+	return PSU_TABLE_RUN(PsuPsPlIsolationRemovalOps);
+}
+static const PsuOp PsuAfiConfigOps[] = {
+	PSU_WRITE(CRF_APB_RST_FPD_TOP_OFFSET, 0x00001F80U, 0x00000000U),
+	PSU_WRITE(CRL_APB_RST_LPD_TOP_OFFSET, 0x00080000U, 0x00000000U),
+	PSU_WRITE(LPD_SLCR_AFI_FS_OFFSET, 0x00000300U, 0x00000200U),
+};
+
+unsigned long psu_afi_config(void)
+{
+	return PSU_TABLE_RUN(PsuAfiConfigOps);
+}
+static const PsuOp PsuPsPlResetConfigOps[] = {
+	PSU_WRITE(GPIO_MASK_DATA_5_MSW_OFFSET, 0xFFFF0000U, 0x80000000U),
+	PSU_WRITE(GPIO_DIRM_5_OFFSET, 0xFFFFFFFFU, 0x80000000U),
+	PSU_WRITE(GPIO_OEN_5_OFFSET, 0xFFFFFFFFU, 0x80000000U),
+	PSU_WRITE(GPIO_DATA_5_OFFSET, 0xFFFFFFFFU, 0x80000000U),
+	PSU_DELAY(1),
+	PSU_WRITE(GPIO_DATA_5_OFFSET, 0xFFFFFFFFU, 0x00000000U),
+	PSU_DELAY(1),
+	PSU_WRITE(GPIO_DATA_5_OFFSET, 0xFFFFFFFFU, 0x80000000U),
+};
+
+unsigned long psu_ps_pl_reset_config_data(void)
+{
+	return PSU_TABLE_RUN(PsuPsPlResetConfigOps);
+}
+
+/*
+ * DDR PHY training, split out of psu_ddr_phybringup_data() by gen_psu_table.py
+ * so that PSU_DDR_CACHE builds can restore a saved result (psu_ddr_cache.h)
+ */
+const u32 PsuDdrConfigId = 0x50C21FBEU;
+
+static unsigned long psu_ddr_phybringup_train(void)
+{
+	unsigned int regval = 0;
+
+	prog_reg(0xFD080014U, 0x00000040U, 0x00000006U, 0x00000001U);
+	Xil_Out32(0xFD080004, 0x0014FE01); /*PUB_PIR*/
+
+	PSU_WAIT(0xFD080030, 0xFFFFFFFFU, 0x8000007E); /*PUB_PGSR0*/
+
+/*Disabling REF before dqs2dq training - DTCR0.RFSHDT=0*/
+	Xil_Out32(0xFD080200U, 0x000091C7U);
+	PSU_WAIT(0xFD080030, 0xFFFFFFFFU, 0x80008FFF); /*PUB_PGSR0*/
+
+/*Enabling REF after dqs2dq training - DTCR0.RFSHDT=8*/
+	Xil_Out32(0xFD080200U, 0x800091C7U);
+	regval = ((Xil_In32(0xFD080030) & 0x1FFF0000) >>18);
+	if(regval != 0) {
+		return(0);
+	}
+
+/* Run Vref training in static read mode*/
+	Xil_Out32(0xFD080200U, 0x800091C7U);
+	int cur_R006_tREFPRD;
+
+	cur_R006_tREFPRD = (Xil_In32(0xFD080018U) & 0x0003FFFFU) >> 0x00000000U;
+	prog_reg(0xFD080018, 0x3FFFF, 0x0, cur_R006_tREFPRD);
+
+	prog_reg(0xFD08001CU, 0x00000018U, 0x00000003U, 0x00000003U);
+	prog_reg(0xFD08142CU, 0x00000030U, 0x00000004U, 0x00000003U);
+	prog_reg(0xFD08146CU, 0x00000030U, 0x00000004U, 0x00000003U);
+	prog_reg(0xFD0814ACU, 0x00000030U, 0x00000004U, 0x00000003U);
+	prog_reg(0xFD0814ECU, 0x00000030U, 0x00000004U, 0x00000003U);
+	prog_reg(0xFD08152CU, 0x00000030U, 0x00000004U, 0x00000003U);
+
+
+	Xil_Out32(0xFD080004, 0x00060001); /*PUB_PIR*/
+	PSU_WAIT(0xFD080030, 0x80004001, 0x80004001); /*PUB_PGSR0*/
+
+/* Vref training is complete*/ 
+/* Check if any training errors then exit*/
+	regval = ((Xil_In32(0xFD080030) & 0x1FFF0000) >>18);
+	if(regval != 0) {
+		return(0);
+	}
+
+	prog_reg(0xFD08001CU, 0x00000018U, 0x00000003U, 0x00000000U);
+	prog_reg(0xFD08142CU, 0x00000030U, 0x00000004U, 0x00000000U);
+	prog_reg(0xFD08146CU, 0x00000030U, 0x00000004U, 0x00000000U);
+	prog_reg(0xFD0814ACU, 0x00000030U, 0x00000004U, 0x00000000U);
+	prog_reg(0xFD0814ECU, 0x00000030U, 0x00000004U, 0x00000000U);
+	prog_reg(0xFD08152CU, 0x00000030U, 0x00000004U, 0x00000000U);
+/*Vref training is complete, disabling static read mode*/
+	Xil_Out32(0xFD080200U, 0x800091C7U);
+	prog_reg(0xFD080018, 0x3FFFF, 0x0, cur_R006_tREFPRD);
+
+
+
+	Xil_Out32(0xFD080004, 0x0000C001); /*PUB_PIR*/
+	PSU_WAIT(0xFD080030, 0x80000C01, 0x80000C01); /*PUB_PGSR0*/
+
+	return 1;
+}
+
+static unsigned long psu_ddr_phybringup_post(void)
+{
+	Xil_Out32(0xFD070180U, 0x010B0008U);
+	Xil_Out32(0xFD070060U, 0x00000000U);
+	prog_reg(0xFD080014U, 0x00000040U, 0x00000006U, 0x00000000U);
+	return 1;
+}
+
+unsigned long psu_ddr_phybringup_data(void)
+{
+
+
+
+	unsigned int pll_retry = 10;
+
+	unsigned int pll_locked = 0;
+
+
+	while ((pll_retry > 0) && (!pll_locked)) {
+
+		Xil_Out32(0xFD080004, 0x00040010);/*PIR*/
+		Xil_Out32(0xFD080004, 0x00040011);/*PIR*/
+
+	PSU_WAIT(0xFD080030, 0x1, 1);
+
+
+		pll_locked = (Xil_In32(0xFD080030) & 0x80000000)
+		>> 31;/*PGSR0*/
+		pll_locked &= (Xil_In32(0xFD0807E0) & 0x10000)
+		>> 16;/*DX0GSR0*/
+		pll_locked &= (Xil_In32(0xFD0809E0) & 0x10000) >> 16 ; /*DX2GSR0*/
+		pll_retry--;
+	}
+	Xil_Out32(0xFD0800C4, Xil_In32(0xFD0800C4) |
+		(pll_retry << 16));/*GPR0*/
+		if(!pll_locked)
+			return(0);
+
+	Xil_Out32(0xFD080004U, 0x00040063U);
+	Xil_Out32(0xFD0800C0U, 0x00000001U);
+	/* PHY BRINGUP SEQ */
+	PSU_WAIT(0xFD080030U, 0x0000000FU, 0x0000000FU);
+
+	prog_reg(0xFD080004U, 0x00000001U, 0x00000000U, 0x00000001U);
+	/* poll for PHY initialization to complete */
+	PSU_WAIT(0xFD080030U, 0x000000FFU, 0x0000001FU);
+
+
+	Xil_Out32(0xFD070010U, 0x80000018U);
+	Xil_Out32(0xFD0701B0U, 0x00000005U);
+	PSU_WAIT(0xFD070018, 0x1, 0x0); /*MRSTAT*/
+
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	Xil_Out32(0xFD070014U, 0x00000331U);
+	Xil_Out32(0xFD070010U, 0x80000018U);
+	PSU_WAIT(0xFD070018, 0x1, 0x0); /*MRSTAT*/
+
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	Xil_Out32(0xFD070014U, 0x00000B36U);
+	Xil_Out32(0xFD070010U, 0x80000018U);
+	PSU_WAIT(0xFD070018, 0x1, 0x0); /*MRSTAT*/
+
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	Xil_Out32(0xFD070014U, 0x00000C56U);
+	Xil_Out32(0xFD070010U, 0x80000018U);
+	PSU_WAIT(0xFD070018, 0x1, 0x0); /*MRSTAT*/
+
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	Xil_Out32(0xFD070014U, 0x00000E19U);
+	Xil_Out32(0xFD070010U, 0x80000018U);
+	PSU_WAIT(0xFD070018, 0x1, 0x0); /*MRSTAT*/
+
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	(void)Xil_In32(0xFD070018); /*MRSTAT*/
+	Xil_Out32(0xFD070014U, 0x00001616U);
+	Xil_Out32(0xFD070010U, 0x80000018U);
+	Xil_Out32(0xFD070010U, 0x80000010U);
+	Xil_Out32(0xFD0701B0U, 0x00000005U);
+	Xil_Out32(0xFD070320U, 0x00000001U);
+	PSU_WAIT(0xFD070004U, 0x0000000FU, 0x00000001U);
+
+	if (!PSU_DDR_TRAIN(psu_ddr_phybringup_train,
+			   psu_ddr_phybringup_post))
+		return(0);
+
+return 1;
+}
+
+/**
+ * CRL_APB Base Address
+ */
+#define CRL_APB_BASEADDR      0XFF5E0000U
+#define CRL_APB_RST_LPD_IOU0    ((CRL_APB_BASEADDR) + 0X00000230U)
+#define CRL_APB_RST_LPD_IOU1    ((CRL_APB_BASEADDR) + 0X00000234U)
+#define CRL_APB_RST_LPD_IOU2    ((CRL_APB_BASEADDR) + 0X00000238U)
+#define CRL_APB_RST_LPD_TOP    ((CRL_APB_BASEADDR) + 0X0000023CU)
+#define CRL_APB_IOU_SWITCH_CTRL    ((CRL_APB_BASEADDR) + 0X0000009CU)
+//static int serdes_rst_seq (u32 pllsel, u32 lane3_protocol, u32 lane3_rate, u32 lane2_protocol, u32 lane2_rate, u32 lane1_protocol, u32 lane1_rate, u32 lane0_protocol, u32 lane0_rate);
+//static int serdes_illcalib_pcie_gen1 (u32 pllsel, u32 lane3_protocol, u32 lane3_rate, u32 lane2_protocol, u32 lane2_rate, u32 lane1_protocol, u32 lane1_rate, u32 lane0_protocol, u32 lane0_rate, u32 gen2_calib);
+
+/**
+ * CRF_APB Base Address
+ */
+#define CRF_APB_BASEADDR      0XFD1A0000U
+
+#define CRF_APB_RST_FPD_TOP    ((CRF_APB_BASEADDR) + 0X00000100U)
+#define CRF_APB_GPU_REF_CTRL    ((CRF_APB_BASEADDR) + 0X00000084U)
+#define CRF_APB_RST_DDR_SS    ((CRF_APB_BASEADDR) + 0X00000108U)
+#define PSU_MASK_POLL_TIME 1100000
+
+/**
+ *  * Register: CRF_APB_DPLL_CTRL
+ */
+#define CRF_APB_DPLL_CTRL    ((CRF_APB_BASEADDR) + 0X0000002C)
+
+
+#define CRF_APB_DPLL_CTRL_DIV2_SHIFT   16
+#define CRF_APB_DPLL_CTRL_DIV2_WIDTH   1
+
+#define CRF_APB_DPLL_CTRL_FBDIV_SHIFT   8
+#define CRF_APB_DPLL_CTRL_FBDIV_WIDTH   7
+
+#define CRF_APB_DPLL_CTRL_BYPASS_SHIFT   3
+#define CRF_APB_DPLL_CTRL_BYPASS_WIDTH   1
+
+#define CRF_APB_DPLL_CTRL_RESET_SHIFT   0
+#define CRF_APB_DPLL_CTRL_RESET_WIDTH   1
+
+/**
+ *  * Register: CRF_APB_DPLL_CFG
+ */
+#define CRF_APB_DPLL_CFG    ((CRF_APB_BASEADDR) + 0X00000030)
+
+#define CRF_APB_DPLL_CFG_LOCK_DLY_SHIFT   25
+#define CRF_APB_DPLL_CFG_LOCK_DLY_WIDTH   7
+
+#define CRF_APB_DPLL_CFG_LOCK_CNT_SHIFT   13
+#define CRF_APB_DPLL_CFG_LOCK_CNT_WIDTH   10
+
+#define CRF_APB_DPLL_CFG_LFHF_SHIFT   10
+#define CRF_APB_DPLL_CFG_LFHF_WIDTH   2
+
+#define CRF_APB_DPLL_CFG_CP_SHIFT   5
+#define CRF_APB_DPLL_CFG_CP_WIDTH   4
+
+#define CRF_APB_DPLL_CFG_RES_SHIFT   0
+#define CRF_APB_DPLL_CFG_RES_WIDTH   4
+
+/**
+ * Register: CRF_APB_PLL_STATUS
+ */
+#define CRF_APB_PLL_STATUS    ((CRF_APB_BASEADDR) + 0X00000044)
+
+
+static void init_peripheral(void)
+{
+/*SMMU_REG Interrrupt Enable: Followig register need to be written all the time to properly catch SMMU messages.*/
+	PSU_Mask_Write(0xFD5F0018, 0x8000001FU, 0x8000001FU);
+}
+
+static int psu_init_xppu_aper_ram(void)
+{
+
+	return 0;
+}
+
+int psu_lpd_protection(void)
+{
+	psu_init_xppu_aper_ram();
+	return 0;
+}
+
+int psu_ddr_protection(void)
+{
+	psu_ddr_xmpu0_data();
+	psu_ddr_xmpu1_data();
+	psu_ddr_xmpu2_data();
+	psu_ddr_xmpu3_data();
+	psu_ddr_xmpu4_data();
+	psu_ddr_xmpu5_data();
+	return 0;
+}
+int psu_ocm_protection(void)
+{
+	psu_ocm_xmpu_data();
+	return 0;
+}
+
+int psu_fpd_protection(void)
+{
+	psu_fpd_xmpu_data();
+	return 0;
+}
+
+int psu_protection_lock(void)
+{
+	psu_protection_lock_data();
+	return 0;
+}
+
+int psu_protection(void)
+{
+	psu_apply_master_tz();
+	psu_ddr_protection();
+	psu_ocm_protection();
+	psu_fpd_protection();
+	psu_lpd_protection();
+	return 0;
+}
+
+int
+psu_init(void)
+{
+	int status = 1;
+
+	PsuTable_StartCounter();
+	PSU_PROF_STAGE("psu_mio_init_data", status &= psu_mio_init_data());
+	PSU_PROF_STAGE("psu_peripherals_pre_init_data", status &= psu_peripherals_pre_init_data());
+	PSU_PROF_STAGE("psu_pll_init_data", status &= psu_pll_init_data());
+	PSU_PROF_STAGE("psu_clock_init_data", status &= psu_clock_init_data());
+	PSU_PROF_STAGE("psu_ddr_init_data", status &= psu_ddr_init_data());
+	PSU_PROF_STAGE("psu_ddr_phybringup_data", status &= psu_ddr_phybringup_data());
+	PSU_PROF_STAGE("psu_peripherals_init_data", status &= psu_peripherals_init_data());
+	PSU_PROF_STAGE("init_peripheral", init_peripheral());
+
+	PSU_PROF_STAGE("psu_peripherals_powerdwn_data", status &= psu_peripherals_powerdwn_data());
+	PSU_PROF_STAGE("psu_afi_config", status &= psu_afi_config());
+	PSU_PROF_STAGE("psu_ddr_qos_init_data", psu_ddr_qos_init_data());
+
+	if (status == 0)
+		return 1;
+	return 0;
+}
+
+int psu_init_ddr_self_refresh(void) {
+
+    int status = 1;
+
+	PsuTable_StartCounter();
+	PSU_PROF_STAGE("psu_mio_init_data", status &= psu_mio_init_data());
+	PSU_PROF_STAGE("psu_peripherals_pre_init_data", status &= psu_peripherals_pre_init_data());
+	PSU_PROF_STAGE("psu_pll_init_data", status &= psu_pll_init_data());
+	PSU_PROF_STAGE("psu_clock_init_data", status &= psu_clock_init_data());
+	PSU_PROF_STAGE("psu_ddr_init_data", status &= psu_ddr_init_data());
+	PSU_PROF_STAGE("psu_peripherals_init_data", status &= psu_peripherals_init_data());
+	PSU_PROF_STAGE("init_peripheral", init_peripheral());
+
+	PSU_PROF_STAGE("psu_peripherals_powerdwn_data", status &= psu_peripherals_powerdwn_data());
+	PSU_PROF_STAGE("psu_afi_config", status &= psu_afi_config());
+	PSU_PROF_STAGE("psu_ddr_qos_init_data", psu_ddr_qos_init_data());
+
+	if (status == 0)
+		return 1;
+	return 0;
+
+
+}
+
+
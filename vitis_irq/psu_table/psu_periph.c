@@ -0,0 +1,136 @@
+/******************************************************************************
+ * On-demand PS peripheral initialization - see psu_periph.h
+ ******************************************************************************/
+
+#include "psu_periph.h"
+#include "xtime_l.h"
+#include "xil_printf.h"
+#include <string.h>
+
+#define UNIT_LABEL_WIDTH    16U
+
+/* Where a unit ran */
+#define RAN_NOT             0U
+#define RAN_AT_BOOT         1U
+#define RAN_ON_DEMAND       2U
+
+/* An application starts with what the FSBL ran for it; deferrable
+ * dependencies of PSU_PERIPH_BOOT_UNITS run again on first use, which
+ * only rewrites the same values */
+static u32 Ready = PSU_PERIPH_EAGER_UNITS;
+static u32 Running;
+static XTime Ticks[PSU_PERIPH_NUM_UNITS];
+static u8 Ran[PSU_PERIPH_NUM_UNITS];
+
+static unsigned long RunUnits(u32 Units, u8 Where);
+
+static unsigned long RunUnit(u32 Index, u8 Where)
+{
+    const PsuPeriphUnit *Unit = &PsuPeriphUnits[Index];
+    u32 Bit = 1U << Index;
+    XTime Start;
+    XTime End;
+    unsigned long Ok;
+
+    if ((Ready & Bit) != 0U) {
+        return 1;
+    }
+    if ((Running & Bit) != 0U) {
+        return 0;           /* Dependency cycle */
+    }
+
+    Running |= Bit;
+    Ok = RunUnits(Unit->Deps, Where);
+    if (Ok) {
+        XTime_GetTime(&Start);
+        Ok = PsuTable_Run(Unit->Ops, Unit->Count);
+        XTime_GetTime(&End);
+        Ticks[Index] = End - Start;
+        Ran[Index] = Where;
+        if (Ok) {
+            Ready |= Bit;
+        }
+    }
+    Running &= ~Bit;
+    return Ok;
+}
+
+static unsigned long RunUnits(u32 Units, u8 Where)
+{
+    u32 i;
+
+    for (i = 0; i < PSU_PERIPH_NUM_UNITS; i++) {
+        if (((Units & (1U << i)) != 0U) && !RunUnit(i, Where)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* psu_peripherals_init_data() of a PSU_PERIPH_LAZY build */
+unsigned long PsuPeriph_Boot(void)
+{
+    Ready &= ~PSU_PERIPH_EAGER_UNITS;
+    return RunUnits(PSU_PERIPH_EAGER_UNITS, RAN_AT_BOOT);
+}
+
+/* Bring up Units and what they depend on, unless done already */
+unsigned long PsuPeriph_Require(u32 Units)
+{
+    return RunUnits(Units, RAN_ON_DEMAND);
+}
+
+u32 PsuPeriph_Ready(void)
+{
+    return Ready;
+}
+
+/* ------------------------------------------------------------
+ * Report
+ * ------------------------------------------------------------ */
+static u32 ToNs(XTime T)
+{
+    return (u32)((T * 1000000000U) / COUNTS_PER_SECOND);
+}
+
+void PsuPeriph_Report(void)
+{
+    const PsuPeriphUnit *Unit;
+    XTime Saved = 0;
+    u32 Deferred = 0;
+    u32 Unused = 0;
+    u32 Len;
+    u32 i;
+
+    xil_printf("Peripheral Init Report:\r\n");
+    for (i = 0; i < PSU_PERIPH_NUM_UNITS; i++) {
+        Unit = &PsuPeriphUnits[i];
+        xil_printf("%s :", Unit->Name);
+        for (Len = (u32)strlen(Unit->Name) + 2U; Len < UNIT_LABEL_WIDTH;
+             Len++) {
+            xil_printf(" ");
+        }
+
+        if (Ran[i] == RAN_AT_BOOT) {
+            xil_printf("BOOT      TIME : %d ns\r\n", (int)ToNs(Ticks[i]));
+            continue;
+        }
+        if ((PSU_PERIPH_EAGER_UNITS & (1U << i)) != 0U) {
+            xil_printf("BOOT      (before this image)\r\n");
+            continue;
+        }
+        Deferred++;
+        if (Ran[i] == RAN_NOT) {
+            Unused++;
+            xil_printf("DEFERRED  NOT USED ACCESSES : %d DELAY : %d us\r\n",
+                       (int)Unit->Accesses, (int)Unit->DelayUs);
+        } else {
+            Saved += Ticks[i];
+            xil_printf("DEFERRED  ON USE   TIME : %d ns\r\n",
+                       (int)ToNs(Ticks[i]));
+        }
+    }
+    xil_printf("Boot time saved (estimate, run time on use) : %d ns by %d "
+               "deferred units, %d not used yet\r\n", (int)ToNs(Saved),
+               (int)Deferred, (int)Unused);
+}
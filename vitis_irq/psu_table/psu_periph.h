@@ -0,0 +1,85 @@
+/******************************************************************************
+ * On-demand PS peripheral initialization
+ *
+ * gen_psu_table.py cuts psu_peripherals_init_data() into per-peripheral
+ * units (psu_periph_units.h): reset release and static configuration of
+ * ENET, QSPI, USB, SD, I2C, SPI, TTC, GPIO, ... plus the system units the
+ * boot itself needs (resets, console UART, timestamp counter, TrustZone,
+ * QoS, RTC). Each unit lists the units that must run before it.
+ *
+ * PSU_PERIPH_LAZY is opt-in: both the FSBL and the application must
+ * be built with it. The FSBL's psu_peripherals_init_data() then runs
+ * the system units and PSU_PERIPH_BOOT_UNITS only. Nothing else brings
+ * the deferred peripherals up: the application has to, by calling
+ * PSU_PERIPH_REQUIRE() in front of each driver's first use (before its
+ * Xxx_CfgInitialize()). Each unit runs once, dependencies first. The
+ * application's init_platform() requires PSU_PERIPH_APP_UNITS, all
+ * deferred units unless the application narrows it to the ones its
+ * drivers use. The application links psu_periph.c, psu_periph_units.c
+ * and psu_table.c and must be built with the same PSU_PERIPH_BOOT_UNITS
+ * as the FSBL, which is how it knows what the boot already ran.
+ *
+ * Each unit is timed when it runs. PsuPeriph_Report() lists the units,
+ * where they ran and what each deferred one cost when it was finally
+ * needed. That is an estimate of the boot time deferring it saved, not
+ * a measurement of the boot; on the host model it is the model's
+ * access and delay cost. Units not used yet show their APB accesses
+ * and delays instead.
+ *
+ * Without PSU_PERIPH_LAZY, psu_peripherals_init_data() is unchanged and
+ * PSU_PERIPH_REQUIRE() is a no-op.
+ ******************************************************************************/
+
+#ifndef PSU_PERIPH_H_
+#define PSU_PERIPH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+#include "psu_table.h"
+#include "psu_periph_units.h"
+
+/* Deferrable units the FSBL still needs: its boot device, SD1 on ZUBoard.
+ * Add PSU_PERIPH_QSPI for QSPI boot. */
+#ifndef PSU_PERIPH_BOOT_UNITS
+#define PSU_PERIPH_BOOT_UNITS   PSU_PERIPH_SD
+#endif
+
+/* Deferred units init_platform() brings up: all of them, which is safe
+ * for any application. Narrow it to the units its drivers use. */
+#ifndef PSU_PERIPH_APP_UNITS
+#define PSU_PERIPH_APP_UNITS    PSU_PERIPH_LAZY_UNITS
+#endif
+
+#define PSU_PERIPH_EAGER_UNITS  \
+    ((~PSU_PERIPH_LAZY_UNITS | PSU_PERIPH_BOOT_UNITS) & \
+     ((1U << PSU_PERIPH_NUM_UNITS) - 1U))
+
+typedef struct {
+    const char *Name;
+    const PsuOp *Ops;
+    u32 Count;
+    u32 Deps;           /* PSU_PERIPH_* units to run first */
+    u32 Accesses;       /* Register accesses, from the generator */
+    u32 DelayUs;
+} PsuPeriphUnit;
+
+extern const PsuPeriphUnit PsuPeriphUnits[PSU_PERIPH_NUM_UNITS];
+
+unsigned long PsuPeriph_Boot(void);
+unsigned long PsuPeriph_Require(u32 Units);
+u32 PsuPeriph_Ready(void);
+void PsuPeriph_Report(void);
+
+#ifdef PSU_PERIPH_LAZY
+#define PSU_PERIPH_REQUIRE(Units)   PsuPeriph_Require(Units)
+#else
+#define PSU_PERIPH_REQUIRE(Units)   1UL
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,115 @@
+/*
+ * Generated by gen_psu_table.py from psu_init.c, do not edit
+ */
+
+#include "psu_init.h"
+#include "psu_periph.h"
+
+static const PsuOp PsuPeriphCoreOps[] = {
+	PSU_WRITE(CRF_APB_RST_FPD_TOP_OFFSET, 0x00008044U, 0x00000000U),
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x001A0000U, 0x00000000U),
+	PSU_WRITE(CRL_APB_RST_LPD_TOP_OFFSET, 0x0093C018U, 0x00000000U),
+};
+
+static const PsuOp PsuPeriphEnetOps[] = {
+	PSU_WRITE(CRL_APB_RST_LPD_IOU0_OFFSET, 0x00000004U, 0x00000000U),
+};
+
+static const PsuOp PsuPeriphQspiOps[] = {
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x00000001U, 0x00000000U),
+};
+
+static const PsuOp PsuPeriphIouTapdlyOps[] = {
+	PSU_WRITE(IOU_SLCR_IOU_TAPDLY_BYPASS_OFFSET, 0x00000004U, 0x00000000U),
+};
+
+static const PsuOp PsuPeriphUsbOps[] = {
+	PSU_WRITE(CRL_APB_RST_LPD_TOP_OFFSET, 0x00000800U, 0x00000000U),
+	PSU_WRITE(CRL_APB_RST_LPD_TOP_OFFSET, 0x00000280U, 0x00000280U),
+	PSU_WRITE(USB3_1_FPD_POWER_PRSNT_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(USB3_1_FPD_PIPE_CLK_OFFSET, 0x00000001U, 0x00000001U),
+	PSU_WRITE(CRL_APB_RST_LPD_TOP_OFFSET, 0x00000280U, 0x00000000U),
+	PSU_WRITE(CRL_APB_BOOT_PIN_CTRL_OFFSET, 0x00000F0FU, 0x00000202U),
+	PSU_DELAY(1),
+	PSU_WRITE(CRL_APB_BOOT_PIN_CTRL_OFFSET, 0x00000F0FU, 0x00000002U),
+	PSU_DELAY(5),
+	PSU_WRITE(CRL_APB_BOOT_PIN_CTRL_OFFSET, 0x00000F0FU, 0x00000202U),
+};
+
+static const PsuOp PsuPeriphSdOps[] = {
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x00000040U, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_CTRL_REG_SD_OFFSET, 0x00008000U, 0x00000000U),
+	PSU_WRITE(IOU_SLCR_SD_CONFIG_REG2_OFFSET, 0x33840000U, 0x00800000U),
+	PSU_WRITE(IOU_SLCR_SD_CONFIG_REG1_OFFSET, 0x7FFE0000U, 0x64500000U),
+	PSU_WRITE(IOU_SLCR_SD_DLL_CTRL_OFFSET, 0x00000008U, 0x00000008U),
+	PSU_WRITE(IOU_SLCR_SD_CONFIG_REG3_OFFSET, 0x03C00000U, 0x00000000U),
+};
+
+static const PsuOp PsuPeriphI2cOps[] = {
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x00000400U, 0x00000000U),
+};
+
+static const PsuOp PsuPeriphSwdtOps[] = {
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x00008000U, 0x00000000U),
+};
+
+static const PsuOp PsuPeriphSpiOps[] = {
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x00000008U, 0x00000000U),
+};
+
+static const PsuOp PsuPeriphTtcOps[] = {
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x00007800U, 0x00000000U),
+};
+
+static const PsuOp PsuPeriphUartOps[] = {
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x00000002U, 0x00000000U),
+	PSU_WRITE(UART0_BAUD_RATE_DIVIDER_REG0_OFFSET, 0x000000FFU, 0x00000006U),
+	PSU_WRITE(UART0_BAUD_RATE_GEN_REG0_OFFSET, 0x0000FFFFU, 0x0000007CU),
+	PSU_WRITE(UART0_CONTROL_REG0_OFFSET, 0x000001FFU, 0x00000017U),
+	PSU_WRITE(UART0_MODE_REG0_OFFSET, 0x000003FFU, 0x00000020U),
+};
+
+static const PsuOp PsuPeriphGpioOps[] = {
+	PSU_WRITE(CRL_APB_RST_LPD_IOU2_OFFSET, 0x00040000U, 0x00000000U),
+};
+
+static const PsuOp PsuPeriphAdmaOps[] = {
+	PSU_WRITE(LPD_SLCR_SECURE_SLCR_ADMA_OFFSET, 0x000000FFU, 0x000000FFU),
+};
+
+static const PsuOp PsuPeriphCsuOps[] = {
+	PSU_WRITE(CSU_TAMPER_STATUS_OFFSET, 0x00001FFFU, 0x00000000U),
+};
+
+static const PsuOp PsuPeriphQosOps[] = {
+	PSU_WRITE(APU_ACE_CTRL_OFFSET, 0x000F000FU, 0x00000000U),
+};
+
+static const PsuOp PsuPeriphRtcOps[] = {
+	PSU_WRITE(RTC_CONTROL_OFFSET, 0x80000000U, 0x80000000U),
+};
+
+static const PsuOp PsuPeriphTimestampOps[] = {
+	PSU_WRITE(IOU_SCNTRS_BASE_FREQUENCY_ID_REGISTER_OFFSET, 0xFFFFFFFFU, 0x05F5E100U),
+	PSU_WRITE(IOU_SCNTRS_COUNTER_CONTROL_REGISTER_OFFSET, 0x00000001U, 0x00000001U),
+};
+
+const PsuPeriphUnit PsuPeriphUnits[PSU_PERIPH_NUM_UNITS] = {
+	{ "core", PsuPeriphCoreOps, 3U, 0U, 6U, 0U },
+	{ "enet", PsuPeriphEnetOps, 1U, 0U, 2U, 0U },
+	{ "qspi", PsuPeriphQspiOps, 1U, PSU_PERIPH_IOU_TAPDLY, 2U, 0U },
+	{ "iou_tapdly", PsuPeriphIouTapdlyOps, 1U, 0U, 2U, 0U },
+	{ "usb", PsuPeriphUsbOps, 10U, 0U, 16U, 6U },
+	{ "sd", PsuPeriphSdOps, 6U, 0U, 12U, 0U },
+	{ "i2c", PsuPeriphI2cOps, 1U, 0U, 2U, 0U },
+	{ "swdt", PsuPeriphSwdtOps, 1U, 0U, 2U, 0U },
+	{ "spi", PsuPeriphSpiOps, 1U, 0U, 2U, 0U },
+	{ "ttc", PsuPeriphTtcOps, 1U, 0U, 2U, 0U },
+	{ "uart", PsuPeriphUartOps, 5U, 0U, 10U, 0U },
+	{ "gpio", PsuPeriphGpioOps, 1U, 0U, 2U, 0U },
+	{ "adma", PsuPeriphAdmaOps, 1U, 0U, 2U, 0U },
+	{ "csu", PsuPeriphCsuOps, 1U, 0U, 2U, 0U },
+	{ "qos", PsuPeriphQosOps, 1U, 0U, 2U, 0U },
+	{ "rtc", PsuPeriphRtcOps, 1U, 0U, 2U, 0U },
+	{ "timestamp", PsuPeriphTimestampOps, 2U, 0U, 3U, 0U },
+};
@@ -0,0 +1,40 @@
+/*
+ * Generated by gen_psu_table.py from psu_init.c, do not edit
+ */
+
+#ifndef PSU_PERIPH_UNITS_H_
+#define PSU_PERIPH_UNITS_H_
+
+/* Units of psu_peripherals_init_data(), in source order */
+#define PSU_PERIPH_CORE              (1U << 0)
+#define PSU_PERIPH_ENET              (1U << 1)
+#define PSU_PERIPH_QSPI              (1U << 2)
+#define PSU_PERIPH_IOU_TAPDLY        (1U << 3)
+#define PSU_PERIPH_USB               (1U << 4)
+#define PSU_PERIPH_SD                (1U << 5)
+#define PSU_PERIPH_I2C               (1U << 6)
+#define PSU_PERIPH_SWDT              (1U << 7)
+#define PSU_PERIPH_SPI               (1U << 8)
+#define PSU_PERIPH_TTC               (1U << 9)
+#define PSU_PERIPH_UART              (1U << 10)
+#define PSU_PERIPH_GPIO              (1U << 11)
+#define PSU_PERIPH_ADMA              (1U << 12)
+#define PSU_PERIPH_CSU               (1U << 13)
+#define PSU_PERIPH_QOS               (1U << 14)
+#define PSU_PERIPH_RTC               (1U << 15)
+#define PSU_PERIPH_TIMESTAMP         (1U << 16)
+
+#define PSU_PERIPH_NUM_UNITS         17U
+/* Units no boot stage needs */
+#define PSU_PERIPH_LAZY_UNITS        (PSU_PERIPH_ENET | \
+	PSU_PERIPH_QSPI | \
+	PSU_PERIPH_IOU_TAPDLY | \
+	PSU_PERIPH_USB | \
+	PSU_PERIPH_SD | \
+	PSU_PERIPH_I2C | \
+	PSU_PERIPH_SWDT | \
+	PSU_PERIPH_SPI | \
+	PSU_PERIPH_TTC | \
+	PSU_PERIPH_GPIO)
+
+#endif
@@ -0,0 +1,231 @@
+/******************************************************************************
+ * Boot-stage profiler for psu_init() - see psu_prof.h
+ ******************************************************************************/
+
+#include "psu_prof.h"
+
+#ifdef PSU_PROF
+
+#include "xil_printf.h"
+#include <string.h>
+
+/* Column of "CPU :" in dfx_runtime.txt */
+#define PROF_LABEL_WIDTH    50U
+
+typedef struct {
+    const char *Name;
+    XTime Wall;         /* Ticks inside the stage */
+    XTime Wait;         /* Ticks of it spent polling or in delays */
+    u32 Polls;
+    u32 Reads;          /* Register reads issued by those polls */
+    u32 DelayUs;        /* Requested delay, as passed to usleep() */
+} PsuProfStage;
+
+typedef struct {
+    u32 Addr;
+    u32 Mask;
+    u32 Value;          /* PSU_PROF_ANY_BIT: any bit of Mask */
+    const PsuProfStage *Stage;
+    u32 Calls;
+    u32 Timeouts;
+    u32 Reads;
+    u32 MaxReads;
+    XTime Ticks;
+    XTime MaxTicks;
+} PsuProfSite;
+
+static PsuProfStage Stages[PSU_PROF_MAX_STAGES];
+static PsuProfSite Sites[PSU_PROF_MAX_SITES];
+static u32 NumSites;
+static u32 NumStages;
+static PsuProfStage *Current;
+static XTime StageStart;
+static XTime FirstStart;
+static XTime LastEnd;
+static int Begun;
+
+void PsuProf_Begin(const char *Stage)
+{
+    u32 i;
+
+    Current = NULL;
+    for (i = 0; i < NumStages; i++) {
+        if (strcmp(Stages[i].Name, Stage) == 0) {
+            Current = &Stages[i];
+        }
+    }
+    if ((Current == NULL) && (NumStages < PSU_PROF_MAX_STAGES)) {
+        Current = &Stages[NumStages++];
+        Current->Name = Stage;
+    }
+
+    XTime_GetTime(&StageStart);
+    if (!Begun) {
+        FirstStart = StageStart;
+        Begun = 1;
+    }
+}
+
+void PsuProf_End(void)
+{
+    XTime_GetTime(&LastEnd);
+    if (Current != NULL) {
+        Current->Wall += LastEnd - StageStart;
+        Current = NULL;
+    }
+}
+
+static PsuProfSite *FindSite(UINTPTR Addr, u32 Mask, u32 Value)
+{
+    u32 i;
+
+    for (i = 0; i < NumSites; i++) {
+        if ((Sites[i].Addr == (u32)Addr) && (Sites[i].Mask == Mask) &&
+            (Sites[i].Value == Value) && (Sites[i].Stage == Current)) {
+            return &Sites[i];
+        }
+    }
+    if (NumSites == PSU_PROF_MAX_SITES) {
+        return NULL;
+    }
+    Sites[NumSites].Addr = (u32)Addr;
+    Sites[NumSites].Mask = Mask;
+    Sites[NumSites].Value = Value;
+    Sites[NumSites].Stage = Current;
+    return &Sites[NumSites++];
+}
+
+void PsuProf_Poll(UINTPTR Addr, u32 Mask, u32 Value, u32 Reads,
+                  XTime Since, int Done)
+{
+    PsuProfSite *Site = FindSite(Addr, Mask, Value);
+    XTime Now;
+    XTime Ticks;
+
+    XTime_GetTime(&Now);
+    Ticks = Now - Since;
+
+    if (Current != NULL) {
+        Current->Polls++;
+        Current->Reads += Reads;
+        Current->Wait += Ticks;
+    }
+    if (Site != NULL) {
+        Site->Calls++;
+        Site->Timeouts += Done ? 0U : 1U;
+        Site->Reads += Reads;
+        Site->Ticks += Ticks;
+        if (Reads > Site->MaxReads) {
+            Site->MaxReads = Reads;
+        }
+        if (Ticks > Site->MaxTicks) {
+            Site->MaxTicks = Ticks;
+        }
+    }
+}
+
+void PsuProf_Delay(u32 Us, XTime Since)
+{
+    XTime Now;
+
+    XTime_GetTime(&Now);
+    if (Current != NULL) {
+        Current->DelayUs += Us;
+        Current->Wait += Now - Since;
+    }
+}
+
+/* ------------------------------------------------------------
+ * Report
+ * ------------------------------------------------------------ */
+static void PrintLabel(const char *Name)
+{
+    u32 Len = (u32)strlen(Name) + 2U;
+
+    xil_printf("%s :", Name);
+    for (; Len < PROF_LABEL_WIDTH; Len++) {
+        xil_printf(" ");
+    }
+}
+
+static u32 ToUs(XTime Ticks)
+{
+    return (u32)((Ticks * 1000000U) / COUNTS_PER_SECOND);
+}
+
+/* h:m:s with microseconds, dfx_runtime.txt only has whole seconds */
+static void PrintTime(const char *Tag, XTime Ticks)
+{
+    u64 Us = (Ticks * 1000000U) / COUNTS_PER_SECOND;
+    u32 Sec = (u32)(Us / 1000000U);
+
+    xil_printf("%s : %d:%d:%d.%06d ", Tag, (int)(Sec / 3600U),
+               (int)((Sec / 60U) % 60U), (int)(Sec % 60U),
+               (int)(Us % 1000000U));
+}
+
+static void PrintLine(const char *Name, XTime Wall, XTime Wait, XTime Total)
+{
+    u32 Pct = (Total != 0U) ? (u32)((Wall * 10000U) / Total) : 0U;
+
+    PrintLabel(Name);
+    PrintTime("CPU", Wall - Wait);
+    PrintTime("WALL", Wall);
+    xil_printf(" %d.%02d %% ", (int)(Pct / 100U), (int)(Pct % 100U));
+}
+
+void PsuProf_Report(void)
+{
+    XTime Total = LastEnd - FirstStart;
+    XTime Wait = 0;
+    u32 i;
+
+    for (i = 0; i < NumStages; i++) {
+        Wait += Stages[i].Wait;
+    }
+
+    xil_printf("PSUInit Profile Report:\r\n");
+    PrintLine("Total psu_init Runtime", Total, Wait, Total);
+    xil_printf("\r\n");
+
+    for (i = 0; i < NumStages; i++) {
+        PsuProfStage *S = &Stages[i];
+
+        PrintLine(S->Name, S->Wall, S->Wait, Total);
+        xil_printf("POLLS : %d READS : %d DELAY : %d us\r\n",
+                   (int)S->Polls, (int)S->Reads, (int)S->DelayUs);
+    }
+
+    xil_printf("\r\nPoll Sites:\r\n");
+    for (i = 0; i < NumSites; i++) {
+        PsuProfSite *P = &Sites[i];
+
+        if (P->Value == PSU_PROF_ANY_BIT) {
+            xil_printf("0x%08x & 0x%08x != 0          ", P->Addr, P->Mask);
+        } else {
+            xil_printf("0x%08x & 0x%08x == 0x%08x ", P->Addr, P->Mask,
+                       P->Value);
+        }
+        xil_printf("%s : CALLS : %d READS : %d (max %d) TIME : %d us "
+                   "(max %d us) TIMEOUTS : %d\r\n",
+                   (P->Stage != NULL) ? P->Stage->Name : "-",
+                   (int)P->Calls, (int)P->Reads, (int)P->MaxReads,
+                   (int)ToUs(P->Ticks), (int)ToUs(P->MaxTicks),
+                   (int)P->Timeouts);
+    }
+}
+
+void PsuProf_Reset(void)
+{
+    memset(Stages, 0, sizeof(Stages));
+    memset(Sites, 0, sizeof(Sites));
+    NumSites = 0;
+    NumStages = 0;
+    Current = NULL;
+    StageStart = 0;
+    FirstStart = 0;
+    LastEnd = 0;
+    Begun = 0;
+}
+
+#endif /* PSU_PROF */
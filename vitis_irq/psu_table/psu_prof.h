@@ -0,0 +1,83 @@
+/******************************************************************************
+ * Boot-stage profiler for psu_init()
+ *
+ * Built with PSU_PROF defined, every stage psu_init() runs is wrapped in
+ * PSU_PROF_STAGE() by gen_psu_table.py and timestamped with the A53
+ * generic counter (XTime_GetTime()). The poll and delay primitives in
+ * psu_table.c charge their register reads and wait time to the running
+ * stage, so the report separates time spent waiting on hardware (PLL
+ * lock, DDR PHY training, mask_delay) from time spent issuing writes.
+ *
+ * Each poll site - register, mask and expected value within a stage - also
+ * keeps its call count, reads, time and timeouts, worst case included,
+ * which is what the PSU_POLL_BUDGET_US / PSU_WAIT_BUDGET_US budgets in
+ * psu_table.h are tuned from.
+ *
+ * PsuProf_Report() prints the result in the layout of the Vitis
+ * dfx_runtime.txt profile; call it once the UART is up, i.e. after
+ * psu_init() has returned. WALL is the stage time, CPU the part of it
+ * not spent in polls or delays.
+ *
+ * The generated psu_init() starts the generic counter before its first
+ * stage (PsuTable_StartCounter()); psu_init.c would only start it in
+ * psu_peripherals_init_data(), and every stage before would read 0.
+ * The counter is clocked from the timestamp reference, which
+ * psu_clock_init_data() reprograms: stages before it are scaled by
+ * COUNTS_PER_SECOND and read slow if the reset clock differs.
+ *
+ * Without PSU_PROF all hooks compile to nothing.
+ ******************************************************************************/
+
+#ifndef PSU_PROF_H_
+#define PSU_PROF_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+#include "xtime_l.h"
+
+/* Distinct stage names kept; a repeated name accumulates */
+#ifndef PSU_PROF_MAX_STAGES
+#define PSU_PROF_MAX_STAGES 16U
+#endif
+
+/* Distinct poll sites kept */
+#ifndef PSU_PROF_MAX_SITES
+#define PSU_PROF_MAX_SITES  32U
+#endif
+
+/* Value of a site that waits for any bit of the mask */
+#define PSU_PROF_ANY_BIT    0xFFFFFFFFU
+
+#ifdef PSU_PROF
+
+void PsuProf_Begin(const char *Stage);
+void PsuProf_End(void);
+void PsuProf_Poll(UINTPTR Addr, u32 Mask, u32 Value, u32 Reads,
+                  XTime Since, int Done);
+void PsuProf_Delay(u32 Us, XTime Since);
+void PsuProf_Report(void);
+void PsuProf_Reset(void);
+
+#define PSU_PROF_STAGE(Name, Stmt) \
+    do { PsuProf_Begin(Name); Stmt; PsuProf_End(); } while (0)
+#define PSU_PROF_MARK(Var)          XTime Var; XTime_GetTime(&Var)
+#define PSU_PROF_POLL(Addr, Mask, Value, Reads, Since, Done) \
+    PsuProf_Poll((Addr), (Mask), (Value), (Reads), (Since), (Done))
+#define PSU_PROF_DELAY(Us, Since)   PsuProf_Delay((Us), (Since))
+
+#else
+
+#define PSU_PROF_STAGE(Name, Stmt)  Stmt
+#define PSU_PROF_MARK(Var)
+#define PSU_PROF_POLL(Addr, Mask, Value, Reads, Since, Done)
+#define PSU_PROF_DELAY(Us, Since)
+
+#endif /* PSU_PROF */
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,191 @@
+/******************************************************************************
+ * Table-driven PSU register initialization - see psu_table.h
+ ******************************************************************************/
+
+#include "psu_table.h"
+#include "psu_prof.h"
+#include "xil_io.h"
+#include "xtime_l.h"
+#include "sleep.h"
+
+/* The WFE backoff needs the ARMv8 generic timer event stream; other
+ * cores (the R5 FSBL) poll back to back until the budget runs out */
+#if defined(__aarch64__) || defined(HOST_SIM)
+#include "xpseudo_asm.h"
+#define POLL_USE_WFE
+#endif
+
+#define TICKS_PER_US        (COUNTS_PER_SECOND / 1000000U)
+
+/* IOU_SCNTRS, the system timestamp generator behind the generic counter */
+#define SCNTRS_COUNTER_CONTROL  0xFF260000U
+#define SCNTRS_BASE_FREQUENCY   0xFF260020U
+#define SCNTRS_EN               0x00000001U
+
+/* CNTKCTL_EL1 event stream fields, EVNTDIR left 0 (0 -> 1 edges) */
+#define CNTKCTL_EVNTEN      0x004U
+#define CNTKCTL_EVNTI_SHIFT 4U
+#define CNTKCTL_EVNT_MASK   0x0FCU
+
+#ifdef POLL_USE_WFE
+static u64 EventStreamOn(void)
+{
+    u64 Saved = mfcp(cntkctl_el1);
+
+    mtcp(cntkctl_el1, (Saved & ~(u64)CNTKCTL_EVNT_MASK) | CNTKCTL_EVNTEN |
+         ((u64)PSU_POLL_EVENT_BIT << CNTKCTL_EVNTI_SHIFT));
+    isb();
+    return Saved;
+}
+
+static void EventStreamRestore(u64 Saved)
+{
+    mtcp(cntkctl_el1, Saved);
+    isb();
+}
+#endif
+
+void PsuTable_StartCounter(void)
+{
+    if ((Xil_In32(SCNTRS_COUNTER_CONTROL) & SCNTRS_EN) == 0U) {
+        Xil_Out32(SCNTRS_BASE_FREQUENCY, COUNTS_PER_SECOND);
+        Xil_Out32(SCNTRS_COUNTER_CONTROL, SCNTRS_EN);
+    }
+}
+
+/* ------------------------------------------------------------
+ * Read until (Reg & Mask) is non-zero (AnyBit) or equals Value,
+ * for at most BudgetUs. After PSU_POLL_SPIN_READS reads it
+ * sleeps in WFE between reads; if the counter is found stopped it
+ * falls back to spinning, bounded by PSU_TABLE_POLL_TIME reads.
+ * ------------------------------------------------------------ */
+static int PollUntil(UINTPTR Addr, u32 Mask, u32 Value, int AnyBit,
+                     u32 BudgetUs)
+{
+    XTime Budget = (XTime)BudgetUs * TICKS_PER_US;
+    XTime Start;
+    XTime Now;
+    u32 Reads = 0;
+    u32 RegVal;
+    int Done;
+#ifdef POLL_USE_WFE
+    XTime Prev;
+    u64 Saved = 0;
+    int Stream = 0;
+    u32 Backoff = 1;
+    u32 i;
+#endif
+
+    XTime_GetTime(&Start);
+    Now = Start;
+    while (1) {
+        RegVal = Xil_In32(Addr);
+        Reads++;
+        Done = AnyBit ? ((RegVal & Mask) != 0U) : ((RegVal & Mask) == Value);
+        if (Done || (Reads > PSU_TABLE_POLL_TIME)) {
+            break;
+        }
+
+#ifdef POLL_USE_WFE
+        Prev = Now;
+#endif
+        XTime_GetTime(&Now);
+        if (Now - Start >= Budget) {
+            break;
+        }
+
+#ifdef POLL_USE_WFE
+        if ((Reads >= PSU_POLL_SPIN_READS) && (Now != Prev)) {
+            if (!Stream) {
+                Saved = EventStreamOn();
+                Stream = 1;
+            }
+            for (i = 0; i < Backoff; i++) {
+                wfe();
+            }
+            if (Backoff < PSU_POLL_MAX_BACKOFF) {
+                Backoff <<= 1;
+            }
+        }
+#endif
+    }
+
+#ifdef POLL_USE_WFE
+    if (Stream) {
+        EventStreamRestore(Saved);
+    }
+#endif
+    PSU_PROF_POLL(Addr, Mask, AnyBit ? PSU_PROF_ANY_BIT : Value, Reads,
+                  Start, Done);
+    return Done;
+}
+
+int PsuTable_Poll(UINTPTR Addr, u32 Mask)
+{
+    return PollUntil(Addr, Mask, 0U, 1, PSU_POLL_BUDGET_US);
+}
+
+int PsuTable_PollValue(UINTPTR Addr, u32 Mask, u32 Value)
+{
+    return PollUntil(Addr, Mask, Value, 0, PSU_POLL_BUDGET_US);
+}
+
+/* The register waits of the DDR PHY bring-up */
+int PsuTable_Wait(UINTPTR Addr, u32 Mask, u32 Value)
+{
+    return PollUntil(Addr, Mask, Value, 0, PSU_WAIT_BUDGET_US);
+}
+
+void PsuTable_Delay(u32 Us)
+{
+    PSU_PROF_MARK(Start);
+
+    usleep(Us);
+    PSU_PROF_DELAY(Us, Start);
+}
+
+/* ------------------------------------------------------------
+ * Execute Count records in order. Returns 1 like the unrolled
+ * psu_*_data() functions it replaces, or 0 as soon as a poll
+ * times out when PSU_POLL_FAIL_FAST is set.
+ * ------------------------------------------------------------ */
+unsigned long PsuTable_Run(const PsuOp *Ops, u32 Count)
+{
+    const PsuOp *End = Ops + Count;
+    UINTPTR Addr;
+    u32 RegVal;
+    int Ok;
+
+    for (; Ops < End; Ops++) {
+        Addr = (UINTPTR)(Ops->AddrOp & ~PSU_OP_MASK);
+        Ok = 1;
+
+        switch (Ops->AddrOp & PSU_OP_MASK) {
+        case PSU_OP_WRITE:
+            /* A full-word write needs no read-modify-write */
+            RegVal = Ops->Value;
+            if (Ops->Mask != PSU_FULL_MASK) {
+                RegVal = Xil_In32(Addr);
+                RegVal &= ~Ops->Mask;
+                RegVal |= (Ops->Value & Ops->Mask);
+            }
+            Xil_Out32(Addr, RegVal);
+            break;
+        case PSU_OP_POLL:
+            Ok = PsuTable_Poll(Addr, Ops->Mask);
+            break;
+        case PSU_OP_POLL_VALUE:
+            Ok = PsuTable_PollValue(Addr, Ops->Mask, Ops->Value);
+            break;
+        default:
+            PsuTable_Delay(Ops->Value);
+            break;
+        }
+
+        if (!Ok && PSU_POLL_FAIL_FAST) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
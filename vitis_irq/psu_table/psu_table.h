@@ -0,0 +1,141 @@
+/******************************************************************************
+ * Table-driven PSU register initialization
+ *
+ * The Vivado generated psu_init.c spells every init sequence out as
+ * hundreds of unrolled PSU_Mask_Write() / mask_poll() / mask_delay()
+ * calls. psu_init_table.c is produced from it by gen_psu_table.py: each
+ * straight-line psu_*() sequence becomes a const array of PsuOp records
+ * executed by PsuTable_Run(), and everything with real control flow
+ * (DDR PHY bring-up, psu_init() itself) is carried over unchanged.
+ *
+ * A record is three words. The operation lives in the two low bits of
+ * the register address, which is always word aligned.
+ *
+ * A write whose mask is PSU_FULL_MASK skips the read-modify-write, so
+ * most DDR controller registers cost one APB write instead of a read
+ * and a write. That is where the savings come from: on the ZUBoard
+ * export, 159 such writes take the write APB transactions from 1022 to
+ * 861. The generator can also fold back-to-back writes to different
+ * fields of one register into a single record (never on PLL control,
+ * reset or bypass registers, where each write is a step), but Vivado
+ * rarely writes a register twice in a row. This export has one such
+ * pair, in psu_apply_master_tz(), which psu_init() does not run.
+ ******************************************************************************/
+
+#ifndef PSU_TABLE_H_
+#define PSU_TABLE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+
+#define PSU_OP_WRITE        0U  /* Reg = (Reg & ~Mask) | (Value & Mask) */
+#define PSU_OP_POLL         1U  /* Wait for (Reg & Mask) != 0 */
+#define PSU_OP_POLL_VALUE   2U  /* Wait for (Reg & Mask) == Value */
+#define PSU_OP_DELAY        3U  /* Wait Value microseconds */
+#define PSU_OP_MASK         3U
+
+#define PSU_FULL_MASK       0xFFFFFFFFU
+
+/*
+ * Polls give up after a time budget on the generic counter and report
+ * the failure: PLL lock and power-up status polls get
+ * PSU_POLL_BUDGET_US, the DDR PHY/controller waits (unbounded in
+ * psu_init.c) PSU_WAIT_BUDGET_US. The budget only runs once the counter
+ * does, hence PsuTable_StartCounter() ahead of the first stage.
+ *
+ * By default a timeout is ignored and the sequence carries on, as
+ * psu_init.c does with the result of mask_poll(); the FSBL checks
+ * psu_init()'s stages in its own way and a board that used to boot with
+ * a slow lock keeps booting. Define PSU_POLL_FAIL_FAST to 1 to end the
+ * sequence at the first timeout instead, so the stage returns 0 and
+ * psu_init() fails rather than running on with an unlocked PLL.
+ */
+#ifndef PSU_POLL_BUDGET_US
+#define PSU_POLL_BUDGET_US  10000U
+#endif
+#ifndef PSU_WAIT_BUDGET_US
+#define PSU_WAIT_BUDGET_US  1000000U
+#endif
+#ifndef PSU_POLL_FAIL_FAST
+#define PSU_POLL_FAIL_FAST  0
+#endif
+
+/*
+ * After PSU_POLL_SPIN_READS back-to-back reads a poll sleeps in WFE
+ * between reads, woken by the generic timer event stream on bit
+ * PSU_POLL_EVENT_BIT of the counter (every 2^(bit+1) ticks, ~5 us at
+ * 100 MHz). Raising PSU_POLL_MAX_BACKOFF doubles the events slept per
+ * read up to that many, trading detection latency for fewer APB reads.
+ * The stream is only enabled while a poll waits.
+ */
+#ifndef PSU_POLL_SPIN_READS
+#define PSU_POLL_SPIN_READS 16U
+#endif
+#ifndef PSU_POLL_EVENT_BIT
+#define PSU_POLL_EVENT_BIT  8U
+#endif
+#ifndef PSU_POLL_MAX_BACKOFF
+#define PSU_POLL_MAX_BACKOFF 1U
+#endif
+
+/* Read cap, as PSU_MASK_POLL_TIME in psu_init.c; only reached if the
+ * generic counter is not running */
+#ifndef PSU_TABLE_POLL_TIME
+#define PSU_TABLE_POLL_TIME 1100000U
+#endif
+
+typedef struct {
+    u32 AddrOp;         /* Register address | PSU_OP_* */
+    u32 Mask;
+    u32 Value;
+} PsuOp;
+
+#define PSU_WRITE(Addr, Mask, Value) \
+    { (u32)(Addr) | PSU_OP_WRITE, (u32)(Mask), (u32)(Value) }
+#define PSU_POLL(Addr, Mask) \
+    { (u32)(Addr) | PSU_OP_POLL, (u32)(Mask), 0U }
+#define PSU_POLL_VALUE(Addr, Mask, Value) \
+    { (u32)(Addr) | PSU_OP_POLL_VALUE, (u32)(Mask), (u32)(Value) }
+#define PSU_DELAY(Us) \
+    { PSU_OP_DELAY, 0U, (u32)(Us) }
+
+#define PSU_TABLE_RUN(Table) \
+    PsuTable_Run((Table), (u32)(sizeof(Table) / sizeof((Table)[0])))
+
+unsigned long PsuTable_Run(const PsuOp *Ops, u32 Count);
+
+/*
+ * Start the generic counter if it is not running, as the BSP's
+ * XTime_StartTimer() does: frequency register, then enable. psu_init()
+ * calls it before its first stage; psu_init.c leaves it to
+ * psu_peripherals_init_data(), which writes the same values again.
+ */
+void PsuTable_StartCounter(void);
+
+/* Poll and delay primitives shared by the tables and the C sequences.
+ * The polls return 1 once the condition holds, 0 on timeout. */
+int PsuTable_Poll(UINTPTR Addr, u32 Mask);
+int PsuTable_PollValue(UINTPTR Addr, u32 Mask, u32 Value);
+int PsuTable_Wait(UINTPTR Addr, u32 Mask, u32 Value);
+void PsuTable_Delay(u32 Us);
+
+/* Register wait inside a C sequence returning unsigned long */
+#if PSU_POLL_FAIL_FAST
+#define PSU_WAIT(Addr, Mask, Value) \
+    do { \
+        if (!PsuTable_Wait((Addr), (Mask), (Value))) { \
+            return 0; \
+        } \
+    } while (0)
+#else
+#define PSU_WAIT(Addr, Mask, Value) \
+    ((void)PsuTable_Wait((Addr), (Mask), (Value)))
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif